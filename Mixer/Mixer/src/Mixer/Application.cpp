@@ -4,6 +4,16 @@
 #include "Mixer/Events/ApplicationEvent.h"
 #include "Mixer/Editor/EditorLayer.h"
 #include "Mixer/Log.h"
+#include "Mixer/JobSystem.h"
+#include "Mixer/FrameAllocator.h"
+#include "Mixer/MemoryTracker.h"
+#include "Mixer/StartupTimeline.h"
+#include "Mixer/CpuFeatures.h"
+#include "Mixer/Mesh/PositionKernels.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/CommandBucket.h"
+#include "Mixer/Renderer/TextureManager.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
 #include "Mixer/Editor/UILayer.h"
 
 #include <glad/glad.h>
@@ -17,55 +27,114 @@ namespace Mixer {
 	Application::Application()
 	{
 		s_Instance = this;
+		StartupTimeline::Begin(); // [추가] 첫 프레임까지 단계별 시간 (첫 프레임이 화면에 나오면 로그)
+		JobSystem::Init();
+
+		// [수정] CPU 감지/커널 선택은 창 + GL 컨텍스트 생성과 동시에 (서로 무관)
+		JobContext cpuSetup;
+		JobSystem::Execute(cpuSetup, []
+		{
+			CpuInfo::Detect();
+			PositionKernels::Init();
+			StartupTimeline::Mark("CPU features + position kernels");
+		});
 		m_Window = std::unique_ptr<Window>(Window::Create());
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
+		StartupTimeline::Mark("window + GL context");
+		RenderThread::Init(*m_Window); // 이후 GL 호출은 RenderThread::Submit / ExecuteNow로
+		TextureManager::Init();
+		StartupTimeline::Mark("render thread + texture manager");
+		JobSystem::Wait(cpuSetup); // 레이어보다 먼저 (OnAttach에서 커널 사용)
 
 		PushLayer(new EditorLayer);
-		PushOverlay(new UILayer()); // [߰] ̷  (  ׷)
+		PushOverlay(new UILayer()); // [추가] 오버레이로 등록 (가장 마지막에 그려짐)
 	}
 	Application::~Application()
 	{
-		
+		m_LayerStack.Clear(); // OnDetach는 GL 컨텍스트, 작업 스레드가 살아 있을 때
+		ShaderLibrary::Shutdown(); // 컴파일 중이던 프로그램까지
+		TextureManager::Shutdown(); // 레이어가 놓은 텍스처까지 (디코딩 작업은 기다림)
+		RenderThread::Shutdown(); // OnDetach에서 넣은 삭제 명령까지 실행
+		JobSystem::Shutdown();
 	}
 
-	void Application::PushLayer(Layer* layer)
+	// 추가/제거는 다음 프레임 시작(ApplyPending)에 반영 -> OnAttach/OnDetach도 그때 호출
+	LayerHandle Application::PushLayer(Layer* layer)
 	{
-		m_LayerStack.PushLayer(layer);
-		layer->OnAttach();
+		return m_LayerStack.PushLayer(std::unique_ptr<Layer>(layer));
 	}
 
-	void Application::PushOverlay(Layer* layer)
+	LayerHandle Application::PushOverlay(Layer* layer)
 	{
-		m_LayerStack.PushOverlay(layer);
-		layer->OnAttach();
+		return m_LayerStack.PushOverlay(std::unique_ptr<Layer>(layer));
+	}
+
+	void Application::PopLayer(LayerHandle layer)
+	{
+		m_LayerStack.PopLayer(layer);
 	}
 
 	void Application::OnEvent(Event& e)
 	{
+		MemoryTagScope memoryTag(MemoryTag::Events); // 레이어가 자기 작업은 다시 태그 (메쉬 편집 등)
 		EventDispatcher dispatcher(e);
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
 		//MX_CORE_TRACE("{0}", e.ToString());
 
-		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin();)
+		m_LayerStack.EachReverse(LayerUpdateEvents, [&e](Layer& layer)
 		{
-			(*--it)->OnEvent(e);
-			if (e.Handled)
-				break;
-		}
+			layer.OnEvent(e);
+			return e.Handled;
+		});
 	}
 
 
 	void Application::Run()
 	{	
+		uint32_t frameIndex = 0;
 		while (m_Running)
 		{
-			glClearColor(1, 0, 1, 1);
-			glClear(GL_COLOR_BUFFER_BIT);
-			for (Layer* layer : m_LayerStack)
+			// 지난 프레임 임시 메모리 반납 (이벤트 처리도 프레임 안에서 끝남)
+			FrameAllocator::BeginFrame();
+			m_LayerStack.ApplyPending();
+			if (frameIndex == 0)
+				StartupTimeline::Mark("layers attached"); // 셰이더 (바이너리 캐시) 포함
+			ReportFrameMemory();
+			MemoryTracker::CheckBudgets();
+			TextureManager::Update(); // [추가] 디코딩 끝난 텍스처를 예산만큼 업로드 (그리기보다 먼저 실행됨)
+			ShaderLibrary::Update();  // [추가] 바뀐 셰이더 파일은 다시 컴파일, 링크 성공하면 이번 프레임부터 교체
+
+			RenderThread::Submit([]
 			{
-				layer->OnUpdate();
-			}
+				glClearColor(1, 0, 1, 1);
+				glClear(GL_COLOR_BUFFER_BIT);
+			});
+			m_LayerStack.Each(LayerUpdateTick, [](Layer& layer) { layer.OnUpdate(); });
+
+			// 모든 레이어의 그리기 패킷을 정렬해서 명령 하나로 (업로드/클리어 뒤에 실행됨)
+			CommandBucket::Flush();
+			// 이번 프레임 명령은 렌더 스레드가 실행 + SwapBuffers, 그동안 이벤트 처리와 다음 프레임 갱신
+			RenderThread::EndFrame();
 			m_Window->OnUpdate();
+
+			// [추가] 두 번째 EndFrame은 첫 프레임의 SwapBuffers까지 기다림 -> 그때 타임라인 출력
+			if (frameIndex == 0)
+				StartupTimeline::Mark("first frame submitted");
+			else if (frameIndex == 1)
+				StartupTimeline::Finish();
+			frameIndex++;
+		}
+	}
+
+	void Application::ReportFrameMemory()
+	{
+		// 최고치가 늘었을 때만 (스레드별 아레나가 그만큼 커짐)
+		FrameAllocatorStats stats = FrameAllocator::GetStats();
+		if (stats.HighWaterMark > m_ReportedFramePeak)
+		{
+			m_ReportedFramePeak = stats.HighWaterMark;
+			MX_CORE_INFO("Frame arena high-water mark: {0:.1f} KB ({1} thread arenas)",
+				stats.HighWaterMark / 1024.0, stats.ArenaCount);
 		}
 	}
 
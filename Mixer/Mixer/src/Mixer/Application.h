@@ -17,18 +17,23 @@ namespace Mixer {
 
 		void OnEvent(Event& e);
 
-		void PushLayer(Layer* layer);
-		void PushOverlay(Layer* layer);
+		// [수정] 레이어 스택이 소유권을 가짐
+		LayerHandle PushLayer(Layer* layer);
+		LayerHandle PushOverlay(Layer* layer);
+		void PopLayer(LayerHandle layer);
+		LayerStack& GetLayerStack() { return m_LayerStack; }
 		
 		inline Window& GetWindow() { return *m_Window; }
 		static inline Application& Get() { return *s_Instance; }
 
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
+		void ReportFrameMemory();
 
 		std::unique_ptr<Window> m_Window;
 		bool m_Running = true;
 		LayerStack m_LayerStack;
+		size_t m_ReportedFramePeak = 0;
 
 		static Application* s_Instance;
 	};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Mixer/JobSystem.h"
+
+#include <atomic>
+#include <functional>
+
+namespace Mixer {
+
+	// JobSystem 작업 스레드에서 도는 긴 계산 하나. 결과는 소유자가 나중에 가져감 (프레임마다 확인)
+	// 작업 함수는 입력 사본 (값 캡처), 가끔 확인할 취소 플래그, 갱신할 진행률을 받음
+	// 작업 스레드가 이 객체에 결과를 쓰므로 소멸할 때 작업을 취소하고 끝날 때까지 기다림
+	template<typename Result>
+	class BackgroundTask
+	{
+	public:
+		using WorkFn = std::function<Result(const std::atomic<bool>& cancel, std::atomic<float>& progress)>;
+
+		BackgroundTask() = default;
+		BackgroundTask(const BackgroundTask&) = delete;
+		BackgroundTask& operator=(const BackgroundTask&) = delete;
+
+		~BackgroundTask()
+		{
+			m_Cancel = true;
+			JobSystem::Wait(m_Context);
+		}
+
+		// 이전 작업이 아직 돌고 있으면 false
+		bool Start(WorkFn work)
+		{
+			if (IsRunning())
+				return false;
+
+			m_Progress = 0.0f;
+			m_Cancel = false;
+			m_Started = true;
+			// 캡처한 입력이 작업 큐로 복사되지 않게 작업이 아니라 여기에 보관 (끝나면 작업 스레드에서 해제)
+			m_Work = std::move(work);
+			JobSystem::Execute(m_Context, [this]()
+			{
+				m_Result = m_Work(m_Cancel, m_Progress);
+				m_Work = nullptr;
+			});
+			return true;
+		}
+
+		void Cancel() { m_Cancel = true; }
+
+		bool IsRunning() const { return m_Started && JobSystem::IsBusy(m_Context); }
+		float GetProgress() const { return m_Progress.load(); }
+
+		// 작업이 끝난 뒤 결과를 한 번만 넘겨줌
+		bool TakeResult(Result& outResult)
+		{
+			if (!m_Started || JobSystem::IsBusy(m_Context))
+				return false;
+
+			outResult = std::move(m_Result);
+			m_Result = Result();
+			m_Started = false;
+			return true;
+		}
+
+	private:
+		JobContext m_Context;
+		WorkFn m_Work;
+		Result m_Result;
+		std::atomic<float> m_Progress{ 0.0f };
+		std::atomic<bool> m_Cancel{ false };
+		bool m_Started = false;
+	};
+
+}
@@ -20,4 +20,9 @@
 
 
 
+// [추가] 태그별 힙 할당 추적 (MemoryTracker), 배포 빌드에서는 빠짐
+#ifndef MX_DIST
+	#define MX_TRACK_MEMORY
+#endif
+
 #define BIT(x) (1 << x)
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "mxpch.h"
+#include "CpuFeatures.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define MX_CPU_X86
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace Mixer {
+
+	static CpuFeatures s_Features;
+	static char s_Brand[49] = "Unknown";
+
+#ifdef MX_CPU_X86
+	static void Cpuid(int leaf, int subleaf, int out[4])
+	{
+	#if defined(_MSC_VER)
+		__cpuidex(out, leaf, subleaf);
+	#else
+		unsigned int a, b, c, d;
+		__cpuid_count(leaf, subleaf, a, b, c, d);
+		out[0] = (int)a; out[1] = (int)b; out[2] = (int)c; out[3] = (int)d;
+	#endif
+	}
+
+	// XCR0: 문맥 전환 때 OS가 저장하는 레지스터 상태
+	static unsigned long long ReadXCR0()
+	{
+	#if defined(_MSC_VER)
+		return _xgetbv(0);
+	#else
+		unsigned int eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((unsigned long long)edx << 32) | eax;
+	#endif
+	}
+#endif
+
+	void CpuInfo::Detect()
+	{
+		s_Features = CpuFeatures();
+
+#ifdef MX_CPU_X86
+		int regs[4];
+		Cpuid(0, 0, regs);
+		int maxLeaf = regs[0];
+
+		Cpuid(1, 0, regs);
+		bool sse42 = (regs[2] & (1 << 20)) != 0;
+		bool fma = (regs[2] & (1 << 12)) != 0;
+		bool osxsave = (regs[2] & (1 << 27)) != 0;
+
+		bool avx2 = false, avx512f = false;
+		if (maxLeaf >= 7)
+		{
+			int ext[4];
+			Cpuid(7, 0, ext);
+			avx2 = (ext[1] & (1 << 5)) != 0;
+			avx512f = (ext[1] & (1 << 16)) != 0;
+		}
+
+		// AVX는 XMM|YMM 상태 (1-2번 비트), AVX-512는 추가로 opmask/ZMM 상태 (5-7번 비트) 필요
+		unsigned long long xcr0 = osxsave ? ReadXCR0() : 0;
+		bool osAVX = (xcr0 & 0x6) == 0x6;
+		bool osAVX512 = (xcr0 & 0xE6) == 0xE6;
+
+		s_Features.SSE42 = sse42;
+		s_Features.AVX2 = avx2 && fma && osAVX;
+		s_Features.AVX512 = avx512f && s_Features.AVX2 && osAVX512;
+
+		Cpuid(0x80000000, 0, regs);
+		if ((unsigned int)regs[0] >= 0x80000004)
+		{
+			int brand[12];
+			Cpuid(0x80000002, 0, brand);
+			Cpuid(0x80000003, 0, brand + 4);
+			Cpuid(0x80000004, 0, brand + 8);
+			std::memcpy(s_Brand, brand, 48);
+			s_Brand[48] = '\0';
+		}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+		s_Features.NEON = true; // ARMv8-A에서는 필수
+#endif
+
+		MX_CORE_INFO("CPU: {0} (SSE4.2: {1}, AVX2: {2}, AVX-512: {3}, NEON: {4})", s_Brand,
+			s_Features.SSE42, s_Features.AVX2, s_Features.AVX512, s_Features.NEON);
+	}
+
+	const CpuFeatures& CpuInfo::GetFeatures()
+	{
+		return s_Features;
+	}
+
+	const char* CpuInfo::GetBrand()
+	{
+		return s_Brand;
+	}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+namespace Mixer {
+
+	// 이 기기에서 쓸 수 있는 명령어 집합 (CPU 지원과 OS의 레지스터 상태 저장 지원을 둘 다 확인)
+	struct CpuFeatures
+	{
+		bool SSE42 = false;
+		bool AVX2 = false;   // AVX2 + FMA3
+		bool AVX512 = false; // AVX-512 F
+		bool NEON = false;
+	};
+
+	class MIXER_API CpuInfo
+	{
+	public:
+		// Application 시작 때 한 번, 커널 표를 고르기 전에 호출
+		static void Detect();
+
+		static const CpuFeatures& GetFeatures();
+		static const char* GetBrand();
+	};
+
+}
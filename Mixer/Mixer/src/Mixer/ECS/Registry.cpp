@@ -0,0 +1,154 @@
+#include "mxpch.h"
+#include "Registry.h"
+
+namespace Mixer {
+
+	Registry::Registry()
+	{
+		FindArchetype(0);
+	}
+
+	Entity Registry::Create()
+	{
+		uint32_t index;
+		if (!m_FreeIndices.empty())
+		{
+			index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)m_Locations.size();
+			m_Locations.push_back({ 0, 0 });
+			m_Generations.push_back(0);
+		}
+
+		Entity entity = (Entity(m_Generations[index]) << 24) | index;
+		m_Locations[index] = { 0, AppendRow(0, entity) };
+		m_AliveCount++;
+		m_StructureVersion++;
+		return entity;
+	}
+
+	void Registry::Destroy(Entity entity)
+	{
+		if (!IsAlive(entity))
+			return;
+
+		uint32_t index = Index(entity);
+		RemoveRow(m_Locations[index].Archetype, m_Locations[index].Row);
+		m_Generations[index]++;
+		m_FreeIndices.push_back(index);
+		m_AliveCount--;
+		m_StructureVersion++;
+	}
+
+	bool Registry::IsAlive(Entity entity) const
+	{
+		uint32_t index = Index(entity);
+		return entity != NullEntity && index < m_Generations.size() && m_Generations[index] == Generation(entity);
+	}
+
+	uint32_t Registry::FindArchetype(ComponentMask mask)
+	{
+		auto it = m_ArchetypeLookup.find(mask);
+		if (it != m_ArchetypeLookup.end())
+			return it->second;
+
+		Archetype archetype;
+		archetype.Mask = mask;
+		for (uint32_t i = 0; i < MaxComponentTypes; i++)
+		{
+			archetype.AddEdges[i] = ~0u;
+			archetype.RemoveEdges[i] = ~0u;
+		}
+
+		uint32_t index = (uint32_t)m_Archetypes.size();
+		m_Archetypes.push_back(std::move(archetype));
+		m_ArchetypeLookup[mask] = index;
+		return index;
+	}
+
+	uint32_t Registry::FindAddTarget(uint32_t archetype, uint32_t componentID)
+	{
+		// 같은 컴포넌트를 반복해서 추가/제거하면 캐시한 간선으로 배열 조회 한 번
+		if (m_Archetypes[archetype].AddEdges[componentID] == ~0u)
+		{
+			uint32_t target = FindArchetype(m_Archetypes[archetype].Mask | (ComponentMask(1) << componentID));
+			m_Archetypes[archetype].AddEdges[componentID] = target;
+			m_Archetypes[target].RemoveEdges[componentID] = archetype;
+		}
+		return m_Archetypes[archetype].AddEdges[componentID];
+	}
+
+	uint32_t Registry::FindRemoveTarget(uint32_t archetype, uint32_t componentID)
+	{
+		if (m_Archetypes[archetype].RemoveEdges[componentID] == ~0u)
+		{
+			uint32_t target = FindArchetype(m_Archetypes[archetype].Mask & ~(ComponentMask(1) << componentID));
+			m_Archetypes[archetype].RemoveEdges[componentID] = target;
+			m_Archetypes[target].AddEdges[componentID] = archetype;
+		}
+		return m_Archetypes[archetype].RemoveEdges[componentID];
+	}
+
+	uint32_t Registry::AppendRow(uint32_t archetype, Entity entity)
+	{
+		Archetype& target = m_Archetypes[archetype];
+		for (uint32_t id = 0; id < MaxComponentTypes; id++)
+		{
+			if (target.Mask & (ComponentMask(1) << id))
+				target.Columns[id].resize(target.Columns[id].size() + m_ComponentSizes[id]);
+		}
+		target.Entities.push_back(entity);
+		return (uint32_t)target.Entities.size() - 1;
+	}
+
+	void Registry::RemoveRow(uint32_t archetype, uint32_t row)
+	{
+		// 마지막 행과 바꿔서 열을 빈틈없이 유지
+		Archetype& source = m_Archetypes[archetype];
+		uint32_t last = (uint32_t)source.Entities.size() - 1;
+		for (uint32_t id = 0; id < MaxComponentTypes; id++)
+		{
+			if (!(source.Mask & (ComponentMask(1) << id)))
+				continue;
+
+			uint32_t size = m_ComponentSizes[id];
+			if (row != last)
+				std::memcpy(source.Columns[id].data() + row * size, source.Columns[id].data() + last * size, size);
+			source.Columns[id].resize(last * size);
+		}
+
+		if (row != last)
+		{
+			source.Entities[row] = source.Entities[last];
+			m_Locations[Index(source.Entities[row])].Row = row;
+		}
+		source.Entities.pop_back();
+	}
+
+	void Registry::MoveEntity(Entity entity, uint32_t targetArchetype)
+	{
+		Location& location = m_Locations[Index(entity)];
+		uint32_t sourceArchetype = location.Archetype, sourceRow = location.Row;
+
+		uint32_t row = AppendRow(targetArchetype, entity);
+		Archetype& source = m_Archetypes[sourceArchetype];
+		Archetype& target = m_Archetypes[targetArchetype];
+		for (uint32_t id = 0; id < MaxComponentTypes; id++)
+		{
+			ComponentMask bit = ComponentMask(1) << id;
+			if ((source.Mask & bit) && (target.Mask & bit))
+			{
+				uint32_t size = m_ComponentSizes[id];
+				std::memcpy(target.Columns[id].data() + row * size, source.Columns[id].data() + sourceRow * size, size);
+			}
+		}
+
+		RemoveRow(sourceArchetype, sourceRow);
+		location = { targetArchetype, row };
+		m_StructureVersion++;
+	}
+
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "Mixer/Core.h"
+#include "Mixer/JobSystem.h"
+
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+#include <cstring>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 하위 24비트: 슬롯 번호, 상위 8비트: 세대 (지난 핸들은 IsAlive가 false)
+	using Entity = uint32_t;
+	static constexpr Entity NullEntity = ~0u;
+
+	using ComponentMask = uint32_t;
+	static constexpr uint32_t MaxComponentTypes = 32;
+
+	// 컴포넌트는 고유한 `static constexpr uint32_t ID` (< MaxComponentTypes)를 가진 단순 구조체
+	// 아키타입 사이에서 행을 memcpy로 옮기므로 trivially copyable이어야 함
+	template<typename T>
+	constexpr ComponentMask ComponentBit() { return ComponentMask(1) << T::ID; }
+
+	template<typename... T>
+	constexpr ComponentMask ComponentMaskOf() { return (ComponentMask(0) | ... | ComponentBit<T>()); }
+
+	// 컴포넌트 구성이 같은 엔티티는 아키타입 하나를 공유 (컴포넌트마다 빈틈없이 채운 열 하나)
+	struct Archetype
+	{
+		ComponentMask Mask = 0;
+		std::vector<Entity> Entities;
+		std::vector<uint8_t> Columns[MaxComponentTypes];
+		uint32_t AddEdges[MaxComponentTypes];    // 컴포넌트 i를 추가하면 옮겨 갈 아키타입 (캐시)
+		uint32_t RemoveEdges[MaxComponentTypes]; // ... 제거하면 옮겨 갈 아키타입
+
+		template<typename T>
+		T* Column() { return reinterpret_cast<T*>(Columns[T::ID].data()); }
+		template<typename T>
+		const T* Column() const { return reinterpret_cast<const T*>(Columns[T::ID].data()); }
+	};
+
+	// 아키타입 기반 엔티티/컴포넌트 저장소
+	// 구조 변경 (Create/Destroy/Add/Remove)은 컴포넌트 참조를 무효로 만들므로 Each/ParallelEach 안에서는 금지
+	class Registry
+	{
+	public:
+		Registry();
+
+		Entity Create();
+		void Destroy(Entity entity);
+		bool IsAlive(Entity entity) const;
+		size_t GetEntityCount() const { return m_AliveCount; }
+
+		template<typename T>
+		T& Add(Entity entity, const T& component = T())
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "components must be trivially copyable");
+			m_ComponentSizes[T::ID] = sizeof(T);
+
+			Location& location = m_Locations[Index(entity)];
+			if (m_Archetypes[location.Archetype].Mask & ComponentBit<T>())
+				return Get<T>(entity) = component;
+
+			MoveEntity(entity, FindAddTarget(location.Archetype, T::ID));
+			T& added = Get<T>(entity);
+			added = component;
+			return added;
+		}
+
+		template<typename T>
+		void Remove(Entity entity)
+		{
+			Location& location = m_Locations[Index(entity)];
+			if (m_Archetypes[location.Archetype].Mask & ComponentBit<T>())
+				MoveEntity(entity, FindRemoveTarget(location.Archetype, T::ID));
+		}
+
+		template<typename T>
+		bool Has(Entity entity) const
+		{
+			return IsAlive(entity) && (m_Archetypes[m_Locations[Index(entity)].Archetype].Mask & ComponentBit<T>()) != 0;
+		}
+
+		template<typename T>
+		T& Get(Entity entity)
+		{
+			const Location& location = m_Locations[Index(entity)];
+			return m_Archetypes[location.Archetype].Column<T>()[location.Row];
+		}
+
+		template<typename T>
+		const T& Get(Entity entity) const
+		{
+			const Location& location = m_Locations[Index(entity)];
+			return m_Archetypes[location.Archetype].Column<T>()[location.Row];
+		}
+
+		// T...를 전부 가진 엔티티마다 fn(Entity, T&...)
+		template<typename... T, typename Fn>
+		void Each(Fn&& fn)
+		{
+			constexpr ComponentMask mask = ComponentMaskOf<T...>();
+			for (Archetype& archetype : m_Archetypes)
+			{
+				if ((archetype.Mask & mask) != mask || archetype.Entities.empty())
+					continue;
+				for (size_t row = 0; row < archetype.Entities.size(); row++)
+					fn(archetype.Entities[row], archetype.Column<T>()[row]...);
+			}
+		}
+
+		template<typename... T, typename Fn>
+		void Each(Fn&& fn) const
+		{
+			constexpr ComponentMask mask = ComponentMaskOf<T...>();
+			for (const Archetype& archetype : m_Archetypes)
+			{
+				if ((archetype.Mask & mask) != mask || archetype.Entities.empty())
+					continue;
+				for (size_t row = 0; row < archetype.Entities.size(); row++)
+					fn(archetype.Entities[row], archetype.Column<T>()[row]...);
+			}
+		}
+
+		// Each와 같지만 행을 묶음으로 나눠서 작업 시스템에서 병렬 실행
+		// fn은 넘겨받은 컴포넌트에만 써야 함
+		template<typename... T, typename Fn>
+		void ParallelEach(Fn&& fn, uint32_t groupSize = 1024)
+		{
+			constexpr ComponentMask mask = ComponentMaskOf<T...>();
+			JobContext context;
+			for (Archetype& archetype : m_Archetypes)
+			{
+				if ((archetype.Mask & mask) != mask || archetype.Entities.empty())
+					continue;
+
+				Archetype* target = &archetype;
+				JobSystem::Dispatch(context, (uint32_t)archetype.Entities.size(), groupSize, [target, &fn](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t row = begin; row < end; row++)
+						fn(target->Entities[row], target->Column<T>()[row]...);
+				});
+			}
+			JobSystem::Wait(context);
+		}
+
+		template<typename... T, typename Fn>
+		void ParallelEach(Fn&& fn, uint32_t groupSize = 1024) const
+		{
+			constexpr ComponentMask mask = ComponentMaskOf<T...>();
+			JobContext context;
+			for (const Archetype& archetype : m_Archetypes)
+			{
+				if ((archetype.Mask & mask) != mask || archetype.Entities.empty())
+					continue;
+
+				const Archetype* target = &archetype;
+				JobSystem::Dispatch(context, (uint32_t)archetype.Entities.size(), groupSize, [target, &fn](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t row = begin; row < end; row++)
+						fn(target->Entities[row], target->Column<T>()[row]...);
+				});
+			}
+			JobSystem::Wait(context);
+		}
+
+		template<typename... T>
+		size_t Count() const
+		{
+			constexpr ComponentMask mask = ComponentMaskOf<T...>();
+			size_t count = 0;
+			for (const Archetype& archetype : m_Archetypes)
+			{
+				if ((archetype.Mask & mask) == mask)
+					count += archetype.Entities.size();
+			}
+			return count;
+		}
+
+		// 구조가 바뀔 때마다 (생성/삭제/추가/제거) 증가
+		uint32_t GetStructureVersion() const { return m_StructureVersion; }
+
+	private:
+		struct Location
+		{
+			uint32_t Archetype;
+			uint32_t Row;
+		};
+
+		static uint32_t Index(Entity entity) { return entity & 0xFFFFFF; }
+		static uint32_t Generation(Entity entity) { return entity >> 24; }
+
+		uint32_t FindArchetype(ComponentMask mask);
+		uint32_t FindAddTarget(uint32_t archetype, uint32_t componentID);
+		uint32_t FindRemoveTarget(uint32_t archetype, uint32_t componentID);
+		uint32_t AppendRow(uint32_t archetype, Entity entity);
+		void RemoveRow(uint32_t archetype, uint32_t row);
+		void MoveEntity(Entity entity, uint32_t targetArchetype);
+
+	private:
+		std::vector<Archetype> m_Archetypes; // [0]은 빈 아키타입
+		std::unordered_map<ComponentMask, uint32_t> m_ArchetypeLookup;
+		uint32_t m_ComponentSizes[MaxComponentTypes] = {};
+
+		std::vector<Location> m_Locations;
+		std::vector<uint8_t> m_Generations;
+		std::vector<uint32_t> m_FreeIndices;
+		size_t m_AliveCount = 0;
+		uint32_t m_StructureVersion = 0;
+	};
+
+}
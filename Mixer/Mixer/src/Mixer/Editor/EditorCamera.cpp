@@ -0,0 +1,214 @@
+#include "EditorCamera.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Mixer {
+
+    static float GetTransitionProgress(std::chrono::steady_clock::time_point start, float seconds)
+    {
+        float t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() / seconds;
+        t = std::min(std::max(t, 0.0f), 1.0f);
+        return t * t * (3.0f - 2.0f * t); // smoothstep (처음과 끝이 느림)
+    }
+
+    void EditorCamera::OnUpdate()
+    {
+        if (m_IsAnimatingAngles)
+        {
+            float t = GetTransitionProgress(m_AnglesStart, ViewTransitionSeconds);
+            m_Yaw = m_FromYaw + (m_ToYaw - m_FromYaw) * t;
+            m_Pitch = m_FromPitch + (m_ToPitch - m_FromPitch) * t;
+            m_IsAnimatingAngles = t < 1.0f;
+            m_ViewDirty = true;
+        }
+
+        if (m_IsAnimatingProjection)
+        {
+            float t = GetTransitionProgress(m_ProjectionStart, ViewTransitionSeconds);
+            float target = m_Orthographic ? 1.0f : 0.0f;
+            m_Blend = m_FromBlend + (target - m_FromBlend) * t;
+            m_IsAnimatingProjection = t < 1.0f;
+            m_ProjectionDirty = true;
+        }
+    }
+
+    void EditorCamera::SetViewportSize(float width, float height)
+    {
+        if (width == m_ViewportWidth && height == m_ViewportHeight)
+            return;
+        m_ViewportWidth = width;
+        m_ViewportHeight = height;
+        m_ProjectionDirty = true;
+    }
+
+    void EditorCamera::Orbit(const glm::vec2& delta)
+    {
+        float rotationSpeed = 0.005f;
+        m_IsAnimatingAngles = false; // 전환 중이던 각도에서 바로 마우스를 따름
+        m_Yaw += delta.x * rotationSpeed;
+        m_Pitch = std::min(std::max(m_Pitch + delta.y * rotationSpeed, -MaxPitch), MaxPitch);
+        m_ViewDirty = true;
+
+        // 직교 뷰는 축 정렬 시점용: 돌리기 시작하면 원근으로 (블렌더의 Auto Perspective)
+        SetOrthographic(false);
+    }
+
+    void EditorCamera::Pan(const glm::vec2& delta)
+    {
+        // [이동] Focal Point 자체를 이동 (Local Axis 적용)
+        float panSpeed = 0.005f * m_Distance;
+
+        // 카메라 축은 뷰 행렬의 행: Right = 1행, Up = 2행 (lookAt이 WorldUp으로 직교화해 둔 값)
+        const glm::mat4& view = GetView();
+        glm::vec3 right(view[0][0], view[1][0], view[2][0]);
+        glm::vec3 up(view[0][1], view[1][1], view[2][1]);
+
+        // 마우스를 오른쪽으로 드래그(+X) -> 카메라는 왼쪽(-Right)으로 가야 물체가 오른쪽으로 옴
+        // 마우스를 아래로 드래그(+Y) -> 카메라는 위쪽(+Up)으로 가야 물체가 아래로 옴
+        m_FocalPoint -= right * delta.x * panSpeed;
+        m_FocalPoint += up * delta.y * panSpeed;
+        m_ViewDirty = true;
+    }
+
+    void EditorCamera::Zoom(float delta)
+    {
+        float zoomSpeed = 0.5f;
+        m_Distance = std::max(m_Distance - delta * zoomSpeed, 0.1f); // 너무 가까워지지 않게
+        m_ViewDirty = true;
+        m_ProjectionDirty = m_ProjectionDirty || m_Blend > 0.0f; // 직교 화면 크기는 거리를 따름
+    }
+
+    void EditorCamera::SetView(float yaw, float pitch, bool orthographic)
+    {
+        // Yaw는 회전으로 계속 누적되므로 가까운 쪽으로 돌게 차이를 (-PI, PI]로 줄임
+        const float twoPi = 6.2831853072f;
+        m_FromYaw = m_Yaw;
+        m_FromPitch = m_Pitch;
+        m_ToYaw = m_Yaw + std::remainder(yaw - m_Yaw, twoPi);
+        m_ToPitch = std::min(std::max(pitch, -MaxPitch), MaxPitch);
+        m_AnglesStart = std::chrono::steady_clock::now();
+        m_IsAnimatingAngles = true;
+
+        SetOrthographic(orthographic);
+    }
+
+    void EditorCamera::SetOrthographic(bool orthographic)
+    {
+        if (orthographic == m_Orthographic)
+            return;
+        m_Orthographic = orthographic;
+        m_FromBlend = m_Blend; // 전환 도중에 뒤집혀도 지금 섞인 정도에서 출발
+        m_ProjectionStart = std::chrono::steady_clock::now();
+        m_IsAnimatingProjection = true;
+    }
+
+    void EditorCamera::Recalculate() const
+    {
+        if (!m_ViewDirty && !m_ProjectionDirty)
+            return;
+
+        if (m_ViewDirty)
+        {
+            // 구면 좌표: x = r * sin(yaw) * cos(pitch), y = r * sin(pitch), z = r * cos(yaw) * cos(pitch)
+            float cosPitch = std::cos(m_Pitch);
+            m_Position = m_FocalPoint + m_Distance * glm::vec3(std::sin(m_Yaw) * cosPitch, std::sin(m_Pitch), std::cos(m_Yaw) * cosPitch);
+            m_View = glm::lookAt(m_Position, m_FocalPoint, glm::vec3(0.0f, 1.0f, 0.0f));
+        }
+
+        if (m_ProjectionDirty)
+        {
+            float aspectRatio = m_ViewportWidth / m_ViewportHeight;
+            glm::mat4 perspective = glm::perspective(FieldOfView, aspectRatio, NearClip, FarClip);
+            if (m_Blend <= 0.0f)
+            {
+                m_Projection = perspective;
+            }
+            else
+            {
+                // 직교 화면 높이 = 초점 거리에서 원근 화면이 담는 높이. 초점 평면은 두 투영에서 같은 자리에 찍히므로
+                // 행렬을 섞어도 초점 근처는 그대로, 앞뒤만 원근감이 줄었다 늘었다 함
+                // 근평면은 카메라 뒤까지 (가까이 줌해도 모델이 잘리지 않게)
+                float halfHeight = m_Distance * std::tan(FieldOfView * 0.5f);
+                float halfWidth = halfHeight * aspectRatio;
+                glm::mat4 orthographic = glm::ortho(-halfWidth, halfWidth, -halfHeight, halfHeight, -FarClip, FarClip);
+                m_Projection = m_Blend >= 1.0f ? orthographic : perspective * (1.0f - m_Blend) + orthographic * m_Blend;
+            }
+        }
+
+        m_ViewProjection = m_Projection * m_View;
+        m_InverseViewProjection = glm::inverse(m_ViewProjection);
+        m_Frustum = Frustum::FromMatrix(m_ViewProjection);
+        m_ViewDirty = false;
+        m_ProjectionDirty = false;
+    }
+
+    const glm::mat4& EditorCamera::GetView() const
+    {
+        Recalculate();
+        return m_View;
+    }
+
+    const glm::mat4& EditorCamera::GetProjection() const
+    {
+        Recalculate();
+        return m_Projection;
+    }
+
+    const glm::mat4& EditorCamera::GetViewProjection() const
+    {
+        Recalculate();
+        return m_ViewProjection;
+    }
+
+    const glm::mat4& EditorCamera::GetInverseViewProjection() const
+    {
+        Recalculate();
+        return m_InverseViewProjection;
+    }
+
+    const Frustum& EditorCamera::GetFrustum() const
+    {
+        Recalculate();
+        return m_Frustum;
+    }
+
+    const glm::vec3& EditorCamera::GetPosition() const
+    {
+        Recalculate();
+        return m_Position;
+    }
+
+    glm::vec3 EditorCamera::GetForward() const
+    {
+        return glm::normalize(m_FocalPoint - GetPosition());
+    }
+
+    EditorCamera::Ray EditorCamera::GetRay(const glm::vec2& mousePos) const
+    {
+        float mouseX = (2.0f * mousePos.x) / m_ViewportWidth - 1.0f;
+        float mouseY = 1.0f - (2.0f * mousePos.y) / m_ViewportHeight;
+
+        const glm::mat4& inverseVP = GetInverseViewProjection();
+        glm::vec4 rayStartWorld = inverseVP * glm::vec4(mouseX, mouseY, -1.0f, 1.0f);
+        rayStartWorld /= rayStartWorld.w;
+        glm::vec4 rayEndWorld = inverseVP * glm::vec4(mouseX, mouseY, 1.0f, 1.0f);
+        rayEndWorld /= rayEndWorld.w;
+
+        // 원근이면 모든 광선이 카메라 위치에서 출발, 직교(또는 전환 중)면 근평면 위의 점에서
+        Ray ray;
+        ray.Origin = m_Blend <= 0.0f ? m_Position : glm::vec3(rayStartWorld);
+        ray.Direction = glm::normalize(glm::vec3(rayEndWorld - rayStartWorld));
+        return ray;
+    }
+
+    float EditorCamera::GetPixelsPerUnit(float distance) const
+    {
+        // 화면 높이가 담는 월드 높이: 원근은 거리에 비례, 직교는 초점 거리에서의 값으로 고정
+        float tanHalfFov = std::tan(FieldOfView * 0.5f);
+        float perspectiveHeight = 2.0f * distance * tanHalfFov;
+        float orthographicHeight = 2.0f * m_Distance * tanHalfFov;
+        float worldHeight = perspectiveHeight + (orthographicHeight - perspectiveHeight) * m_Blend;
+        return m_ViewportHeight / std::max(worldHeight, 1e-6f);
+    }
+}
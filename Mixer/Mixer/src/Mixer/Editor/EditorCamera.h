@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Mixer/Mesh/Frustum.h"
+#include <glm/glm.hpp>
+#include <chrono>
+
+namespace Mixer {
+
+    // 초점을 도는 궤도 카메라. 뷰/투영/VP/역VP/절두체/위치를 들고 있다가 값이 바뀐 경우에만 다시 계산
+    // (마우스 광선, 그리드, 컬링이 같은 프레임에 몇 번을 물어봐도 행렬 역변환과 삼각함수는 한 번)
+    class EditorCamera
+    {
+    public:
+        struct Ray
+        {
+            glm::vec3 Origin;    // 직교 투영이면 픽셀마다 다름 (근평면 위의 점)
+            glm::vec3 Direction; // 정규화됨
+        };
+
+        EditorCamera() = default;
+
+        // 프레임마다 한 번: 진행 중인 뷰 전환을 시간만큼 진행
+        void OnUpdate();
+
+        void SetViewportSize(float width, float height);
+
+        // 마우스 조작 (픽셀 단위 델타). 회전은 진행 중인 전환을 멈추고 직교 뷰에서 빠져나옴 (원근으로 부드럽게)
+        void Orbit(const glm::vec2& delta);
+        void Pan(const glm::vec2& delta);
+        void Zoom(float delta);
+
+        // [신규] 숫자 패드 뷰: 각도와 투영을 ViewTransitionSeconds 동안 부드럽게 바꿈
+        void SetView(float yaw, float pitch, bool orthographic);
+        void SetOrthographic(bool orthographic); // 투영만 전환 (각도 유지)
+
+        const glm::mat4& GetView() const;
+        const glm::mat4& GetProjection() const;
+        const glm::mat4& GetViewProjection() const;
+        const glm::mat4& GetInverseViewProjection() const;
+        const Frustum& GetFrustum() const;
+        const glm::vec3& GetPosition() const;
+        glm::vec3 GetForward() const; // 위치 -> 초점 방향
+
+        const glm::vec3& GetFocalPoint() const { return m_FocalPoint; }
+        float GetDistance() const { return m_Distance; }
+        bool IsOrthographic() const { return m_Orthographic; }
+        bool IsPerspective() const { return m_Blend <= 0.0f; } // 직교로 가거나 돌아오는 중이면 false
+
+        // 화면 좌표(픽셀, 좌상단 원점)의 시선 광선
+        Ray GetRay(const glm::vec2& mousePos) const;
+        // 카메라에서 distance만큼 떨어진 곳의 월드 1 단위가 화면에서 차지하는 픽셀 수 (LOD 선택용)
+        float GetPixelsPerUnit(float distance) const;
+
+    private:
+        void Recalculate() const; // 바뀐 쪽(뷰/투영)만 다시 만들고 VP, 역VP, 절두체 갱신
+
+    private:
+        static constexpr float FieldOfView = 0.7853981634f; // 45도
+        static constexpr float NearClip = 0.1f;
+        static constexpr float FarClip = 100.0f;
+        static constexpr float MaxPitch = 1.565f;           // 정확히 90도면 lookAt의 Up 벡터와 겹쳐 뒤집힘
+        static constexpr float ViewTransitionSeconds = 0.25f;
+
+        glm::vec3 m_FocalPoint = { 0.0f, 0.0f, 0.0f }; // 카메라가 바라보는 중심점 (Target)
+        float m_Distance = 5.0f; // 중심점과 카메라 사이의 거리
+        float m_Yaw = 0.0f;      // 좌우 회전 (Y축 기준, 라디안)
+        float m_Pitch = 0.0f;    // 상하 회전 (X축 기준, 라디안)
+        float m_ViewportWidth = 1.0f, m_ViewportHeight = 1.0f;
+
+        // 뷰 전환 (각도와 투영은 따로: 직교 뷰에서 회전하면 각도는 마우스를 따르고 투영만 원근으로 돌아감)
+        bool m_Orthographic = false;  // 목표 투영
+        bool m_IsAnimatingAngles = false;
+        bool m_IsAnimatingProjection = false;
+        float m_FromYaw = 0.0f, m_FromPitch = 0.0f, m_ToYaw = 0.0f, m_ToPitch = 0.0f;
+        float m_FromBlend = 0.0f, m_Blend = 0.0f; // 0 = 원근, 1 = 직교 (전환 중이면 두 투영을 섞음)
+        std::chrono::steady_clock::time_point m_AnglesStart, m_ProjectionStart;
+
+        // 캐시 (const 조회에서 늦게 계산)
+        mutable bool m_ViewDirty = true;
+        mutable bool m_ProjectionDirty = true;
+        mutable glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+        mutable glm::mat4 m_View = glm::mat4(1.0f);
+        mutable glm::mat4 m_Projection = glm::mat4(1.0f);
+        mutable glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+        mutable glm::mat4 m_InverseViewProjection = glm::mat4(1.0f);
+        mutable Frustum m_Frustum;
+    };
+}
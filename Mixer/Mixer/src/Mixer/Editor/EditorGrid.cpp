@@ -1,119 +1,53 @@
 #include "EditorGrid.h"
-#include <iostream>
-#include <glm/gtc/type_ptr.hpp>
+#include "Mixer/Log.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/CommandBucket.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
+#include <algorithm>
+#include <cmath>
 
 namespace Mixer {
 
     void EditorGrid::Init()
     {
-        // 1. ׸  
-        std::vector<float> vertices;
-        float gridSize = 10.0f;
-        float step = 1.0f;
+        // [수정] 셰이더는 assets/shaders/Grid.* (화면 픽셀마다 시선 광선을 y = 0 평면과 교차, 줌과 상관없이 비용 일정)
+        m_Shader = ShaderLibrary::Load("Grid");
 
-        //  (Grid Lines)
-        for (float i = -gridSize; i <= gridSize; i += step)
-        {
-            vertices.push_back(i); vertices.push_back(0.0f); vertices.push_back(-gridSize);
-            vertices.push_back(i); vertices.push_back(0.0f); vertices.push_back(gridSize);
-            vertices.push_back(-gridSize); vertices.push_back(0.0f); vertices.push_back(i);
-            vertices.push_back(gridSize);  vertices.push_back(0.0f); vertices.push_back(i);
-        }
-
-        //  (Axes)
-        // X (Red)
-        vertices.push_back(-gridSize); vertices.push_back(0.0f); vertices.push_back(0.0f);
-        vertices.push_back(gridSize);  vertices.push_back(0.0f); vertices.push_back(0.0f);
-        // Z (Blue)
-        vertices.push_back(0.0f); vertices.push_back(0.0f); vertices.push_back(-gridSize);
-        vertices.push_back(0.0f); vertices.push_back(0.0f); vertices.push_back(gridSize);
-        // Y (Green)
-        vertices.push_back(0.0f); vertices.push_back(-gridSize); vertices.push_back(0.0f);
-        vertices.push_back(0.0f); vertices.push_back(gridSize);  vertices.push_back(0.0f);
-
-        m_VertexCount = vertices.size() / 3;
-
-        // 2. OpenGL 
-        glGenVertexArrays(1, &m_VAO);
-        glBindVertexArray(m_VAO);
-
-        glGenBuffers(1, &m_VBO);
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-
-        // 3. ׸  ̴ ( )
-        const char* vsSrc = R"(#version 330 core
-layout(location = 0) in vec3 a_Pos;
-uniform mat4 u_ViewProjection;
-void main() {
-    gl_Position = u_ViewProjection * vec4(a_Pos, 1.0);
-})";
-        const char* fsSrc = R"(#version 330 core
-layout(location = 0) out vec4 FragColor;
-uniform vec4 u_Color;
-void main() {
-    FragColor = u_Color;
-})";
-
-        // ̴  (ȭ)
-        GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vs, 1, &vsSrc, nullptr);
-        glCompileShader(vs);
-        GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fs, 1, &fsSrc, nullptr);
-        glCompileShader(fs);
-
-        m_Shader = glCreateProgram();
-        glAttachShader(m_Shader, vs);
-        glAttachShader(m_Shader, fs);
-        glLinkProgram(m_Shader);
-
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        // [수정] 정점 버퍼 없이 화면 전체 삼각형 하나 (gl_VertexID로 생성). 코어 프로파일이라 빈 VAO는 필요
+        RenderThread::ExecuteNow([this] { glGenVertexArrays(1, &m_VAO); });
     }
 
-    void EditorGrid::Render(const glm::mat4& viewProjection)
+    void EditorGrid::Render(const EditorCamera& camera)
     {
-        glUseProgram(m_Shader);
-        glUniformMatrix4fv(glGetUniformLocation(m_Shader, "u_ViewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
-        glBindVertexArray(m_VAO);
-
-        // 1.  (ȸ)
-        glLineWidth(1.0f);
-        glUniform4f(glGetUniformLocation(m_Shader, "u_Color"), 0.4f, 0.4f, 0.4f, 1.0f);
-        int gridLinesCount = m_VertexCount - 6;
-        glDrawArrays(GL_LINES, 0, gridLinesCount);
-
-        // [ٽ]  ׽Ʈ  ,    
-        glDisable(GL_DEPTH_TEST);
-
-        //    β ׸
-        glLineWidth(2.0f);
-
-        // X (Red)
-        glUniform4f(glGetUniformLocation(m_Shader, "u_Color"), 1.0f, 0.0f, 0.0f, 1.0f);
-        glDrawArrays(GL_LINES, gridLinesCount, 2);
-
-        // Z (Blue)
-        glUniform4f(glGetUniformLocation(m_Shader, "u_Color"), 0.0f, 0.0f, 1.0f, 1.0f);
-        glDrawArrays(GL_LINES, gridLinesCount + 2, 2);
-
-        // Y (Green)
-        glUniform4f(glGetUniformLocation(m_Shader, "u_Color"), 0.0f, 1.0f, 0.0f, 1.0f);
-        glDrawArrays(GL_LINES, gridLinesCount + 4, 2);
-
-        // [] ٽ   ü()  ׷
-        glEnable(GL_DEPTH_TEST);
-        glLineWidth(1.0f); // β 󺹱
+        float cameraDistance = camera.GetDistance();
+
+        // [수정] 카메라 거리로 간격 결정: 10의 거듭제곱 단위, 소수부만큼 촘촘한 단계를 흐리게 (화면상 밀도 일정)
+        // 기본 거리(5)에서 1칸 = 1
+        float level = std::log10(std::max(cameraDistance, 0.001f)) - 0.5f;
+        float spacing = std::pow(10.0f, std::floor(level));
+        float levelBlend = level - std::floor(level);
+        float fadeDistance = std::min(cameraDistance * 10.0f, 90.0f); // 투영 far(100) 안에서 사라지게
+
+        // [수정] 그리기 한 번. 불투명 물체 뒤에 블렌딩으로 덮음 (물체 아래쪽도 격자가 비쳐 보임)
+        DrawPacket packet;
+        packet.Program = ShaderLibrary::GetProgram(m_Shader);
+        packet.VertexArray = m_VAO;
+        packet.State = RenderStateDepthTest | RenderStateBlend | RenderStateNoDepthWrite;
+        packet.Count = 3;
+        CommandBucket::Add(SortKey::Make(RenderPass::Grid, packet.Program, packet.State), packet, {
+            { "u_ViewProjection", camera.GetViewProjection() },
+            { "u_InverseViewProjection", camera.GetInverseViewProjection() }, // [수정] 카메라가 캐시한 역행렬
+            { "u_CameraPosition", camera.GetPosition() },
+            { "u_Spacing", spacing },
+            { "u_LevelBlend", levelBlend },
+            { "u_FadeDistance", fadeDistance }
+        });
     }
 
     void EditorGrid::Shutdown()
     {
-        glDeleteVertexArrays(1, &m_VAO);
-        glDeleteBuffers(1, &m_VBO);
-        glDeleteProgram(m_Shader);
+        GLuint vao = m_VAO;
+        RenderThread::Submit([vao] { glDeleteVertexArrays(1, &vao); });
+        ShaderLibrary::Release(m_Shader);
     }
 }
\ No newline at end of file
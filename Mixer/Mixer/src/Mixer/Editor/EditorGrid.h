@@ -1,8 +1,9 @@
 #pragma once
 
+#include "EditorCamera.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
 #include <glad/glad.h>
 #include <glm/glm.hpp>
-#include <vector>
 
 namespace Mixer {
 
@@ -12,14 +13,12 @@ namespace Mixer {
         EditorGrid() = default;
         ~EditorGrid() = default;
 
-        void Init();  // VAO, VBO, Shader 
-        void Render(const glm::mat4& viewProjection); // ׸
-        void Shutdown(); // ڿ 
+        void Init();  // 빈 VAO, Shader 생성
+        void Render(const EditorCamera& camera); // 그리기 (카메라 거리로 간격 자동)
+        void Shutdown(); // 자원 해제
 
     private:
-        GLuint m_VAO = 0;
-        GLuint m_VBO = 0;
-        GLuint m_Shader = 0; // ׸  ̴
-        int m_VertexCount = 0;
+        GLuint m_VAO = 0;    // 속성 없음 (정점은 셰이더가 만듦)
+        ShaderHandle m_Shader; // 그리드 전용 셰이더 (화면 공간 무한 격자)
     };
 }
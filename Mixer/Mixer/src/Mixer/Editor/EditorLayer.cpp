@@ -3,36 +3,57 @@
 #include <unordered_map>
 #include <set>
 #include <algorithm> // std::min, std::max
+#include <cfloat>
+#include <cmath>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "Mixer/Events/MouseEvent.h"
 #include "Mixer/Events/ApplicationEvent.h"
 #include "Mixer/Events/KeyEvent.h"
 #include "Mixer/Application.h"
+#include "Mixer/Mesh/MeshOptimizer.h"
+#include "Mixer/Mesh/MeshExporter.h"
+#include "Mixer/Mesh/Triangulator.h"
+#include "Mixer/JobSystem.h"
+#include "Mixer/FrameAllocator.h"
+#include "Mixer/Paths.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
+#include "GpuBuffer.h"
 
 namespace Mixer {
 
+    // [추가] LOD / 점 표시 기준
+    static constexpr size_t LODMinTriangles = 20000;        // 이보다 작은 메쉬는 LOD 생성 안 함
+    static constexpr float LODPixelThreshold = 1.0f;        // 허용 화면 오차 (픽셀)
+    static constexpr float LODFadeSeconds = 0.3f;           // 단계 전환 시간
+    static constexpr float VertexPointMinPixelArea = 256.0f; // 점 하나당 화면 면적이 이보다 작으면 점 숨김 (16x16)
+    static constexpr size_t MeshletMinTriangles = 20000;    // 이보다 작은 메쉬는 통째로 그림
+    static constexpr int ScatterGridSize = 100;             // Ctrl+Shift+A 배치 크기 (100x100)
+    static constexpr float SymmetryRelativeTolerance = 1e-4f; // 대칭 짝 허용 오차 (메쉬 대각선 길이 대비)
+    static constexpr uint32_t TranslationJobGroupSize = 8192;
+
     EditorLayer::EditorLayer() : Layer("EditorLayer") {}
 
     // -------------------------------------------------------------------------
-    // [1] ֱ (Lifecycle)
+    // [1] 생명주기 (Lifecycle)
     // -------------------------------------------------------------------------
     void EditorLayer::OnAttach()
     {
-        // 1.  ʱȭ (簢:  4)
+        // 1. 데이터 초기화 (사각형: 점 4개)
         m_Vertices = {
-            { -0.5f, -0.5f, 0.5f }, // 0: 
-            {  0.5f, -0.5f, 0.5f }, // 1: 
-            {  0.5f,  0.5f, 0.5f }, // 2: 
-            { -0.5f,  0.5f, 0.5f }, // 3: »
-            { -0.5f, -0.5f, -0.5f }, // 4: 
-            {  0.5f, -0.5f, -0.5f }, // 5: 
-            {  0.5f,  0.5f, -0.5f }, // 6: 
-            { -0.5f,  0.5f, -0.5f }  // 7: »
+            { -0.5f, -0.5f, 0.5f }, // 0: 좌하
+            {  0.5f, -0.5f, 0.5f }, // 1: 우하
+            {  0.5f,  0.5f, 0.5f }, // 2: 우상
+            { -0.5f,  0.5f, 0.5f }, // 3: 좌상
+            { -0.5f, -0.5f, -0.5f }, // 4: 좌하
+            {  0.5f, -0.5f, -0.5f }, // 5: 우하
+            {  0.5f,  0.5f, -0.5f }, // 6: 우상
+            { -0.5f,  0.5f, -0.5f }  // 7: 좌상
         };
 
-        // [߿ ] GL_LINES( 2) ƴ϶ GL_TRIANGLES( 3) ε 
-        // 簢 ﰢ 2 ˴ϴ (0-1-2, 2-3-0)
+        // [중요 변경] GL_LINES용(점 2개)이 아니라 GL_TRIANGLES용(점 3개) 인덱스로 변경
+        // 사각형은 삼각형 2개로 구성됩니다 (0-1-2, 2-3-0)
         m_Indices = {
             0, 1, 2,
             2, 3, 0,
@@ -48,255 +69,297 @@ namespace Mixer {
             3, 6, 7
         };
 
-        glGenBuffers(1, &m_EdgeIndexBuffer);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EdgeIndexBuffer);
+        // [수정] 셰이더는 assets/shaders 파일에서 (파일이 바뀌면 다시 컴파일해서 교체)
+        m_Shader = ShaderLibrary::Load("Mesh");
+
+        // [수정] GL 자원은 렌더 스레드에서 생성 (이름이 바로 필요하므로 끝날 때까지 대기)
+        RenderThread::ExecuteNow([this]
+        {
+            glGenBuffers(1, &m_EdgeIndexBuffer);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EdgeIndexBuffer);
 
-        // 2. ׷ ڿ  (Լ и)
-        CreateGraphicsPipeline();
+            // 2. 그래픽 자원 생성 (함수 분리)
+            CreateGraphicsPipeline();
+        });
 
-        // [] ׸ ʱȭ
+        // [수정] 그리드 초기화
         m_GridSystem.Init();
+        // [수정] 씬 렌더러 셰이더는 첫 오브젝트가 생길 때 (SceneRenderer::Render)
     }
 
     void EditorLayer::OnDetach()
     {
-        glDeleteVertexArrays(1, &m_VertexArray);
-        glDeleteBuffers(1, &m_VertexBuffer);
-        glDeleteBuffers(1, &m_IndexBuffer);
-        glDeleteProgram(m_ShaderProgram);
-        // [] ׸ 
+        // [수정] 삭제는 렌더 스레드로 (앞서 제출한 그리기 뒤에 실행, 레이어는 그 전에 사라지므로 이름만 복사)
+        GLuint vertexArrays[] = { m_VertexArray, m_SubdivVertexArray, m_ModifierVertexArray };
+        GLuint buffers[] = { m_VertexBuffer, m_IndexBuffer, m_EdgeIndexBuffer, m_NormalBuffer, m_SubdivVertexBuffer, m_SubdivIndexBuffer,
+            m_ModifierVertexBuffer, m_ModifierIndexBuffer, m_MeshletIndexBuffer, m_IndirectBuffer };
+        RenderThread::Submit([vertexArrays, buffers]
+        {
+            glDeleteVertexArrays(3, vertexArrays);
+            GpuDeleteBuffers(10, buffers);
+        });
+        ShaderLibrary::Release(m_Shader);
+        ReleaseLODBuffers();
+        // [수정] 그리드 해제
         m_GridSystem.Shutdown();
+        m_SceneRenderer.Shutdown();
     }
 
     void EditorLayer::OnUpdate()
     {
+        // [추가] 편집/세분화/LOD 등 이 레이어의 할당은 메쉬 메모리로 집계 (업로드용 복사본은 아래에서 따로)
+        MemoryTagScope memoryTag(MemoryTag::Mesh);
         auto& window = Application::Get().GetWindow();
         float width = (float)window.GetWidth();
         float height = (float)window.GetHeight();
         if (width == 0 || height == 0) return;
 
-        // 1. غ
-        // []  ׽Ʈ Ȱȭ! (  ̸ ڿ ִ  ϴ)
-        glEnable(GL_DEPTH_TEST);
+        // 1. 준비
+        // [수정] GL 호출은 렌더 스레드에서 다음 프레임 갱신과 겹쳐서 실행됨 (값만 캡처)
+        RenderThread::Submit([]
+        {
+            // [수정] 깊이 테스트 활성화! (이 한 줄이면 뒤에 있는 점들이 가려집니다)
+            glEnable(GL_DEPTH_TEST);
 
-        glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        });
 
         if (!m_IsTranslationMode)
         {
             UpdateCameraControl();
         }
 
-        UpdateCamera(width, height); //  
-        // []  ȣ (ī޶ ĸ Ѱָ ˾Ƽ ׸)
-        m_GridSystem.Render(m_ViewProjection);
-        HandleInteraction();         // 𵨸 
-        RenderScene();               // 
+        // [수정] 뷰 전환 진행 + 뷰포트 크기. 행렬은 바뀐 경우에만 카메라가 다시 계산
+        m_Camera.SetViewportSize(width, height);
+        m_Camera.OnUpdate();
+        // [수정] 렌더링 호출 (카메라만 넘겨주면 알아서 그림)
+        m_GridSystem.Render(m_Camera);
+        HandleInteraction();         // 모델링 로직
+        PollSimplify();              // [추가] 백그라운드 단순화 결과 확인
+        m_Scene.Update();            // [추가] 움직인 오브젝트만 트랜스폼/TLAS 갱신
+        m_SceneRenderer.Render(m_Scene, m_Camera.GetViewProjection(), -m_Camera.GetForward());
+        RenderScene();               // 렌더링
     }
 
     // -------------------------------------------------------------------------
-    // [2] ٽ  и (Logic Separation)
+    // [2] 핵심 로직 분리 (Logic Separation)
     // -------------------------------------------------------------------------
 
-    void EditorLayer::UpdateCamera(float width, float height)
-    {
-        float aspectRatio = width / height;
-        glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspectRatio, 0.1f, 100.0f);
-
-        // []  ǥ  ̿ ī޶ ġ(Position) 
-        // x = r * sin(yaw) * cos(pitch)
-        // y = r * sin(pitch)
-        // z = r * cos(yaw) * cos(pitch)
-
-        // Pitch  ( ʹ   )
-        if (m_CameraPitch > 1.565f) m_CameraPitch = 1.565f;
-        if (m_CameraPitch < -1.565f) m_CameraPitch = -1.565f;
-
-        // []  Լ 
-        glm::vec3 position = GetCameraPosition();
-
-        // LookAt(ī޶ġ, ٶ󺸴, ʹ)
-        glm::mat4 view = glm::lookAt(position, m_CameraFocalPoint, glm::vec3(0.0f, 1.0f, 0.0f));
-
-        m_ViewProjection = projection * view;
-    }
-
     void EditorLayer::HandleInteraction()
     {
-        // 1.  ī޶ ġ  (UpdateCamera  )
-        // []  Լ   
-        glm::vec3 cameraPos = GetCameraPosition();
-        // 2. ī޶ ٶ󺸴  (Forward Vector) 
-        // []  Normal (ī޶ ġ - Ÿ ġ)  (ī޶  ٶ󺸰)
-        glm::vec3 planeNormal = glm::normalize(cameraPos - m_CameraFocalPoint);
-        glm::vec3 rayDir = GetRayFromMouse();
-        glm::vec3 rayOrigin = cameraPos;
+        // 1. 마우스 광선 (카메라가 캐시한 역VP 사용. 직교 뷰면 출발점이 픽셀마다 다름)
+        EditorCamera::Ray ray = m_Camera.GetRay(m_MousePos);
+        // 2. 카메라가 바라보는 방향 (Forward Vector) 계산
+        // [수정] 평면의 Normal은 (카메라 위치 - 타겟 위치) 방향 (카메라가 평면을 바라보게)
+        glm::vec3 planeNormal = -m_Camera.GetForward();
+        glm::vec3 rayDir = ray.Direction;
+        glm::vec3 rayOrigin = ray.Origin;
 
         if (m_IsTranslationMode && !m_SelectedIndices.empty())
         {
-            //   'ù ° õ   ġ' ϴ. (  )
-            // (: m_MultiVertexStartPositions[0]  empty üũ ʼ)
+            // 평면의 기준점은 '첫 번째 선택된 점의 원래 위치'로 잡습니다. (누구를 잡든 상관없음)
+            // (주의: m_MultiVertexStartPositions[0]이 안전한지 empty 체크 필수)
             glm::vec3 planePoint = m_MultiVertexStartPositions[0];
-            // [ٽ ] planeNormal  (0,0,1) -> ī޶  !
-            // ̷ ϸ ī޶    ׻ "ī޶  â"  Դϴ.
+            // [핵심 수정] planeNormal을 고정값 (0,0,1)에서 -> 카메라 방향으로 변경!
+            // 이렇게 하면 카메라가 어디를 보든 정점은 항상 "카메라 앞 유리창" 위에서 움직입니다.
 
             float t = 0.0f;
 
-            //   
+            // 평면 교차 계산
             if (CalculatePlaneIntersection(rayOrigin, rayDir, planePoint, planeNormal, t))
             {
                 glm::vec3 currentMousePoint = rayOrigin + (rayDir * t);
 
-                // [߰ ]    ù ̶? ->  ġ  ´!
+                // [추가된 로직] 모드 진입 후 첫 프레임이라면? -> 지금 위치를 기준점으로 삼는다!
                 if (!m_TranslationInit)
                 {
                     m_MouseStartDragPoint = currentMousePoint;
-                    m_TranslationInit = true; // ʱȭ Ϸ
+                    m_TranslationInit = true; // 초기화 완료
                 }
 
-                // Ÿ   ġ 
+                // 델타 계산 및 위치 적용
                 glm::vec3 delta = currentMousePoint - m_MouseStartDragPoint;
-                // [] õ   Ÿ 
-                for (size_t i = 0; i < m_SelectedIndices.size(); i++)
-                {
-                    int idx = m_SelectedIndices[i];
-                    //   ' ġ' + Ÿ
-                    m_Vertices[idx] = m_MultiVertexStartPositions[i] + delta;
-                }
+                m_LastTranslationDelta = delta;
+                ApplyVertexTranslation(delta); // [수정] 선택 + 대칭 + 비례 편집 정점을 한 루프에서
             }
         }
+        else if (m_IsTranslationMode && m_SelectedObject != NullEntity)
+        {
+            // [추가] 선택된 점이 없으면 오브젝트를 이동
+            TranslateSelectedObject(rayOrigin, rayDir, planeNormal);
+        }
         else
         {
-            // [Ϲ ] Hover 
-            m_HoveredIndex = -1;
-            float minDistance = 1000.0f;
-
-            for (int i = 0; i < m_Vertices.size(); i++)
-            {
-                // Ÿ 굵 ī޶ ġ  ؾ Ȯ
-                float dist = glm::length(glm::cross(m_Vertices[i] - rayOrigin, rayDir));
-                if (dist < 0.3f && dist < minDistance)
-                {
-                    minDistance = dist;
-                    m_HoveredIndex = i;
-                }
-            }
+            // [일반 모드] Hover 감지
+            // [수정] 광선과 가장 가까운 점 (0.3 미만)을 SoA 사본에서 SIMD로 찾음
+            // 거리 계산도 카메라 위치 기준으로 해야 정확함
+            SyncPositionStore();
+            float minDistance = 0.0f;
+            m_HoveredIndex = PositionKernels::NearestToRay(m_PositionStore, rayOrigin, rayDir, 0.3f, minDistance);
         }
     }
 
     void EditorLayer::RenderScene()
     {
-        // 1. GPU  Ʈ
-        // VBO Ʈ
-        glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, m_Vertices.size() * sizeof(glm::vec3), m_Vertices.data(), GL_DYNAMIC_DRAW);
-
-        // IBO Ʈ
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Indices.size() * sizeof(uint32_t), m_Indices.data(), GL_DYNAMIC_DRAW);
-
-        // [߰] Edge IBO Ʈ
-        if (!m_EdgeIndices.empty())
+        // 1. GPU 버퍼 업데이트
+        // [수정] 바뀐 경우에만 올림 (토폴로지: 재할당 + IBO, 위치만: VBO 덮어쓰기 + 바뀐 법선 구간)
+        bool topologyChanged = m_UploadedTopologyVersion != m_TopologyVersion;
+        bool positionChanged = m_UploadedPositionVersion != m_PositionVersion;
+        m_UploadedTopologyVersion = m_TopologyVersion;
+        m_UploadedPositionVersion = m_PositionVersion;
+
+        // VBO 업데이트
+        if (topologyChanged)
+            SubmitBufferData(GL_ARRAY_BUFFER, m_VertexBuffer, m_Vertices.size() * sizeof(glm::vec3), m_Vertices.data(), GL_DYNAMIC_DRAW);
+        else if (positionChanged)
+            SubmitBufferSubData(GL_ARRAY_BUFFER, m_VertexBuffer, 0, m_Vertices.size() * sizeof(glm::vec3), m_Vertices.data());
+
+        // [추가] 법선 갱신 (dirty 정점 주변만) 후 업로드
+        m_Normals.Update(m_Vertices, m_Indices);
+        const auto& normals = m_Normals.GetVertexNormals();
+        if (topologyChanged)
         {
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EdgeIndexBuffer);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_EdgeIndices.size() * sizeof(uint32_t), m_EdgeIndices.data(), GL_DYNAMIC_DRAW);
+            SubmitBufferData(GL_ARRAY_BUFFER, m_NormalBuffer, normals.size() * sizeof(glm::vec3), normals.data(), GL_DYNAMIC_DRAW);
+        }
+        else
+        {
+            for (const MeshNormals::Range& range : m_Normals.GetChangedRanges())
+                SubmitBufferSubData(GL_ARRAY_BUFFER, m_NormalBuffer, range.First * sizeof(glm::vec3), range.Count * sizeof(glm::vec3), &normals[range.First]);
         }
 
-        // 2. ̴ 
-        glUseProgram(m_ShaderProgram);
-        glUniformMatrix4fv(glGetUniformLocation(m_ShaderProgram, "u_ViewProjection"), 1, GL_FALSE, glm::value_ptr(m_ViewProjection));
-        glBindVertexArray(m_VertexArray);
-
-        // ---------------------------------------------------------------------
-        // [PASS 1] (Face) ׸ (Solid)
-        // ---------------------------------------------------------------------
+        if (topologyChanged)
+        {
+            // [추가] 정점 수에 따라 인덱스 타입 결정 (16비트면 대역폭 절반)
+            m_IndexType = MeshOptimizer::CanUse16BitIndices(m_Vertices.size()) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
-        // [ٽ ] ׸  "  ۸  ž!" VAO ٽ ˷ 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+            // IBO 업데이트
+            UploadIndexBuffer(m_IndexBuffer, m_Indices);
 
-        //  ä  
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            // [추가] Edge IBO 업데이트
+            if (!m_EdgeIndices.empty())
+            {
+                UploadIndexBuffer(m_EdgeIndexBuffer, m_EdgeIndices);
+            }
+        }
 
-        //   (ణ ο ȸ) - Blender ⺻ 
-        glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 0.5f, 0.5f, 0.5f, 1.0f);
+        // [추가] 세분화 곡면 갱신 (바뀐 게 없으면 아무것도 안 함)
+        UpdateSubdivision();
+        bool drawSubdivision = m_Subdivision.GetLevel() > 0 && m_Subdivision.IsValid(m_Vertices.size());
 
-        // [߿] Polygon Offset Enable
-        //  ׸    ¦ ڷ оݴϴ. ׷ ߿ ׸ (Wireframe)  ʽϴ.
-        glEnable(GL_POLYGON_OFFSET_FILL);
-        glPolygonOffset(1.0f, 1.0f);
+        // [추가] 모디파이어 결과 갱신 (있으면 세분화 미리보기 대신 그림)
+        UpdateModifiers();
+        bool drawModifiers = !m_Modifiers.IsEmpty();
 
-        glDrawElements(GL_TRIANGLES, m_Indices.size(), GL_UNSIGNED_INT, nullptr);
+        // [추가] LOD 단계 선택 (버퍼 업로드 포함) + 메쉬렛 컬링
+        UpdateLOD();
+        UpdateMeshlets();
 
-        glDisable(GL_POLYGON_OFFSET_FILL); // 
+        // 2. 그리기 패킷 제출
+        // [수정] 패스 -> 셰이더 -> 상태 -> 깊이 순 정렬 키로 CommandBucket에 넣으면 모든 레이어 것을 모아 한 번에 그림
+        // 패킷은 앞 패킷의 상태/유니폼을 물려받지 않으므로 필요한 것을 전부 실음 (AddMeshPacket)
+        uint32_t depth = SortKey::Depth(glm::length(m_Camera.GetPosition() - m_BoundsCenter));
+        uint32_t cullState = m_IsBackfaceCulling ? RenderStateCullBack : RenderStateNone; // [추가] 뒷면 제거 (B키). 면 + 와이어프레임에만
 
         // ---------------------------------------------------------------------
-        // [PASS 2] ̾(Edge) ׸ (Lines)
+        // [PASS 1] 면(Face) 그리기 (Solid)
         // ---------------------------------------------------------------------
+        // [중요] Polygon Offset: 면의 깊이 값을 살짝 뒤로 밀어줍니다. 그래야 와이어프레임이 묻히지 않습니다.
+        // 면 색상 (약간 어두운 회색) - Blender 기본 느낌
+        MeshDraw faces = { RenderPass::Opaque, RenderStateDepthTest | RenderStatePolygonOffset | cullState, depth, glm::vec4(0.5f, 0.5f, 0.5f, 1.0f), m_IsLitShading ? 1 : 0 };
+        if (drawModifiers || drawSubdivision)
+        {
+            // [추가] 모디파이어 결과 / 세분화 곡면을 케이지 대신 채움 (법선은 화면 미분으로 면 단위 계산 -> 법선 버퍼 불필요)
+            DrawPacket surface;
+            surface.VertexArray = drawModifiers ? m_ModifierVertexArray : m_SubdivVertexArray;
+            surface.IndexBuffer = drawModifiers ? m_ModifierIndexBuffer : m_SubdivIndexBuffer;
+            surface.Mode = DrawMode::Elements;
+            surface.Count = drawModifiers ? (GLsizei)m_Modifiers.GetResult().Indices.size() : (GLsizei)m_Subdivision.GetTriangles().size();
+            faces.Lit = m_IsLitShading ? 2 : 0;
+            AddMeshPacket(faces, surface);
+        }
+        else
+        {
+            DrawMeshTriangles(faces); // [수정] 거리에 따라 LOD 단계로
+        }
 
-        // A.  ׵θ (Triangles -> Lines)
-        // [ٽ ] ⵵  ε (̹  Ǿ ϰ)
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
-
-        //  ׸  
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-        glLineWidth(2.0f); //  β
-
-        //   ( Ȥ  )
-        glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 0.0f, 0.0f, 0.0f, 1.0f); //  ׵θ
+        // ---------------------------------------------------------------------
+        // [PASS 2] 와이어프레임(Edge) 그리기 (Lines) - 조명 없이 검은색, 두께 2
+        // ---------------------------------------------------------------------
+        MeshDraw edges = { RenderPass::Wireframe, RenderStateDepthTest | RenderStateWireframe | RenderStateWideLines | cullState, depth, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), 0 };
 
-        glDrawElements(GL_TRIANGLES, m_Indices.size(), GL_UNSIGNED_INT, nullptr);
+        // A. 면의 테두리 (Triangles -> Lines)
+        DrawMeshTriangles(edges); // [수정] 와이어프레임도 같은 LOD 단계로
 
-        // B. [߰]  (Isolated Lines) ׸
+        // B. [추가] 고립된 선(Isolated Lines) 그리기 - GL_LINES 모드로 그립니다 (점 2개씩 끊어서 그림)
         if (!m_EdgeIndices.empty())
         {
-            // [ٽ ]  "  ۸  ž!" ü
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EdgeIndexBuffer);
-
-            // GL_LINES  ׸ϴ ( 2  ׸)
-            glDrawElements(GL_LINES, m_EdgeIndices.size(), GL_UNSIGNED_INT, nullptr);
+            DrawPacket isolated;
+            isolated.VertexArray = m_VertexArray;
+            isolated.IndexBuffer = m_EdgeIndexBuffer;
+            isolated.Mode = DrawMode::Elements;
+            isolated.Primitive = GL_LINES;
+            isolated.IndexType = m_IndexType;
+            isolated.Count = (GLsizei)m_EdgeIndices.size();
+            AddMeshPacket(edges, isolated);
         }
 
-        // ٽ  
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-
         // ---------------------------------------------------------------------
-        // [PASS 3] (Vertex) ׸ ( )
+        // [PASS 3] 점(Vertex) 그리기
         // ---------------------------------------------------------------------
-        glEnable(GL_PROGRAM_POINT_SIZE);
+        // [수정] 기본 점은 한 번에 그리고, 특별한 점만 위에 덧그림 (Highlight 패스, 같은 깊이에 덧그리기)
+        DrawPacket points;
+        points.VertexArray = m_VertexArray;
+        points.Primitive = GL_POINTS;
 
-        for (int i = 0; i < m_Vertices.size(); i++)
+        if (m_ShowAllVertexPoints && !m_Vertices.empty()) // 화면에 너무 빽빽하면 기본 점은 생략 (UpdateLOD에서 판단)
         {
-            // []  (i) õ Ʈ ִ Ȯ
-            bool isSelected = false;
-            for (int selectedIdx : m_SelectedIndices) {
-                if (selectedIdx == i) {
-                    isSelected = true;
-                    break;
-                }
-            }
+            points.Count = (GLsizei)m_Vertices.size();
+            AddMeshPacket({ RenderPass::Points, RenderStateDepthTest | RenderStateProgramPointSize, depth, glm::vec4(1.0f, 0.5f, 0.0f, 1.0f), 0 }, points); // 기본: 주황
+        }
 
-            if (isSelected)
-            {
-                if (m_IsTranslationMode)
-                    glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 1.0f, 1.0f, 1.0f, 1.0f); // ̵ : 
-                else
-                    glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 0.0f, 0.5f, 1.0f, 1.0f); // õ: Ķ
-            }
-            else if (i == m_HoveredIndex)
-            {
-                glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 0.0f, 1.0f, 0.0f, 1.0f); // Hover: 
-            }
-            else
-            {
-                glUniform4f(glGetUniformLocation(m_ShaderProgram, "u_Color"), 1.0f, 0.5f, 0.0f, 1.0f); // ⺻: Ȳ
-            }
+        MeshDraw highlight = { RenderPass::Highlight, RenderStateDepthTest | RenderStateDepthLessEqual | RenderStateProgramPointSize, depth, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), 0 }; // Hover: 녹색
+        if (m_HoveredIndex != -1)
+        {
+            points.First = m_HoveredIndex;
+            points.Count = 1;
+            AddMeshPacket(highlight, points);
+        }
 
-            glDrawArrays(GL_POINTS, i, 1);
+        // [수정] 선택된 점은 점마다 Draw Call 대신 glMultiDrawArrays 한 번 (같은 키라 Hover 점 위에 그려짐)
+        if (!m_SelectedIndices.empty())
+        {
+            GLsizei selectedCount = (GLsizei)m_SelectedIndices.size();
+            GLsizei* counts = static_cast<GLsizei*>(RenderThread::AllocateCommandData(selectedCount * sizeof(GLsizei), alignof(GLsizei)));
+            std::fill(counts, counts + selectedCount, 1);
+
+            points.Mode = DrawMode::MultiArrays;
+            points.MultiFirst = RenderThread::CopyCommandData(m_SelectedIndices.data(), m_SelectedIndices.size());
+            points.MultiCount = counts;
+            points.MultiDrawCount = selectedCount;
+            highlight.Color = m_IsTranslationMode ? glm::vec4(1.0f, 1.0f, 1.0f, 1.0f) : glm::vec4(0.0f, 0.5f, 1.0f, 1.0f); // 이동 중: 흰색, 선택됨: 파랑
+            AddMeshPacket(highlight, points);
         }
     }
 
+    // [추가] 편집 메쉬 셰이더가 읽는 유니폼을 전부 실어서 제출 (디더는 LOD 전환 중에만)
+    void EditorLayer::AddMeshPacket(const MeshDraw& draw, DrawPacket packet, float ditherFade, int ditherInvert)
+    {
+        packet.Program = ShaderLibrary::GetProgram(m_Shader); // [수정] 다시 컴파일되면 바뀜
+        packet.State = draw.State;
+        const UniformValue uniforms[] = {
+            { "u_ViewProjection", m_Camera.GetViewProjection() },
+            { "u_Color", draw.Color },
+            { "u_Lit", draw.Lit },
+            { "u_LightDir", -m_Camera.GetForward() }, // [추가] 조명 모드: 카메라 방향에서 비추는 헤드라이트
+            { "u_DitherFade", ditherFade },
+            { "u_DitherInvert", ditherInvert }
+        };
+        CommandBucket::Add(SortKey::Make(draw.Pass, packet.Program, packet.State, draw.Depth), packet, uniforms, sizeof(uniforms) / sizeof(uniforms[0]));
+    }
+
     // -------------------------------------------------------------------------
-    // [3] ʱȭ  (Initialization Helpers)
+    // [3] 초기화 헬퍼 (Initialization Helpers)
     // -------------------------------------------------------------------------
     void EditorLayer::CreateGraphicsPipeline()
     {
@@ -307,199 +370,231 @@ namespace Mixer {
         // VBO
         glGenBuffers(1, &m_VertexBuffer);
         glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, m_Vertices.size() * sizeof(glm::vec3), m_Vertices.data(), GL_DYNAMIC_DRAW);
+        GpuBufferData(GL_ARRAY_BUFFER, m_VertexBuffer, m_Vertices.size() * sizeof(glm::vec3), m_Vertices.data(), GL_DYNAMIC_DRAW);
 
         glEnableVertexAttribArray(0);
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
 
+        // [추가] Normal VBO (location = 1)
+        glGenBuffers(1, &m_NormalBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_NormalBuffer);
+        GpuBufferData(GL_ARRAY_BUFFER, m_NormalBuffer, 0, nullptr, GL_DYNAMIC_DRAW);
+
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
         // IBO
         glGenBuffers(1, &m_IndexBuffer);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Indices.size() * sizeof(uint32_t), m_Indices.data(), GL_DYNAMIC_DRAW);
+        GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer, m_Indices.size() * sizeof(uint32_t), m_Indices.data(), GL_DYNAMIC_DRAW);
+
+        // [추가] 메쉬렛 순서로 재배열한 IBO + 간접 그리기 명령 버퍼
+        glGenBuffers(1, &m_MeshletIndexBuffer);
+        glGenBuffers(1, &m_IndirectBuffer);
 
-        // Shaders
-        GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-        const char* vsSrc = GetVertexShaderSource();
-        glShaderSource(vs, 1, &vsSrc, nullptr);
-        glCompileShader(vs);
-        CheckShaderError(vs, "VERTEX");
+        // [추가] 세분화 곡면용 VAO (위치 + 32비트 IBO, 법선 속성은 사용 안 함)
+        glGenVertexArrays(1, &m_SubdivVertexArray);
+        glBindVertexArray(m_SubdivVertexArray);
 
-        GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-        const char* fsSrc = GetFragmentShaderSource();
-        glShaderSource(fs, 1, &fsSrc, nullptr);
-        glCompileShader(fs);
-        CheckShaderError(fs, "FRAGMENT");
+        glGenBuffers(1, &m_SubdivVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_SubdivVertexBuffer);
+        GpuBufferData(GL_ARRAY_BUFFER, m_SubdivVertexBuffer, 0, nullptr, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
 
-        m_ShaderProgram = glCreateProgram();
-        glAttachShader(m_ShaderProgram, vs);
-        glAttachShader(m_ShaderProgram, fs);
-        glLinkProgram(m_ShaderProgram);
-        CheckProgramError(m_ShaderProgram);
+        glGenBuffers(1, &m_SubdivIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_SubdivIndexBuffer);
+        GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, m_SubdivIndexBuffer, 0, nullptr, GL_DYNAMIC_DRAW);
 
-        glDeleteShader(vs);
-        glDeleteShader(fs);
-    }
+        // [추가] 모디파이어 결과용 VAO (세분화와 같은 구성)
+        glGenVertexArrays(1, &m_ModifierVertexArray);
+        glBindVertexArray(m_ModifierVertexArray);
 
-    const char* EditorLayer::GetVertexShaderSource()
-    {
-        return R"(#version 330 core
-layout(location = 0) in vec3 a_Pos;
-uniform mat4 u_ViewProjection;
-void main() {
-    gl_Position = u_ViewProjection * vec4(a_Pos, 1.0);
-    gl_PointSize = 20.0;
-}
-)";
-    }
+        glGenBuffers(1, &m_ModifierVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_ModifierVertexBuffer);
+        GpuBufferData(GL_ARRAY_BUFFER, m_ModifierVertexBuffer, 0, nullptr, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
 
-    const char* EditorLayer::GetFragmentShaderSource()
-    {
-        return R"(#version 330 core
-layout(location = 0) out vec4 FragColor;
-uniform vec4 u_Color;
-void main() {
-    FragColor = u_Color;
-}
-)";
+        glGenBuffers(1, &m_ModifierIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ModifierIndexBuffer);
+        GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, m_ModifierIndexBuffer, 0, nullptr, GL_DYNAMIC_DRAW);
+
+        glBindVertexArray(m_VertexArray);
     }
 
     // -------------------------------------------------------------------------
-    // [4] ̺Ʈ ó (Event Handling)
+    // [4] 이벤트 처리 (Event Handling)
     // -------------------------------------------------------------------------
     void EditorLayer::OnEvent(Event& e)
     {
+        MemoryTagScope memoryTag(MemoryTag::Mesh); // [추가] 키 입력으로 하는 메쉬 편집 (Extrude, 최적화 등)
         if (e.GetEventType() == EventType::MouseMoved)
         {
             MouseMovedEvent& event = (MouseMovedEvent&)e;
             glm::vec2 currentPos = { event.GetX(), event.GetY() };
 
-            // Ÿ 
+            // 델타 계산
             m_MouseDelta = currentPos - m_MousePos;
-            m_MousePos = currentPos; //  ġ 
+            m_MousePos = currentPos; // 현재 위치 갱신
         }
         else if (e.GetEventType() == EventType::WindowResize)
         {
             WindowResizeEvent& event = (WindowResizeEvent&)e;
-            glViewport(0, 0, event.GetWidth(), event.GetHeight());
+            GLsizei width = (GLsizei)event.GetWidth(), height = (GLsizei)event.GetHeight();
+            RenderThread::Submit([width, height] { glViewport(0, 0, width, height); });
         }
         if (e.GetEventType() == EventType::KeyPressed) {
             KeyPressedEvent& event = (KeyPressedEvent&)e;
-            if (event.GetKeyCode() == 340 || event.GetKeyCode() == 344) m_IsShiftPressed = true; // Shift (GLFW )
+            if (event.GetKeyCode() == 340 || event.GetKeyCode() == 344) m_IsShiftPressed = true; // Shift (GLFW 기준)
             if (event.GetKeyCode() == 341 || event.GetKeyCode() == 345) m_IsCtrlPressed = true; // Ctrl
-            // ... G/E Key  ...
-            // 'G' Key (71) ̵
+            // ... G/E Key 로직 ...
+            // 'G' Key (71) 이동
             if (event.GetKeyCode() == 71 && !m_SelectedIndices.empty() && !m_IsTranslationMode)
             {
                 m_IsTranslationMode = true;
-                m_TranslationInit = false; // [ٽ] " ʱⰪ   ߾!"  ǥ
-                // [] õ    ġ  (  Ÿ )
-                m_MultiVertexStartPositions.clear();
-                for (int index : m_SelectedIndices)
-                {
-                    m_MultiVertexStartPositions.push_back(m_Vertices[index]);
-                }
+                m_TranslationInit = false; // [핵심] "아직 초기값 계산 안 했어!" 라고 표시
+                // [수정] 선택된 모든 점(+ 대칭 정점)의 현재 위치를 백업 (취소 및 델타 계산용)
+                BeginVertexTranslation();
             }
-            // [ű] 'E' Key (Extrude - )
-            // : õ   ->   -> ̵  
+            // [신규] 선택된 점이 없으면 'G'는 오브젝트 이동
+            else if (event.GetKeyCode() == 71 && m_SelectedObject != NullEntity && !m_IsTranslationMode)
+            {
+                m_IsTranslationMode = true;
+                m_TranslationInit = false;
+                m_ObjectStartTransform = m_Scene.GetWorldTransform(m_SelectedObject);
+            }
+            // [신규] 'E' Key (Extrude - 돌출)
+            // 로직: 선택된 점 복제 -> 선 연결 -> 이동 모드 진입
             else if (event.GetKeyCode() == 69 && !m_SelectedIndices.empty() && !m_IsTranslationMode)
             {
-                // õ  ְ, ̵ 尡 ƴ 
-               
-                // 1. [ 1  ] -> (Edge)  
+                // 선택된 점이 있고, 이동 모드가 아닐 때
+
+                // [추가] 대칭 편집 중이면 선택한 점의 반대편 짝도 같이 돌출
+                // (복사본은 원본과 같은 자리라 위치로는 짝을 못 가림 -> 아래에서 복사본끼리 짝으로 직접 등록)
+                FrameVector<int> extrudeIndices(m_SelectedIndices.begin(), m_SelectedIndices.end());
+                if (m_IsSymmetryEnabled)
+                {
+                    UpdateSymmetryMap();
+                    FrameVector<uint8_t> inSet(m_Vertices.size(), 0);
+                    for (int index : m_SelectedIndices)
+                        inSet[index] = 1;
+                    for (int index : m_SelectedIndices)
+                    {
+                        uint32_t mirror = m_Symmetry.GetMirror((uint32_t)index);
+                        if (mirror != SymmetryMap::None && !inSet[mirror])
+                        {
+                            inSet[mirror] = 1;
+                            extrudeIndices.push_back((int)mirror);
+                        }
+                    }
+                }
+
+                // [수정] 옛날 인덱스 -> 새 인덱스 (두 경우 공통, 대칭 짝 등록에도 씀)
+                // 이번 조작에만 쓰는 표는 프레임 아레나에 (힙 할당 없음)
+                FrameUnorderedMap<int, int> indexMap;
+                indexMap.reserve(extrudeIndices.size());
+
+                // 1. [점 1개 선택 시] -> 선(Edge) 생성 로직
                 if (m_SelectedIndices.size() == 1)
                 {
-                    int oldIdx = m_SelectedIndices[0];
-                    glm::vec3 currentPos = m_Vertices[oldIdx];
+                    for (int oldIdx : extrudeIndices)
+                    {
+                        glm::vec3 currentPos = m_Vertices[oldIdx];
 
-                    // 1.   (ġ )
-                    m_Vertices.push_back(currentPos);
-                    int newIdx = (int)m_Vertices.size() - 1;
+                        // 1. 점 복제 (위치는 같음)
+                        m_Vertices.push_back(currentPos);
+                        int newIdx = (int)m_Vertices.size() - 1;
+                        indexMap[oldIdx] = newIdx;
 
-                    // 2. [߿]  ε(m_EdgeIndices) ߰!
-                    //  m_Indices()  մ .
-                    m_EdgeIndices.push_back(oldIdx);
-                    m_EdgeIndices.push_back(newIdx);
+                        // 2. [중요] 선 인덱스(m_EdgeIndices)에만 추가!
+                        // 기존 m_Indices(면)에는 절대 손대지 마세요.
+                        m_EdgeIndices.push_back(oldIdx);
+                        m_EdgeIndices.push_back(newIdx);
+                    }
 
-                    // 3.   (    ̴)
+                    // 3. 선택 변경 (이제부터 움직일 놈은 새 점이다. 반대편 복사본은 대칭 이동으로 따라옴)
+                    int newIdx = indexMap[m_SelectedIndices[0]];
                     m_SelectedIndices.clear();
                     m_SelectedIndices.push_back(newIdx);
 
-                    //  α
+                    // 디버깅용 로그
                     // std::cout << "Extruded Vertex! Old: " << oldIdx << " New: " << newIdx << std::endl;
                 }
-                // 2. [ 2 ̻  ] -> (Face)   ( ڵ)
+                // 2. [점 2개 이상 선택 시] -> 면(Face) 생성 로직 (기존 코드)
                 else
                 {
-                    // ... (Ʊ ۼ    ״ ) ...
-                    // indexMap , processedEdges üũؼ m_Indices() ߰ϴ ڵ
-                    // 1. [ غ]  ε ->  ε
-                    std::unordered_map<int, int> indexMap;
-                    std::vector<int> newSelectedIndices;
-
-                    // 2. [ ] õ  ؼ m_Vertices ڿ ߰
-                    for (int oldIdx : m_SelectedIndices)
+                    // ... (아까 작성한 면 생성 로직 그대로 유지) ...
+                    // indexMap 만들고, processedEdges 체크해서 m_Indices(면)에 추가하는 코드
+                    // 1. [매핑 준비] 옛날 인덱스 -> 새 인덱스 (indexMap, 위에서 만듦)
+                    FrameVector<int> newSelectedIndices;
+                    newSelectedIndices.reserve(m_SelectedIndices.size());
+
+                    // 2. [점 복제] 선택된 점들(+ 대칭 짝)을 복사해서 m_Vertices 뒤에 추가
+                    for (int oldIdx : extrudeIndices)
                     {
                         glm::vec3 currentPos = m_Vertices[oldIdx];
 
-                        m_Vertices.push_back(currentPos); //  ߰
+                        m_Vertices.push_back(currentPos); // 점 추가
 
                         int newIdx = (int)m_Vertices.size() - 1;
-                        indexMap[oldIdx] = newIdx; //   (: 1  4 Ǿ)
-                        newSelectedIndices.push_back(newIdx); // ߿ ׸ ؾ 
+                        indexMap[oldIdx] = newIdx; // 족보 기록 (예: 1번 점은 4번이 되었다)
                     }
+                    for (int oldIdx : m_SelectedIndices)
+                        newSelectedIndices.push_back(indexMap[oldIdx]); // 나중에 얘네를 선택해야 함 (반대편은 대칭으로 따라옴)
 
-                    // 3. [ ]    , õ   " "  ä
+                    // 3. [면 생성] 기존 연결 정보를 보고, 선택된 점들 사이의 "빈 공간"을 면으로 채움
 
-                    // ߺ    (1-2  óߴµ 2-1    Ǵϱ)
-                    std::set<std::pair<int, int>> processedEdges;
+                    // 중복 엣지 생성 방지용 (1-2 엣지를 처리했는데 2-1에서 또 만들면 안 되니까)
+                    FrameSet<std::pair<int, int>> processedEdges;
 
-                    //  ε  ũ⸦ ̸  ( 鼭 push_back ϸ ѷ   )
+                    // 기존 인덱스 버퍼의 크기를 미리 저장 (루프 돌면서 push_back 하면 무한루프 돌 수 있음)
                     size_t oldIndexCount = m_Indices.size();
 
                     for (size_t i = 0; i < oldIndexCount; i += 3)
                     {
-                        //  ﰢ  
+                        // 현재 삼각형의 세 점
                         int idx[3] = { (int)m_Indices[i], (int)m_Indices[i + 1], (int)m_Indices[i + 2] };
 
-                        // ﰢ 3   ˻ (0-1, 1-2, 2-0)
+                        // 삼각형의 3개 엣지를 각각 검사 (0-1, 1-2, 2-0)
                         for (int j = 0; j < 3; j++)
                         {
                             int a = idx[j];
                             int b = idx[(j + 1) % 3];
 
-                            //  (Edge)  "̹ Extrude " ΰ?
+                            // 두 점(Edge)이 모두 "이번에 Extrude된 점" 인가?
                             if (indexMap.find(a) != indexMap.end() && indexMap.find(b) != indexMap.end())
                             {
-                                // ̹ ó  Ȯ ( ϰ )
+                                // 이미 처리한 엣지인지 확인 (순서 무관하게 저장)
                                 int minIdx = std::min(a, b);
                                 int maxIdx = std::max(a, b);
                                 if (processedEdges.find({ minIdx, maxIdx }) == processedEdges.end())
                                 {
-                                    // ó   -> (Quad) !
+                                    // 처리 안 했으면 -> 쿼드(Quad) 생성!
                                     // A -- B
                                     // |    |
                                     // A'-- B'
                                     int a_new = indexMap[a];
                                     int b_new = indexMap[b];
 
-                                    // ﰢ 1: (A, B, B')
+                                    // 삼각형 1: (A, B, B')
                                     m_Indices.push_back(a);
                                     m_Indices.push_back(b);
                                     m_Indices.push_back(b_new);
 
-                                    // ﰢ 2: (B', A', A) -    (Culling) 
-                                    // (    ߿,  ϴ ä  ǥ)
+                                    // 삼각형 2: (B', A', A) - 순서는 렌더링 면 방향(Culling) 고려
+                                    // (양면 렌더링을 끄면 순서가 중요하지만, 지금은 일단 채우는 게 목표)
                                     m_Indices.push_back(b_new);
                                     m_Indices.push_back(a_new);
                                     m_Indices.push_back(a);
 
-                                    // ó Ͽ 
+                                    // 처리 목록에 등록
                                     processedEdges.insert({ minIdx, maxIdx });
                                 }
                             }
                         }
 
-                        // [ɼ] Ѳ(Cap) : ﰢ    õǾٸ,  鵵 
+                        // [옵션] 뚜껑(Cap) 생성: 삼각형의 세 점이 모두 선택되었다면, 그 면도 복사해줌
                         if (indexMap.find(idx[0]) != indexMap.end() &&
                             indexMap.find(idx[1]) != indexMap.end() &&
                             indexMap.find(idx[2]) != indexMap.end())
@@ -510,107 +605,182 @@ void main() {
                         }
                     }
 
-                    m_SelectedIndices = newSelectedIndices;
+                    m_SelectedIndices.assign(newSelectedIndices.begin(), newSelectedIndices.end());
                 }
+                m_TopologyVersion++;
 
-                // 3. : ̵   (GŰ    ڵ)
+                // [추가] 복사본끼리 원본과 같은 짝 관계로 등록. 위치는 그대로라 표를 다시 만들 필요 없음
+                if (m_IsSymmetryEnabled)
+                {
+                    for (const auto& [oldIdx, newIdx] : indexMap)
+                    {
+                        uint32_t mirror = m_Symmetry.GetMirror((uint32_t)oldIdx);
+                        auto it = mirror == SymmetryMap::None ? indexMap.end() : indexMap.find((int)mirror);
+                        if (it != indexMap.end())
+                            m_Symmetry.AddPair((uint32_t)newIdx, (uint32_t)it->second);
+                    }
+                    m_SymmetryTopologyVersion = m_TopologyVersion;
+                }
+
+                // 3. 공통: 이동 모드 진입 (G키와 완전히 동일한 깔끔한 코드)
                 m_IsTranslationMode = true;
-                m_TranslationInit = false; // [ٽ] ⼭   ! HandleInteraction ̷
+                m_TranslationInit = false; // [핵심] 여기서도 계산 안 함! HandleInteraction에게 미룸
 
-                m_MultiVertexStartPositions.clear();
-                for (int index : m_SelectedIndices)
-                    m_MultiVertexStartPositions.push_back(m_Vertices[index]);
+                BeginVertexTranslation();
                 
             }
             // J Key code 
             else if (event.GetKeyCode() == 74) 
             {
-                // Ȯ 2 õǾ  
+                // 정확히 2개가 선택되었을 때만 동작
                 if (m_SelectedIndices.size() == 2)
                 {
                     int idx1 = m_SelectedIndices[0];
                     int idx2 = m_SelectedIndices[1];
 
-                    //  ε ߰
+                    // 선 인덱스에 추가
                     m_EdgeIndices.push_back(idx1);
                     m_EdgeIndices.push_back(idx2);
+                    m_TopologyVersion++; // [추가] Edge IBO 다시 올림
 
-                    // α
+                    // 로그
                     // std::cout << "Joined vertices " << idx1 << " and " << idx2 << std::endl;
                 }
             }
-            // [ű] 'F' Key (Face) -  
+            // [신규] 'F' Key (Face) - 면 생성
             else if (event.GetKeyCode() == 70) // F Key code
             {
-                //  3 ̻̾    
+                // 점이 3개 이상이어야 면을 만들 수 있음
                 if (m_SelectedIndices.size() >= 3)
                 {
-                    // Triangle Fan ˰ 
-                    // ù ° õ (root)  ä  ﰢ 
-                    int rootIdx = m_SelectedIndices[0];
-
-                    for (size_t i = 1; i < m_SelectedIndices.size() - 1; i++)
-                    {
-                        int idxB = m_SelectedIndices[i];
-                        int idxC = m_SelectedIndices[i + 1];
-
-                        //  ε(m_Indices) ߰
-                        // ݽð (CCW) ո̹Ƿ  
-                        m_Indices.push_back(rootIdx);
-                        m_Indices.push_back(idxB);
-                        m_Indices.push_back(idxC);
-                    }
-
-                    // α
+                    // [수정] Triangle Fan -> Ear Clipping / Monotone 분할
+                    // 오목하거나 평면이 아닌 선택도 겹치지 않게 채움
+                    // 경계선으로 닫힌 고리가 여러 개면 각각 따로(병렬로) 뚜껑을 만듦
+                    auto loops = Triangulator::BuildLoops(m_SelectedIndices, m_Indices, m_EdgeIndices, m_Vertices.size());
+                    Triangulator::TriangulateLoops(m_Vertices, loops, m_Indices);
+                    m_TopologyVersion++;
+
+                    // 로그
                     // std::cout << "Created Face with " << m_SelectedIndices.size() << " vertices." << std::endl;
                 }
         }
+            // [신규] Ctrl + O : 메쉬 최적화 (미사용 정점 제거, 캐시 최적화)
+            else if (event.GetKeyCode() == 79 && m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                OptimizeMesh();
+            }
+            // [신규] 'Z' Key : 조명 / 단색 셰이딩 전환
+            else if (event.GetKeyCode() == 90 && !m_IsTranslationMode)
+            {
+                m_IsLitShading = !m_IsLitShading;
+            }
+            // [신규] Ctrl + S : OBJ 내보내기 (내보내기 전에 최적화)
+            // [수정] 문서/Mixer/<문서 이름>.obj. 이미 있으면 덮어쓰지 않고 -2, -3 ... 을 붙인 새 파일로
+            else if (event.GetKeyCode() == 83 && m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                ExportMesh(Paths::MakeUniquePath(Paths::GetDocumentsDirectory(), m_DocumentName, ".obj"));
+            }
+            // [신규] Ctrl + D : 메쉬 단순화 (QEM, 백그라운드)
+            else if (event.GetKeyCode() == 68 && m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                StartSimplify();
+            }
+            // [신규] 'B' Key : 뒷면 제거 토글
+            else if (event.GetKeyCode() == 66 && !m_IsCtrlPressed)
+            {
+                m_IsBackfaceCulling = !m_IsBackfaceCulling;
+            }
+            // [신규] Ctrl + B : 위치 커널 변형별 성능 비교 (로그 출력)
+            else if (event.GetKeyCode() == 66 && m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                PositionKernels::RunBenchmark(1 << 20);
+            }
+            // [신규] Shift + A : 오브젝트 배치 (Ctrl을 같이 누르면 100x100 격자)
+            else if (event.GetKeyCode() == 65 && m_IsShiftPressed && !m_IsTranslationMode)
+            {
+                PlaceObjects(m_IsCtrlPressed);
+            }
+            // [신규] Ctrl + 0~3 : 세분화 곡면 단계 (Shift를 같이 누르면 Loop 방식)
+            else if (event.GetKeyCode() >= 48 && event.GetKeyCode() <= 51 && m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                SetSubdivision(m_IsShiftPressed ? SubdivisionScheme::Loop : SubdivisionScheme::CatmullClark, event.GetKeyCode() - 48);
+            }
+            // [신규] 'O' Key : 비례 편집 켜기/끄기 (Ctrl + O는 최적화)
+            else if (event.GetKeyCode() == 79 && !m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                m_IsProportionalEnabled = !m_IsProportionalEnabled;
+                MX_CORE_INFO("Proportional editing {0} (radius {1:.3f})", m_IsProportionalEnabled ? "on" : "off", m_ProportionalRadius);
+            }
+            // [신규] 'X' Key : 대칭 편집 켜기/끄기 (Shift + X : 축 변경 X -> Y -> Z)
+            else if (event.GetKeyCode() == 88 && !m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                if (m_IsShiftPressed)
+                    m_SymmetryAxis = (m_SymmetryAxis + 1) % 3;
+                else
+                    m_IsSymmetryEnabled = !m_IsSymmetryEnabled;
+                MX_CORE_INFO("Symmetry {0} ({1} axis)", m_IsSymmetryEnabled ? "on" : "off", "XYZ"[m_SymmetryAxis]);
+            }
+            // [신규] Shift + 1~5 : 모디파이어 켜기/끄기 (켜면 스택 맨 뒤에 추가), Shift + 0 : 전부 제거
+            else if (event.GetKeyCode() >= 48 && event.GetKeyCode() <= 53 && m_IsShiftPressed && !m_IsCtrlPressed && !m_IsTranslationMode)
+            {
+                if (event.GetKeyCode() == 48)
+                {
+                    m_Modifiers.Clear();
+                    MX_CORE_INFO("Modifiers cleared");
+                }
+                else
+                {
+                    ToggleModifier((ModifierType)(event.GetKeyCode() - 49));
+                }
+            }
             
             // ---------------------------------------------------------
-            // [ű] Ʈ ȯ (Numpad)
+            // [신규] 뷰포트 전환 (Numpad)
             // ---------------------------------------------------------
 
+            // [수정] 축 정렬 뷰는 직교 투영으로, 각도와 투영 모두 부드럽게 전환 (마우스로 돌리면 원근으로 돌아감)
+
             // Numpad 1 (Front / Back)
             if (event.GetKeyCode() == 321) // GLFW_KEY_KP_1
             {
-                m_CameraPitch = 0.0f; // 
-                if (m_IsCtrlPressed) m_CameraYaw = PI; // Back (ڿ )
-                else                 m_CameraYaw = 0.0f; // Front (տ )
+                // 수평. Back (뒤에서 봄) / Front (앞에서 봄)
+                m_Camera.SetView(m_IsCtrlPressed ? PI : 0.0f, 0.0f, true);
             }
 
-            // Numpad 3 (Right / Left) -  ־帲
+            // Numpad 3 (Right / Left) - 덤으로 넣어드림
             else if (event.GetKeyCode() == 323) // GLFW_KEY_KP_3
             {
-                m_CameraPitch = 0.0f;
-                if (m_IsCtrlPressed) m_CameraYaw = -HALF_PI; // Left
-                else                 m_CameraYaw = HALF_PI;  // Right
+                m_Camera.SetView(m_IsCtrlPressed ? -HALF_PI : HALF_PI, 0.0f, true); // Left / Right
             }
 
             // Numpad 7 (Top / Bottom)
             else if (event.GetKeyCode() == 327) // GLFW_KEY_KP_7
             {
-                m_CameraYaw = 0.0f;
-                // : Ȯ 90(HALF_PI) Ǹ LookAt Լ   UpͿ ļ
-                // ȭ ų(Gimbal Lock)   ֽϴ.
-                //  ̼ϰ   ݴϴ (: 1.56f)
+                // 주의: 정확히 90도(HALF_PI)가 되면 LookAt 함수 계산 시 Up벡터와 겹쳐서
+                // 화면이 뒤집히거나(Gimbal Lock) 깨질 수 있습니다.
+                // 아주 미세하게 작은 값을 빼줍니다 (예: 1.56f)
                 float safePitch = 1.56f;
+                m_Camera.SetView(0.0f, m_IsCtrlPressed ? -safePitch : safePitch, true); // Bottom / Top
+            }
 
-                if (m_IsCtrlPressed) m_CameraPitch = -safePitch; // Bottom
-                else                 m_CameraPitch = safePitch;  // Top
+            // [신규] Numpad 5: 원근 <-> 직교 (각도 유지)
+            else if (event.GetKeyCode() == 325) // GLFW_KEY_KP_5
+            {
+                m_Camera.SetOrthographic(!m_Camera.IsOrthographic());
             }
 
-            // Numpad 9 (Top / Bottom ݴ  -  Ÿ)
-            //  Ctrl+7 ϸ 9 Bottom ᵵ ˴ϴ.
+            // Numpad 9 (Top / Bottom 반대 기능 - 블렌더 스타일)
+            // 만약 Ctrl+7이 불편하면 9번을 Bottom으로 써도 됩니다.
             else if (event.GetKeyCode() == 329) // GLFW_KEY_KP_9
             {
-                //       ()
+                // 토글 로직 등을 넣을 수 있음 (생략)
             }
         }
         else if (e.GetEventType() == EventType::KeyReleased) {
             KeyReleasedEvent& event = (KeyReleasedEvent&)e;
             if (event.GetKeyCode() == 340 || event.GetKeyCode() == 344) m_IsShiftPressed = false;
 
-            // [߰] Ctrl  (Left Ctrl: 341, Right Ctrl: 345)
+            // [추가] Ctrl 해제 (Left Ctrl: 341, Right Ctrl: 345)
             if (event.GetKeyCode() == 341 || event.GetKeyCode() == 345) m_IsCtrlPressed = false;
         }
         else if (e.GetEventType() == EventType::MouseButtonPressed)
@@ -624,59 +794,63 @@ void main() {
 
             if (m_IsTranslationMode)
             {
-                // [̵  ]
-                if (event.GetMouseButton() == 0) // Ŭ: Ȯ
+                // [이동 모드 중]
+                if (event.GetMouseButton() == 0) // 좌클릭: 확정
                 {
                     m_IsTranslationMode = false;
+                    m_Proportional.End();
                 }
-                else if (event.GetMouseButton() == 1) // Ŭ: 
+                else if (event.GetMouseButton() == 1) // 우클릭: 취소
                 {
-                    // []    ġ 󺹱
-                    for (size_t i = 0; i < m_SelectedIndices.size(); i++)
-                    {
-                        int idx = m_SelectedIndices[i];
-                        m_Vertices[idx] = m_MultiVertexStartPositions[i];
-                    }
+                    // [수정] 모든 점을 원래 위치로 원상복구
+                    if (!m_SelectedIndices.empty())
+                        ApplyVertexTranslation(glm::vec3(0.0f));
+                    else if (m_SelectedObject != NullEntity)
+                        m_Scene.SetWorldTransform(m_SelectedObject, m_ObjectStartTransform); // [추가] 오브젝트 이동 취소
                     m_IsTranslationMode = false;
+                    m_Proportional.End();
                 }
             }
             else
             {
-                // [Ϲ : ]
-                if (event.GetMouseButton() == 0) // Ŭ
+                // [일반 모드: 선택]
+                if (event.GetMouseButton() == 0) // 좌클릭
                 {
                     if (m_HoveredIndex != -1)
                     {
-                        // 1. Shift Ű   ( /)
+                        // 1. Shift 키를 누른 상태 (다중 선택/토글)
                         if (m_IsShiftPressed)
                         {
-                            // ̹ õ  Ȯ
+                            // 이미 선택된 놈인지 확인
                             auto it = std::find(m_SelectedIndices.begin(), m_SelectedIndices.end(), m_HoveredIndex);
                             if (it != m_SelectedIndices.end())
                             {
-                                // ̹  ->   ()
+                                // 이미 있으면 -> 선택 해제 (제거)
                                 m_SelectedIndices.erase(it);
                             }
                             else
                             {
-                                //  -> ߰
+                                // 없으면 -> 추가
                                 m_SelectedIndices.push_back(m_HoveredIndex);
                             }
                         }
-                        // 2. ׳ Ŭ ( )
+                        // 2. 그냥 클릭 (단일 선택)
                         else
                         {
-                            //    , 길 
+                            // 기존 선택 다 지우고, 얘만 선택
                             m_SelectedIndices.clear();
                             m_SelectedIndices.push_back(m_HoveredIndex);
                         }
                     }
                     else
                     {
-                        //   Ŭ ->   
-                        // (, Shift  ¿ ϴ   , ϴ  )
+                        // 빈 공간 클릭 -> 모두 선택 해제
+                        // (단, Shift 누른 상태에서는 유지하는 게 툴 국룰이지만, 일단 다 해제)
                         if (!m_IsShiftPressed)
                             m_SelectedIndices.clear();
+
+                        // [추가] 점이 아니면 오브젝트 선택 (없으면 해제)
+                        PickObject();
                     }
                 }
             }
@@ -690,116 +864,741 @@ void main() {
         }
         else if (e.GetEventType() == EventType::MouseScrolled) {
             MouseScrolledEvent& event = (MouseScrolledEvent&)e;
-            float zoomSpeed = 0.5f;
-            m_CameraDistance -= event.GetYOffset() * zoomSpeed;
-            if (m_CameraDistance < 0.1f) m_CameraDistance = 0.1f; // ʹ  ʰ
+            // [추가] 비례 편집으로 이동 중이면 휠은 반경 조절
+            if (m_IsTranslationMode && m_IsProportionalEnabled && !m_SelectedIndices.empty())
+            {
+                SetProportionalRadius(m_ProportionalRadius * (event.GetYOffset() > 0.0f ? 1.1f : 1.0f / 1.1f));
+                return;
+            }
+            m_Camera.Zoom(event.GetYOffset());
         }
     }
 
     // -------------------------------------------------------------------------
-    // [5]   Ÿ  (Math Helpers)
+    // [5] 메쉬 최적화 / 내보내기 (Mesh Optimization / Export)
     // -------------------------------------------------------------------------
-    glm::vec3 EditorLayer::GetRayFromMouse()
+    void EditorLayer::OptimizeMesh()
     {
-        auto& window = Application::Get().GetWindow();
-        float width = (float)window.GetWidth();
-        float height = (float)window.GetHeight();
+        std::vector<uint32_t> remap;
+        MeshOptimizeStats stats = MeshOptimizer::Optimize(m_Vertices, m_Indices, m_EdgeIndices, remap);
 
-        float mouseX = (2.0f * m_MousePos.x) / width - 1.0f;
-        float mouseY = 1.0f - (2.0f * m_MousePos.y) / height;
+        // 정점 번호가 바뀌었으므로 선택 목록도 새 번호로 변환 (제거된 점은 선택 해제)
+        FrameVector<int> remappedSelection;
+        for (int index : m_SelectedIndices)
+        {
+            if (remap[index] != MeshOptimizer::InvalidIndex)
+                remappedSelection.push_back((int)remap[index]);
+        }
+        m_SelectedIndices.assign(remappedSelection.begin(), remappedSelection.end());
+        m_HoveredIndex = -1;
+        m_Normals.Invalidate(); // 인덱스 순서가 바뀌었으므로 법선 전체 재계산
+        m_TopologyVersion++;
+
+        MX_CORE_INFO("Mesh optimized: vertices {0} -> {1}, ACMR {2:.3f} -> {3:.3f}, {4}-bit indices",
+            stats.VerticesBefore, stats.VerticesAfter, stats.ACMRBefore, stats.ACMRAfter,
+            stats.Use16BitIndices ? 16 : 32);
+    }
 
-        glm::vec4 rayStart = glm::vec4(mouseX, mouseY, -1.0f, 1.0f);
-        glm::vec4 rayEnd = glm::vec4(mouseX, mouseY, 1.0f, 1.0f);
+    void EditorLayer::ExportMesh(const std::string& path)
+    {
+        // [수정] 파일에만 최적화된 순서로 씀 (편집 중인 메쉬의 정점 번호, 선택, 버전은 그대로)
+        std::vector<glm::vec3> vertices = m_Vertices;
+        std::vector<uint32_t> indices = m_Indices;
+        std::vector<uint32_t> edgeIndices = m_EdgeIndices;
+        std::vector<uint32_t> remap;
+        MeshOptimizer::Optimize(vertices, indices, edgeIndices, remap);
+        MeshExporter::ExportOBJ(path, vertices, indices, edgeIndices);
+    }
 
-        glm::mat4 inverseVP = glm::inverse(m_ViewProjection);
-        glm::vec4 rayStartWorld = inverseVP * rayStart;
-        rayStartWorld /= rayStartWorld.w;
-        glm::vec4 rayEndWorld = inverseVP * rayEnd;
-        rayEndWorld /= rayEndWorld.w;
+    void EditorLayer::UploadIndexBuffer(GLuint buffer, const std::vector<uint32_t>& indices)
+    {
+        MemoryTagScope memoryTag(MemoryTag::GPUStaging);
 
-        return glm::normalize(glm::vec3(rayEndWorld - rayStartWorld));
+        if (m_IndexType == GL_UNSIGNED_SHORT)
+        {
+            // [수정] 명령 큐로 복사하면서 바로 16비트로 변환 (따로 변환 버퍼를 두지 않음)
+            GLsizeiptr size = (GLsizeiptr)(indices.size() * sizeof(uint16_t));
+            uint16_t* indices16 = static_cast<uint16_t*>(RenderThread::AllocateCommandData((size_t)size));
+            std::copy(indices.begin(), indices.end(), indices16);
+            RenderThread::Submit([buffer, size, indices16]
+            {
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+                GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, buffer, size, indices16, GL_DYNAMIC_DRAW);
+            });
+        }
+        else
+        {
+            SubmitBufferData(GL_ELEMENT_ARRAY_BUFFER, buffer, indices.size() * sizeof(uint32_t), indices.data(), GL_DYNAMIC_DRAW);
+        }
     }
 
-    bool EditorLayer::CalculatePlaneIntersection(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planePoint, const glm::vec3& planeNormal, float& t)
+    // -------------------------------------------------------------------------
+    // [6] 세분화 곡면 (Subdivision Surface)
+    // -------------------------------------------------------------------------
+    void EditorLayer::SetSubdivision(SubdivisionScheme scheme, uint32_t level)
     {
-        float denom = glm::dot(planeNormal, rayDir);
-        if (abs(denom) > 1e-6)
+        // 단계만 바꾸면 이미 만든 Stencil 표는 재사용됨
+        m_Subdivision.SetScheme(scheme);
+        m_Subdivision.SetLevel(level);
+        m_SubdivPositionVersion = ~0u; // 새 단계의 위치 계산 + 버퍼 재업로드 필요
+        m_SubdivUploadedLevel = ~0u;
+    }
+
+    void EditorLayer::UpdateSubdivision()
+    {
+        if (m_Subdivision.GetLevel() == 0)
+            return;
+
+        // 1. 토폴로지가 바뀌었으면 케이지부터 다시 (면 생성, Extrude, 최적화)
+        if (m_SubdivTopologyVersion != m_TopologyVersion || !m_Subdivision.IsValid(m_Vertices.size()))
         {
-            glm::vec3 p0l0 = planePoint - rayOrigin;
-            t = glm::dot(p0l0, planeNormal) / denom;
-            return (t >= 0);
+            m_Subdivision.SetCage(m_Indices, m_Vertices.size());
+            m_SubdivTopologyVersion = m_TopologyVersion;
+            m_SubdivPositionVersion = ~0u;
+            m_SubdivUploadedLevel = ~0u;
+        }
+
+        // 2. 위치만 바뀌었으면 표 곱셈만 (G 드래그 중)
+        if (m_SubdivPositionVersion == m_PositionVersion)
+            return;
+
+        m_Subdivision.Evaluate(m_Vertices);
+        m_SubdivPositionVersion = m_PositionVersion;
+
+        const auto& positions = m_Subdivision.GetPositions();
+        if (m_SubdivUploadedLevel != m_Subdivision.GetLevel())
+        {
+            // 단계/토폴로지가 바뀐 경우만 버퍼 재할당 + IBO 업로드
+            const auto& triangles = m_Subdivision.GetTriangles();
+            SubmitBufferData(GL_ARRAY_BUFFER, m_SubdivVertexBuffer, positions.size() * sizeof(glm::vec3), positions.data(), GL_DYNAMIC_DRAW);
+
+            // IBO는 VAO에 묶이므로 세분화 VAO를 바인딩한 채로
+            GLuint subdivArray = m_SubdivVertexArray, subdivIndexBuffer = m_SubdivIndexBuffer, vertexArray = m_VertexArray;
+            GLsizeiptr size = (GLsizeiptr)(triangles.size() * sizeof(uint32_t));
+            const uint32_t* data = RenderThread::CopyCommandData(triangles.data(), triangles.size());
+            RenderThread::Submit([=]
+            {
+                glBindVertexArray(subdivArray);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, subdivIndexBuffer);
+                GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, subdivIndexBuffer, size, data, GL_STATIC_DRAW);
+                glBindVertexArray(vertexArray);
+            });
+
+            m_SubdivUploadedLevel = m_Subdivision.GetLevel();
+        }
+        else
+        {
+            SubmitBufferSubData(GL_ARRAY_BUFFER, m_SubdivVertexBuffer, 0, positions.size() * sizeof(glm::vec3), positions.data());
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // [7] 메쉬 단순화 (Mesh Simplification)
+    // -------------------------------------------------------------------------
+    void EditorLayer::StartSimplify()
+    {
+        if (m_SimplifyTask.IsRunning())
+        {
+            MX_CORE_WARN("Simplification already running ({0:.0f}%)", m_SimplifyTask.GetProgress() * 100.0f);
+            return;
+        }
+
+        SimplifyOptions options;
+        options.TargetTriangleCount = m_Indices.size() / 3 / 2;
+        options.TargetError = 0.01f;
+        options.PreserveBoundary = true;
+
+        // 입력은 복사되므로 작업 중에도 계속 편집 가능
+        if (m_SimplifyTask.Start(m_Vertices, m_Indices, options))
+        {
+            m_SimplifyTopologyVersion = m_TopologyVersion;
+            m_SimplifyReportedStep = 0;
+            MX_CORE_INFO("Simplifying {0} triangles -> {1}", m_Indices.size() / 3, options.TargetTriangleCount);
         }
-        return false;
     }
 
-    void EditorLayer::CheckShaderError(GLuint shader, const char* type) {
-        GLint success;
-        char infoLog[1024];
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            glGetShaderInfoLog(shader, 1024, NULL, infoLog);
-            MX_CORE_ERROR("SHADER_ERROR ( {0} ): {1}", type, infoLog);
+    void EditorLayer::PollSimplify()
+    {
+        if (m_SimplifyTask.IsRunning())
+        {
+            // 25% 단위로 진행률 표시
+            int step = (int)(m_SimplifyTask.GetProgress() * 4.0f);
+            if (step > m_SimplifyReportedStep && step < 4)
+            {
+                m_SimplifyReportedStep = step;
+                MX_CORE_INFO("Simplifying... {0}%", step * 25);
+            }
+            return;
         }
+
+        // [수정] 이동 중에는 결과를 작업에 둔 채 확정/취소 후에 적용
+        // (OptimizeMesh가 정점 번호를 바꾸면 BeginVertexTranslation이 만든 대상/시작 위치 목록이 어긋남)
+        if (m_IsTranslationMode)
+            return;
+
+        SimplifyResult result;
+        if (!m_SimplifyTask.TakeResult(result))
+            return;
+
+        if (m_SimplifyTopologyVersion != m_TopologyVersion)
+        {
+            MX_CORE_WARN("Mesh topology changed during simplification, result discarded");
+            return;
+        }
+
+        size_t before = m_Indices.size() / 3;
+        m_Indices = std::move(result.Indices);
+        m_Normals.Invalidate();
+        OptimizeMesh(); // 쓰이지 않게 된 정점 제거 + 캐시 최적화 (선택 목록 변환, 토폴로지 버전 증가 포함)
+
+        MX_CORE_INFO("Simplified: triangles {0} -> {1}, error {2:.4f}", before, result.TriangleCount, result.Error);
     }
-    void EditorLayer::CheckProgramError(GLuint program) {
-        GLint success;
-        char infoLog[1024];
-        glGetProgramiv(program, GL_LINK_STATUS, &success);
-        if (!success) {
-            glGetProgramInfoLog(program, 1024, NULL, infoLog);
-            MX_CORE_ERROR("PROGRAM_ERROR: {0}", infoLog);
+
+    // -------------------------------------------------------------------------
+    // [8] LOD (Level of Detail)
+    // -------------------------------------------------------------------------
+    void EditorLayer::UpdateLOD()
+    {
+        auto now = std::chrono::steady_clock::now();
+        float deltaTime = std::chrono::duration<float>(now - m_LastLODUpdate).count();
+        m_LastLODUpdate = now;
+
+        // 1. 바운딩 구 (위치/토폴로지가 바뀐 경우만)
+        if (m_BoundsTopologyVersion != m_TopologyVersion || m_BoundsPositionVersion != m_PositionVersion)
+        {
+            SyncPositionStore();
+            glm::vec3 minPos, maxPos;
+            PositionKernels::BoundingBox(m_PositionStore, minPos, maxPos);
+            m_BoundsCenter = m_Vertices.empty() ? glm::vec3(0.0f) : (minPos + maxPos) * 0.5f;
+            m_BoundsRadius = m_Vertices.empty() ? 0.0f : glm::length(maxPos - minPos) * 0.5f;
+            m_BoundsTopologyVersion = m_TopologyVersion;
+            m_BoundsPositionVersion = m_PositionVersion;
+        }
+
+        // 2. 생성이 끝났으면 업로드 (그 사이 토폴로지가 바뀌었으면 버림)
+        std::vector<MeshLODLevel> levels;
+        if (m_LODTask.TakeResult(levels) && m_LODBuildTopologyVersion == m_TopologyVersion)
+        {
+            ReleaseLODBuffers();
+
+            // [수정] 버퍼 이름은 바로 필요하므로 렌더 스레드에서 만들고 대기 (LOD가 새로 만들어질 때만)
+            m_LODIndexBuffers.assign(levels.size(), 0);
+            if (levels.size() > 1)
+                RenderThread::ExecuteNow([this] { glGenBuffers((GLsizei)m_LODIndexBuffers.size() - 1, m_LODIndexBuffers.data() + 1); });
+
+            for (size_t i = 0; i < levels.size(); i++)
+            {
+                if (i > 0)
+                    UploadIndexBuffer(m_LODIndexBuffers[i], levels[i].Indices);
+                m_LODIndexCounts.push_back((GLsizei)levels[i].Indices.size());
+                m_LODErrors.push_back(levels[i].Error);
+            }
+            m_LODTopologyVersion = m_LODBuildTopologyVersion;
+            m_LODPositionVersion = m_LODBuildPositionVersion;
+            m_CurrentLOD = m_PreviousLOD = 0;
+            m_LODFade = 1.0f;
+
+            MX_CORE_INFO("LOD built: {0} levels, {1} -> {2} triangles", levels.size(),
+                levels.front().Indices.size() / 3, levels.back().Indices.size() / 3);
         }
+
+        // 인덱스가 바뀌면 기존 단계는 쓸 수 없음 (위치만 바뀐 경우는 오차만 부정확 -> 계속 사용)
+        if (m_LODTopologyVersion != m_TopologyVersion && !m_LODIndexBuffers.empty())
+            ReleaseLODBuffers();
+
+        // 3. 무거운 메쉬는 편집이 끝난 뒤 다시 생성
+        bool stale = m_LODTopologyVersion != m_TopologyVersion || m_LODPositionVersion != m_PositionVersion;
+        if (stale && !m_IsTranslationMode && !m_LODTask.IsRunning() && m_Indices.size() / 3 >= LODMinTriangles)
+        {
+            if (m_LODTask.Start(m_Vertices, m_Indices))
+            {
+                m_LODBuildTopologyVersion = m_TopologyVersion;
+                m_LODBuildPositionVersion = m_PositionVersion;
+            }
+        }
+
+        // 4. 화면 오차로 단계 선택: 메쉬에서 가장 가까운 거리 기준 월드 1 단위의 픽셀 수
+        // [수정] 직교 뷰는 거리와 상관없이 화면 크기가 고정 (카메라가 투영에 맞게 계산)
+        float distance = std::max(glm::length(m_Camera.GetPosition() - m_BoundsCenter) - m_BoundsRadius, 0.1f);
+        float pixelsPerUnit = m_Camera.GetPixelsPerUnit(distance);
+
+        if (!m_LODIndexBuffers.empty())
+        {
+            m_LODFade = std::min(m_LODFade + deltaTime / LODFadeSeconds, 1.0f);
+
+            // 전환 중에는 새 단계를 고르지 않음 (두 단계만 섞음)
+            uint32_t target = MeshLOD::SelectLevel(m_LODErrors, pixelsPerUnit, LODPixelThreshold);
+            if (target != m_CurrentLOD && m_LODFade >= 1.0f)
+            {
+                m_PreviousLOD = m_CurrentLOD;
+                m_CurrentLOD = target;
+                m_LODFade = 0.0f;
+            }
+        }
+
+        // 5. 점 밀도: 바운딩 구가 화면에 차지하는 면적 / 정점 수
+        float projectedRadius = m_BoundsRadius * m_Camera.GetPixelsPerUnit(glm::length(m_Camera.GetPosition() - m_BoundsCenter));
+        float pixelAreaPerVertex = PI * projectedRadius * projectedRadius / std::max<float>((float)m_Vertices.size(), 1.0f);
+        m_ShowAllVertexPoints = pixelAreaPerVertex >= VertexPointMinPixelArea;
     }
-    void EditorLayer::UpdateCameraControl()
+
+    void EditorLayer::ReleaseLODBuffers()
     {
-        // Ÿ ʹ Ƣ ʰ Ȯ
-        if (glm::length(m_MouseDelta) > 100.0f) { m_MouseDelta = { 0,0 }; return; }
+        for (GLuint buffer : m_LODIndexBuffers)
+        {
+            if (buffer != 0)
+                SubmitDeleteBuffer(buffer);
+        }
+        m_LODIndexBuffers.clear();
+        m_LODIndexCounts.clear();
+        m_LODErrors.clear();
+        m_CurrentLOD = m_PreviousLOD = 0;
+        m_LODFade = 1.0f;
+        m_LODTopologyVersion = ~0u;
+    }
 
-        if (m_IsRotating)
+    void EditorLayer::DrawMeshTriangles(const MeshDraw& draw)
+    {
+        if (m_LODIndexBuffers.empty())
         {
-            // [ȸ] Pitch, Yaw Ʈ ( )
-            float rotationSpeed = 0.005f;
-            m_CameraYaw += m_MouseDelta.x * rotationSpeed;
-            m_CameraPitch += m_MouseDelta.y * rotationSpeed;
+            DrawLODLevel(draw, 0, 1.0f, 0);
+            return;
         }
-        else if (m_IsPanning)
+
+        if (m_LODFade < 1.0f)
+        {
+            // 이전 단계는 새 단계가 차지하지 않은 픽셀만 (서로 겹치거나 비는 픽셀 없음)
+            DrawLODLevel(draw, m_PreviousLOD, m_LODFade, 1);
+        }
+
+        DrawLODLevel(draw, m_CurrentLOD, m_LODFade, 0);
+    }
+
+    void EditorLayer::DrawLODLevel(const MeshDraw& draw, uint32_t level, float ditherFade, int ditherInvert)
+    {
+        if (level == 0 && !m_Meshlets.Meshlets.empty())
         {
-            // [̵] Focal Point ü ̵ (Local Axis )
-            float panSpeed = 0.005f * m_CameraDistance;
+            DrawMeshlets(draw, ditherFade, ditherInvert); // [추가] 원본 단계는 보이는 메쉬렛만
+            return;
+        }
 
-            // 1. ī޶  Basis Vector() 
-            //    (ī޶ ġ ˾ƾ    )
-            glm::vec3 position = GetCameraPosition();
+        bool original = level == 0 || level >= m_LODIndexBuffers.size();
+        DrawPacket packet;
+        packet.VertexArray = m_VertexArray;
+        packet.IndexBuffer = original ? m_IndexBuffer : m_LODIndexBuffers[level];
+        packet.Mode = DrawMode::Elements;
+        packet.IndexType = m_IndexType;
+        packet.Count = original ? (GLsizei)m_Indices.size() : m_LODIndexCounts[level];
+        AddMeshPacket(draw, packet, ditherFade, ditherInvert);
+    }
 
-            // Forward: ī޶ ٶ󺸴 
-            glm::vec3 forward = glm::normalize(m_CameraFocalPoint - position);
-            glm::vec3 worldUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    // -------------------------------------------------------------------------
+    // [9] 메쉬렛 컬링 (Meshlet Culling)
+    // -------------------------------------------------------------------------
+    void EditorLayer::UpdateMeshlets()
+    {
+        if (m_Indices.size() / 3 < MeshletMinTriangles)
+        {
+            m_Meshlets = MeshletMesh();
+            m_MeshletTopologyVersion = ~0u;
+            return;
+        }
 
-            // Right: ī޶   (Forward WorldUp )
-            glm::vec3 right = glm::normalize(glm::cross(forward, worldUp));
+        // 1. 토폴로지가 바뀌면 다시 묶고, 위치만 바뀌면 구/원뿔만 갱신
+        if (m_MeshletTopologyVersion != m_TopologyVersion)
+        {
+            m_Meshlets = MeshletBuilder::Build(m_Vertices, m_Indices);
+            UploadIndexBuffer(m_MeshletIndexBuffer, m_Meshlets.Indices);
+            m_MeshletTopologyVersion = m_TopologyVersion;
+            m_MeshletPositionVersion = m_PositionVersion;
+        }
+        else if (m_MeshletPositionVersion != m_PositionVersion)
+        {
+            MeshletBuilder::UpdateBounds(m_Vertices, m_Meshlets);
+            m_MeshletPositionVersion = m_PositionVersion;
+        }
 
-            // Up: ī޶   (Right Forward )
-            // (WorldUp ״      ̵ ̻)
-            glm::vec3 cameraUp = glm::normalize(glm::cross(right, forward));
+        // 2. 이번 프레임 카메라로 컬링 -> 그리기 명령
+        MemoryTagScope memoryTag(MemoryTag::GPUStaging);
+        // [수정] 절두체는 카메라 캐시. 원뿔 뒷면 컬링은 한 점에서 보는 원근 전용 (직교는 시선이 평행)
+        MeshletBuilder::Cull(m_Meshlets, m_Camera.GetFrustum(), m_Camera.GetPosition(), m_IsBackfaceCulling && m_Camera.IsPerspective(), m_MeshletCommands);
 
-            // 2. ̵ 
-            // 콺  巡(+X) -> ī޶ (-Right)  ü  
-            m_CameraFocalPoint -= right * m_MouseDelta.x * panSpeed;
+        if (GLAD_GL_VERSION_4_3)
+        {
+            SubmitBufferData(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer, m_MeshletCommands.size() * sizeof(DrawElementsIndirectCommand), m_MeshletCommands.data(), GL_STREAM_DRAW);
+            RenderThread::Submit([] { glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0); });
+            return;
+        }
 
-            // 콺 Ʒ 巡(+Y) -> ī޶ (+Up)  ü Ʒ 
-            // (ǥ  򰥸ٸ + / -  ݴ ٲ㺸)
-            m_CameraFocalPoint += cameraUp * m_MouseDelta.y * panSpeed;
+        // GL 4.3 미만: 명령을 개수/오프셋 배열로 풀어서 glMultiDrawElements
+        size_t indexSize = m_IndexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+        m_MeshletDrawCounts.clear();
+        m_MeshletDrawOffsets.clear();
+        for (const auto& command : m_MeshletCommands)
+        {
+            m_MeshletDrawCounts.push_back((GLsizei)command.Count);
+            m_MeshletDrawOffsets.push_back((const void*)(command.FirstIndex * indexSize));
         }
+    }
 
-        // Ÿ ʱȭ
-        m_MouseDelta = { 0.0f, 0.0f };
+    void EditorLayer::DrawMeshlets(const MeshDraw& draw, float ditherFade, int ditherInvert)
+    {
+        if (m_MeshletCommands.empty())
+            return;
+
+        DrawPacket packet;
+        packet.VertexArray = m_VertexArray;
+        packet.IndexBuffer = m_MeshletIndexBuffer;
+        packet.IndexType = m_IndexType;
+        if (GLAD_GL_VERSION_4_3)
+        {
+            packet.Mode = DrawMode::ElementsIndirect;
+            packet.IndirectBuffer = m_IndirectBuffer;
+            packet.MultiDrawCount = (GLsizei)m_MeshletCommands.size();
+        }
+        else
+        {
+            // 개수/오프셋 배열은 다음 프레임 컬링이 덮어쓰므로 명령 큐로 복사 (면, 와이어프레임이 따로 복사)
+            packet.Mode = DrawMode::MultiElements;
+            packet.MultiCount = RenderThread::CopyCommandData(m_MeshletDrawCounts.data(), m_MeshletDrawCounts.size());
+            packet.MultiOffsets = RenderThread::CopyCommandData(m_MeshletDrawOffsets.data(), m_MeshletDrawOffsets.size());
+            packet.MultiDrawCount = (GLsizei)m_MeshletDrawCounts.size();
+        }
+        AddMeshPacket(draw, packet, ditherFade, ditherInvert);
+    }
+
+    // -------------------------------------------------------------------------
+    // [10] 씬 오브젝트 (Scene Objects)
+    // -------------------------------------------------------------------------
+    void EditorLayer::PlaceObjects(bool scatter)
+    {
+        if (m_Indices.empty())
+            return;
+
+        // 1. 편집 메쉬가 그대로면 같은 씬 메쉬를 재사용 (인스턴싱으로 같이 그려짐)
+        if (m_SnapshotMesh == Scene::None || m_SnapshotTopologyVersion != m_TopologyVersion || m_SnapshotPositionVersion != m_PositionVersion)
+        {
+            m_SnapshotMesh = m_Scene.AddMesh(m_Vertices, m_Indices);
+            m_SnapshotTopologyVersion = m_TopologyVersion;
+            m_SnapshotPositionVersion = m_PositionVersion;
+        }
+
+        const SceneMesh& mesh = m_Scene.GetMesh(m_SnapshotMesh);
+        glm::vec3 size = mesh.BoundsMax - mesh.BoundsMin;
+        float spacing = std::max(std::max(size.x, size.z), 0.1f) * 1.5f;
+
+        if (!scatter)
+        {
+            // 편집 메쉬와 겹치지 않게 옆에 하나
+            glm::mat4 transform = glm::translate(glm::mat4(1.0f), m_Camera.GetFocalPoint() + glm::vec3(spacing, 0.0f, 0.0f));
+            m_Scene.SetSelected(m_SelectedObject, false);
+            m_SelectedObject = m_Scene.CreateObject(m_SnapshotMesh, transform);
+            m_Scene.SetSelected(m_SelectedObject, true);
+        }
+        else
+        {
+            // 2. 그룹 하나 아래에 격자로 배치 (그룹을 옮기면 자식 전부 따라옴)
+            Entity group = m_Scene.CreateObject(Scene::None, glm::translate(glm::mat4(1.0f), m_Camera.GetFocalPoint()));
+            for (int z = 0; z < ScatterGridSize; z++)
+            {
+                for (int x = 0; x < ScatterGridSize; x++)
+                {
+                    float yaw = (float)(((uint32_t)x * 73856093u ^ (uint32_t)z * 19349663u) % 360u);
+                    glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::vec3((x + 1) * spacing, 0.0f, (z + 1) * spacing));
+                    local = glm::rotate(local, glm::radians(yaw), glm::vec3(0.0f, 1.0f, 0.0f));
+                    m_Scene.CreateObject(m_SnapshotMesh, local, group);
+                }
+            }
+        }
+
+        MX_CORE_INFO("Scene: {0} objects, {1} meshes", m_Scene.GetObjectCount(), m_Scene.GetMeshCount());
+    }
+
+    void EditorLayer::PickObject()
+    {
+        m_Scene.Update(); // 방금 추가/이동한 오브젝트도 TLAS에 반영
+
+        float t = 0.0f;
+        m_Scene.SetSelected(m_SelectedObject, false);
+        EditorCamera::Ray ray = m_Camera.GetRay(m_MousePos);
+        m_SelectedObject = m_Scene.Raycast(ray.Origin, ray.Direction, t);
+        m_Scene.SetSelected(m_SelectedObject, true); // 선택 상태는 컴포넌트 (렌더러가 조회)
+    }
+
+    void EditorLayer::TranslateSelectedObject(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planeNormal)
+    {
+        // 점 이동과 같은 방식: 카메라를 향한 평면 위에서 마우스 이동량만큼
+        glm::vec3 planePoint = glm::vec3(m_ObjectStartTransform[3]);
+        float t = 0.0f;
+        if (!CalculatePlaneIntersection(rayOrigin, rayDir, planePoint, planeNormal, t))
+            return;
+
+        glm::vec3 currentMousePoint = rayOrigin + (rayDir * t);
+        if (!m_TranslationInit)
+        {
+            m_MouseStartDragPoint = currentMousePoint;
+            m_TranslationInit = true;
+        }
+
+        glm::vec3 delta = currentMousePoint - m_MouseStartDragPoint;
+        m_Scene.SetWorldTransform(m_SelectedObject, glm::translate(glm::mat4(1.0f), delta) * m_ObjectStartTransform);
+    }
+
+    // -------------------------------------------------------------------------
+    // [11] 모디파이어 스택 (Modifier Stack)
+    // -------------------------------------------------------------------------
+    void EditorLayer::ToggleModifier(ModifierType type)
+    {
+        if (m_Modifiers.Find(type))
+        {
+            m_Modifiers.Remove(type);
+        }
+        else
+        {
+            switch (type)
+            {
+            case ModifierType::Mirror:    m_Modifiers.Add(std::make_unique<MirrorModifier>()); break;
+            case ModifierType::Array:     m_Modifiers.Add(std::make_unique<ArrayModifier>()); break;
+            case ModifierType::Subdivide: m_Modifiers.Add(std::make_unique<SubdivideModifier>()); break;
+            case ModifierType::Solidify:  m_Modifiers.Add(std::make_unique<SolidifyModifier>()); break;
+            case ModifierType::Bevel:     m_Modifiers.Add(std::make_unique<BevelModifier>()); break;
+            }
+        }
+
+        // 현재 스택 순서 출력
+        std::string stack;
+        for (size_t i = 0; i < m_Modifiers.GetCount(); i++)
+        {
+            if (i > 0)
+                stack += " -> ";
+            stack += m_Modifiers.GetModifier(i).GetName();
+        }
+        MX_CORE_INFO("Modifiers: {0}", stack.empty() ? "(none)" : stack);
+    }
+
+    void EditorLayer::UpdateModifiers()
+    {
+        if (m_Modifiers.IsEmpty())
+        {
+            m_ModifierUploadedTopology = ~0u;
+            m_ModifierUploadedPosition = ~0u;
+            return;
+        }
+
+        // 바뀐 단계부터만 다시 계산 (정점 이동이면 BuildTopology는 건너뜀)
+        m_Modifiers.Evaluate(m_Vertices, m_Indices, m_TopologyVersion, m_PositionVersion);
+
+        const ModifierMesh& result = m_Modifiers.GetResult();
+        if (m_ModifierUploadedTopology != m_Modifiers.GetResultTopologyVersion())
+        {
+            // 토폴로지가 바뀐 경우만 버퍼 재할당 + IBO 업로드
+            SubmitBufferData(GL_ARRAY_BUFFER, m_ModifierVertexBuffer, result.Vertices.size() * sizeof(glm::vec3), result.Vertices.data(), GL_DYNAMIC_DRAW);
+
+            GLuint modifierArray = m_ModifierVertexArray, modifierIndexBuffer = m_ModifierIndexBuffer, vertexArray = m_VertexArray;
+            GLsizeiptr size = (GLsizeiptr)(result.Indices.size() * sizeof(uint32_t));
+            const uint32_t* data = RenderThread::CopyCommandData(result.Indices.data(), result.Indices.size());
+            RenderThread::Submit([=]
+            {
+                glBindVertexArray(modifierArray);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, modifierIndexBuffer);
+                GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, modifierIndexBuffer, size, data, GL_STATIC_DRAW);
+                glBindVertexArray(vertexArray);
+            });
+
+            m_ModifierUploadedTopology = m_Modifiers.GetResultTopologyVersion();
+            m_ModifierUploadedPosition = m_Modifiers.GetResultPositionVersion();
+        }
+        else if (m_ModifierUploadedPosition != m_Modifiers.GetResultPositionVersion())
+        {
+            SubmitBufferSubData(GL_ARRAY_BUFFER, m_ModifierVertexBuffer, 0, result.Vertices.size() * sizeof(glm::vec3), result.Vertices.data());
+            m_ModifierUploadedPosition = m_Modifiers.GetResultPositionVersion();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // [12] 정점 이동 / 대칭 편집 (Vertex Translation / Symmetry)
+    // -------------------------------------------------------------------------
+    void EditorLayer::BeginVertexTranslation()
+    {
+        m_TranslationIndices.clear();
+        m_TranslationScales.clear();
+        m_MultiVertexStartPositions.clear();
+        if (m_IsSymmetryEnabled)
+            UpdateSymmetryMap();
+
+        // 선택한 점은 델타 그대로, 반대편 점은 대칭 축 성분만 뒤집어서 이동
+        // 평면 위 점은 평면을 벗어나지 않게 축 성분을 고정
+        // 짝이 둘 다 선택됐으면 먼저 나온 쪽 기준으로 반사 (대칭 유지)
+        FrameVector<uint8_t> added(m_IsSymmetryEnabled ? m_Vertices.size() : 0, 0);
+        auto addTarget = [&](uint32_t index, const glm::vec3& scale)
+        {
+            m_TranslationIndices.push_back(index);
+            m_TranslationScales.push_back(scale);
+            m_MultiVertexStartPositions.push_back(m_Vertices[index]);
+        };
+
+        for (int selected : m_SelectedIndices)
+        {
+            uint32_t index = (uint32_t)selected;
+            if (!m_IsSymmetryEnabled)
+            {
+                addTarget(index, glm::vec3(1.0f));
+                continue;
+            }
+            if (added[index])
+                continue;
+
+            glm::vec3 scale(1.0f);
+            glm::vec3 mirrorScale(1.0f);
+            mirrorScale[m_SymmetryAxis] = -1.0f;
+
+            uint32_t mirror = m_Symmetry.GetMirror(index);
+            if (mirror == index)
+                scale[m_SymmetryAxis] = 0.0f;
+
+            added[index] = 1;
+            addTarget(index, scale);
+            if (mirror != SymmetryMap::None && mirror != index && !added[mirror])
+            {
+                added[mirror] = 1;
+                addTarget(mirror, mirrorScale);
+            }
+        }
+
+        // 비례 편집: 시작 위치로 반경 조회 + 가중치 계산 (드래그 중에는 다시 계산하지 않음)
+        m_TranslationSeedCount = m_TranslationIndices.size();
+        m_LastTranslationDelta = glm::vec3(0.0f);
+        if (m_IsProportionalEnabled && !m_TranslationIndices.empty())
+        {
+            m_Proportional.Begin(m_Vertices, m_TranslationIndices, m_ProportionalRadius);
+            AppendProportionalTargets();
+        }
+    }
+
+    void EditorLayer::AppendProportionalTargets()
+    {
+        // 씨앗만 남기고 반경 안 정점을 뒤에 추가 (정점은 시작 위치에 있어야 함)
+        m_TranslationIndices.resize(m_TranslationSeedCount);
+        m_TranslationScales.resize(m_TranslationSeedCount);
+        m_MultiVertexStartPositions.resize(m_TranslationSeedCount);
+
+        const auto& vertices = m_Proportional.GetVertices();
+        const auto& weights = m_Proportional.GetWeights();
+        const auto& seeds = m_Proportional.GetNearestSeeds();
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            m_TranslationIndices.push_back(vertices[i]);
+            m_TranslationScales.push_back(m_TranslationScales[seeds[i]] * weights[i]); // 대칭 쪽은 반사된 델타를 따라감
+            m_MultiVertexStartPositions.push_back(m_Vertices[vertices[i]]);
+        }
+    }
+
+    void EditorLayer::SetProportionalRadius(float radius)
+    {
+        m_ProportionalRadius = std::max(radius, 1e-3f);
+        if (m_TranslationSeedCount == 0)
+            return;
+
+        // 반경을 벗어나는 정점이 제자리로 돌아가도록 전부 시작 위치로 되돌린 뒤 다시 적용
+        ApplyVertexTranslation(glm::vec3(0.0f));
+        m_Proportional.SetRadius(m_ProportionalRadius);
+        AppendProportionalTargets();
+        ApplyVertexTranslation(m_LastTranslationDelta);
+        MX_CORE_INFO("Proportional radius {0:.3f} ({1} vertices)", m_ProportionalRadius, m_TranslationIndices.size() - m_TranslationSeedCount);
+    }
+
+    void EditorLayer::ApplyVertexTranslation(const glm::vec3& delta)
+    {
+        // 시작 위치 + 델타 * 배율: 대칭 정점도 배율만 다를 뿐 같은 루프 (병렬, SIMD)
+        // m_Vertices와 SoA 사본을 같이 써서 사본을 다시 복사하지 않아도 되게 함
+        SyncPositionStore();
+        const uint32_t* indices = m_TranslationIndices.data();
+        const glm::vec3* starts = m_MultiVertexStartPositions.data();
+        const glm::vec3* scales = m_TranslationScales.data();
+        glm::vec3* vertices = m_Vertices.data();
+        PositionStore* store = &m_PositionStore;
+
+        JobContext context;
+        JobSystem::Dispatch(context, (uint32_t)m_TranslationIndices.size(), TranslationJobGroupSize, [=](uint32_t begin, uint32_t end)
+        {
+            PositionKernels::TranslateSubset(*store, vertices, indices + begin, starts + begin, scales + begin, end - begin, delta);
+        });
+        JobSystem::Wait(context);
+
+        for (uint32_t index : m_TranslationIndices)
+            m_Normals.MarkDirty(index); // 이 점에 닿은 면만 법선 재계산
+
+        // 대칭 이동은 짝 관계를 깨지 않으므로 표를 다시 만들 필요 없음
+        // (비례 편집 가중치는 양쪽이 같다는 보장이 없으므로 제외)
+        bool symmetryCurrent = m_IsSymmetryEnabled && !m_IsProportionalEnabled && m_SymmetryPositionVersion == m_PositionVersion;
+        m_PositionVersion++; // 세분화 곡면은 위치만 다시 계산
+        if (symmetryCurrent)
+            m_SymmetryPositionVersion = m_PositionVersion;
+        m_PositionStorePositionVersion = m_PositionVersion;
+    }
+
+    void EditorLayer::SyncPositionStore()
+    {
+        if (m_PositionStoreTopologyVersion == m_TopologyVersion && m_PositionStorePositionVersion == m_PositionVersion
+            && m_PositionStore.GetCount() == m_Vertices.size())
+            return;
+
+        m_PositionStore.Assign(m_Vertices);
+        m_PositionStoreTopologyVersion = m_TopologyVersion;
+        m_PositionStorePositionVersion = m_PositionVersion;
+    }
+
+    void EditorLayer::UpdateSymmetryMap()
+    {
+        if (m_SymmetryTopologyVersion == m_TopologyVersion && m_SymmetryPositionVersion == m_PositionVersion
+            && m_Symmetry.GetAxis() == m_SymmetryAxis)
+            return;
+
+        SyncPositionStore();
+        glm::vec3 minPos, maxPos;
+        PositionKernels::BoundingBox(m_PositionStore, minPos, maxPos);
+        float tolerance = m_Vertices.empty() ? 1e-4f : std::max(glm::length(maxPos - minPos) * SymmetryRelativeTolerance, 1e-6f);
+
+        auto start = std::chrono::steady_clock::now();
+        m_Symmetry.Build(m_Vertices, m_SymmetryAxis, tolerance);
+        float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        MX_CORE_INFO("Symmetry map: {0}/{1} vertices paired ({2:.2f} ms)", m_Symmetry.GetPairedCount(), m_Vertices.size(), ms);
+
+        m_SymmetryTopologyVersion = m_TopologyVersion;
+        m_SymmetryPositionVersion = m_PositionVersion;
+    }
+
+    // -------------------------------------------------------------------------
+    // [13] 수학 및 기타 헬퍼 (Math Helpers)
+    // -------------------------------------------------------------------------
+    bool EditorLayer::CalculatePlaneIntersection(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planePoint, const glm::vec3& planeNormal, float& t)
+    {
+        float denom = glm::dot(planeNormal, rayDir);
+        if (abs(denom) > 1e-6)
+        {
+            glm::vec3 p0l0 = planePoint - rayOrigin;
+            t = glm::dot(p0l0, planeNormal) / denom;
+            return (t >= 0);
+        }
+        return false;
     }
-    glm::vec3 EditorLayer::GetCameraPosition()
+
+    void EditorLayer::UpdateCameraControl()
     {
-        glm::vec3 position;
-        position.x = m_CameraFocalPoint.x + m_CameraDistance * sin(m_CameraYaw) * cos(m_CameraPitch);
-        position.y = m_CameraFocalPoint.y + m_CameraDistance * sin(m_CameraPitch);
-        position.z = m_CameraFocalPoint.z + m_CameraDistance * cos(m_CameraYaw) * cos(m_CameraPitch);
-        return position;
+        // 델타값이 너무 튀지 않게 확인
+        if (glm::length(m_MouseDelta) > 100.0f) { m_MouseDelta = { 0,0 }; return; }
+
+        // [수정] 회전/이동 계산은 카메라로 (이동 축은 캐시된 뷰 행렬에서)
+        if (m_IsRotating)
+        {
+            m_Camera.Orbit(m_MouseDelta);
+        }
+        else if (m_IsPanning)
+        {
+            m_Camera.Pan(m_MouseDelta);
+        }
+
+        // 델타 초기화
+        m_MouseDelta = { 0.0f, 0.0f };
     }
 }
\ No newline at end of file
@@ -1,9 +1,23 @@
 #pragma once
 
 #include "Mixer/Layer.h"
+#include "EditorCamera.h"
 #include "EditorGrid.h"
+#include "SceneRenderer.h"
+#include "Mixer/Mesh/MeshNormals.h"
+#include "Mixer/Mesh/Subdivision.h"
+#include "Mixer/Mesh/MeshSimplifier.h"
+#include "Mixer/Mesh/MeshLOD.h"
+#include "Mixer/Mesh/Meshlet.h"
+#include "Mixer/Mesh/ModifierStack.h"
+#include "Mixer/Mesh/SymmetryMap.h"
+#include "Mixer/Mesh/ProportionalEdit.h"
+#include "Mixer/Mesh/PositionKernels.h"
+#include "Mixer/Renderer/CommandBucket.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
 #include <glad/glad.h>
 #include <glm/glm.hpp>
+#include <chrono>
 
 namespace Mixer {
 	class EditorLayer : public Layer
@@ -18,73 +32,199 @@ namespace Mixer {
 		virtual void OnEvent(Event& e) override;
 
 	private:
-		GLuint m_ShaderProgram;
+		ShaderHandle m_Shader; // [수정] assets/shaders/Mesh.* (프로그램은 그릴 때마다 GetProgram)
 		GLuint m_VertexArray;
 		GLuint m_VertexBuffer;
-		GLuint m_IndexBuffer; // [߰] ε  ID
+		GLuint m_IndexBuffer; // [추가] 인덱스 버퍼 ID
 
-		// [ٽ ]
-		glm::mat4 m_ViewProjection;
+		// [핵심 데이터]
+		std::string m_DocumentName = "Untitled"; // [추가] 내보내기 파일 이름 (<이름>.obj)
 		glm::vec2 m_MousePos = { 0.0f, 0.0f };
-		glm::vec2 m_MouseDelta = { 0.0f, 0.0f }; // ̹  콺 ̵
-		std::vector<glm::vec3> m_Vertices; //    
-		std::vector<uint32_t> m_Indices; // [߰]    (0, 1, 2 ...)
+		glm::vec2 m_MouseDelta = { 0.0f, 0.0f }; // 이번 프레임의 마우스 이동량
+		std::vector<glm::vec3> m_Vertices; // 실제 정점 데이터 저장소
+		std::vector<uint32_t> m_Indices; // [추가] 정점 연결 순서 (0, 1, 2 ...)
 		std::vector<uint32_t> m_EdgeIndices;
 		GLuint m_EdgeIndexBuffer;
 
-		// []    ()
+		// [추가] 정점 수가 65535 이하이면 16비트 인덱스로 업로드
+		GLenum m_IndexType = GL_UNSIGNED_INT;
+
+		// [추가] 법선 (움직인 정점 주변만 다시 계산) + 조명 모드 (Z키 토글)
+		MeshNormals m_Normals;
+		GLuint m_NormalBuffer;
+		bool m_IsLitShading = true;
+
+		// [추가] 세분화 곡면 미리보기 (Ctrl+1~3: Catmull-Clark, Ctrl+Shift+1~3: Loop, Ctrl+0: 끄기)
+		// 토폴로지 버전이 바뀔 때만 Stencil 표/IBO 재생성, 위치 버전이 바뀌면 표 곱셈만 다시 함
+		SubdivisionSurface m_Subdivision;
+		GLuint m_SubdivVertexArray;
+		GLuint m_SubdivVertexBuffer;
+		GLuint m_SubdivIndexBuffer;
+		uint32_t m_TopologyVersion = 0;
+		uint32_t m_PositionVersion = 0;
+		uint32_t m_UploadedTopologyVersion = ~0u; // [추가] 편집 메쉬 VBO/IBO를 올린 버전 (같으면 업로드 생략)
+		uint32_t m_UploadedPositionVersion = ~0u;
+		uint32_t m_SubdivTopologyVersion = ~0u;
+		uint32_t m_SubdivPositionVersion = ~0u;
+		uint32_t m_SubdivUploadedLevel = ~0u;
+
+		// [추가] 메쉬 단순화 (Ctrl+D: 삼각형 절반으로, 백그라운드 작업)
+		// 작업 중에 토폴로지가 바뀌면 결과는 버림
+		SimplifyTask m_SimplifyTask;
+		uint32_t m_SimplifyTopologyVersion = 0;
+		int m_SimplifyReportedStep = 0;
+
+		// [추가] LOD (무거운 메쉬만). 단순화 단계를 백그라운드로 만들고 화면 오차로 단계 선택
+		// 단계가 바뀌면 디더링으로 교차 전환 (튀는 현상 방지)
+		LODBuildTask m_LODTask;
+		std::vector<GLuint> m_LODIndexBuffers;  // [0]은 사용 안 함 (원본 = m_IndexBuffer)
+		std::vector<GLsizei> m_LODIndexCounts;
+		std::vector<float> m_LODErrors;
+		uint32_t m_LODTopologyVersion = ~0u;    // 현재 LOD 버퍼가 만들어진 버전
+		uint32_t m_LODPositionVersion = ~0u;
+		uint32_t m_LODBuildTopologyVersion = 0; // 생성 중인 작업의 버전
+		uint32_t m_LODBuildPositionVersion = 0;
+		uint32_t m_CurrentLOD = 0;
+		uint32_t m_PreviousLOD = 0;
+		float m_LODFade = 1.0f;                 // 1 = 전환 완료
+		std::chrono::steady_clock::time_point m_LastLODUpdate;
+
+		// [추가] 바운딩 구 (LOD 화면 오차, 정점 밀도 계산용)
+		glm::vec3 m_BoundsCenter = { 0.0f, 0.0f, 0.0f };
+		float m_BoundsRadius = 0.0f;
+		uint32_t m_BoundsTopologyVersion = ~0u;
+		uint32_t m_BoundsPositionVersion = ~0u;
+		bool m_ShowAllVertexPoints = true;      // 화면에 점이 너무 빽빽하면 선택/Hover 점만 그림
+
+		// [추가] 메쉬렛 컬링 (무거운 메쉬를 원본 단계로 그릴 때 화면 밖/뒷면 묶음은 건너뜀)
+		MeshletMesh m_Meshlets;
+		GLuint m_MeshletIndexBuffer;
+		GLuint m_IndirectBuffer;
+		std::vector<DrawElementsIndirectCommand> m_MeshletCommands;
+		std::vector<GLsizei> m_MeshletDrawCounts;       // GL 4.3 미만: glMultiDrawElements용
+		std::vector<const void*> m_MeshletDrawOffsets;
+		uint32_t m_MeshletTopologyVersion = ~0u;
+		uint32_t m_MeshletPositionVersion = ~0u;
+		bool m_IsBackfaceCulling = false;               // B키 토글 (켜면 법선 원뿔 컬링도 사용)
+
+		// [추가] 씬 오브젝트 (Shift+A: 현재 메쉬를 오브젝트로 배치, Ctrl+Shift+A: 100x100 배치)
+		// 같은 메쉬를 쓰는 오브젝트는 인스턴싱으로 한 번에 그리고, 클릭 선택은 TLAS로 찾음
+		Scene m_Scene;
+		SceneRenderer m_SceneRenderer;
+		Entity m_SelectedObject = NullEntity;
+		uint32_t m_SnapshotMesh = Scene::None;   // 편집 메쉬를 복사한 씬 메쉬 (안 바뀌었으면 재사용 -> 인스턴싱)
+		uint32_t m_SnapshotTopologyVersion = ~0u;
+		uint32_t m_SnapshotPositionVersion = ~0u;
+		glm::mat4 m_ObjectStartTransform;        // 오브젝트 G 이동 취소용
+
+		// [추가] 모디파이어 스택 (Shift+1~5: Mirror/Array/Subdivide/Solidify/Bevel 켜기/끄기, Shift+0: 전부 제거)
+		// 편집 메쉬는 그대로 두고 결과만 그림. 정점만 움직이면 단계별로 위치만 다시 계산
+		ModifierStack m_Modifiers;
+		GLuint m_ModifierVertexArray;
+		GLuint m_ModifierVertexBuffer;
+		GLuint m_ModifierIndexBuffer;
+		uint32_t m_ModifierUploadedTopology = ~0u;
+		uint32_t m_ModifierUploadedPosition = ~0u;
+
+		// [상수] 자주 쓰는 각도 (라디안)
 		const float PI = 3.1415926535f;
 		const float HALF_PI = 1.5707963267f;
 
-		// [ȣۿ ]
-		int m_HoveredIndex = -1;  // 콺 ö 
-		//int m_SelectedIndex = -1; // Ŭؼ õ  (̵ )
-		std::vector<int> m_SelectedIndices; // õ  ε 
-		bool m_IsRotating = false; //  Ŭ ΰ?
-		bool m_IsPanning = false;  // Shift +  Ŭ ΰ? (Key Event Shift  üũ ʿ)
+		// [상호작용 상태]
+		int m_HoveredIndex = -1;  // 마우스가 올라간 점
+		//int m_SelectedIndex = -1; // 클릭해서 선택된 점 (이동 대상)
+		std::vector<int> m_SelectedIndices; // 선택된 점들의 인덱스 목록
+		bool m_IsRotating = false; // 휠 클릭 중인가?
+		bool m_IsPanning = false;  // Shift + 휠 클릭 중인가? (Key Event로 Shift 상태 체크 필요)
 		bool m_IsShiftPressed = false;
-		bool m_IsCtrlPressed = false; // [߰] Ctrl Ű 
-		//bool m_IsDragging = false; //  巡 ΰ?
-
-		// [GŰ ̵   ]
-		bool m_IsTranslationMode = false;     //  'G'Ű  ̵ ΰ?
-		//glm::vec3 m_VertexStartPos;           // ̵     ġ (ҿ)
-		std::vector<glm::vec3> m_MultiVertexStartPositions; // õ   ġ 
-		glm::vec3 m_MouseStartDragPoint;      // ̵   콺-  (Ÿ )
-		bool m_TranslationInit = false; // [߰] ̵  ʱȭ Ǿ°?
-
-		// [ī޶  ]
-        glm::vec3 m_CameraFocalPoint = { 0.0f, 0.0f, 0.0f }; // ī޶ ٶ󺸴 ߽ (Target)
-        float m_CameraDistance = 5.0f; // ߽ ī޶  Ÿ
-        
-        // ȸ  (Radians)
-        float m_CameraPitch = 0.0f; //  ȸ (X )
-        float m_CameraYaw = 0.0f; // ¿ ȸ (Y )
-
-        // 콺 Ÿ 
-        glm::vec2 m_LastMousePos = { 0.0f, 0.0f }; //   콺 ġ
-
-		// [ ׸]
+		bool m_IsCtrlPressed = false; // [추가] Ctrl 키 상태
+		//bool m_IsDragging = false; // 현재 드래그 중인가?
+
+		// [G키 이동 모드 관련 변수]
+		bool m_IsTranslationMode = false;     // 현재 'G'키를 눌러 이동 중인가?
+		//glm::vec3 m_VertexStartPos;           // 이동 시작 전 정점의 원래 위치 (취소용)
+		std::vector<glm::vec3> m_MultiVertexStartPositions; // 선택된 점들의 원래 위치 목록
+		glm::vec3 m_MouseStartDragPoint;      // 이동 시작 시점의 마우스-평면 교차점 (델타 계산용)
+		bool m_TranslationInit = false; // [추가] 이동 모드 초기화가 되었는가?
+		// [추가] 실제 이동 대상 (선택 + 대칭 정점). 새 위치 = m_MultiVertexStartPositions[i] + 델타 * m_TranslationScales[i]
+		std::vector<uint32_t> m_TranslationIndices;
+		std::vector<glm::vec3> m_TranslationScales;
+
+		// [추가] 대칭 편집 (X: 켜기/끄기, Shift+X: 축 변경)
+		// 드래그 시작 시 대칭 표가 낡았으면 다시 만들고, 반대편 정점은 반사 배율로 같은 루프에서 이동
+		SymmetryMap m_Symmetry;
+		bool m_IsSymmetryEnabled = false;
+		int m_SymmetryAxis = 0;
+		uint32_t m_SymmetryTopologyVersion = ~0u;
+		uint32_t m_SymmetryPositionVersion = ~0u; // 대칭 이동은 대칭을 유지하므로 같이 갱신
+
+		// [추가] 비례 편집 (O: 켜기/끄기, 이동 중 휠: 반경 조절)
+		// 이동 대상 [0, m_TranslationSeedCount)는 선택(+대칭) 정점, 그 뒤는 반경 안 정점 (배율 = 감쇠 x 가까운 씨앗 배율)
+		ProportionalEdit m_Proportional;
+		bool m_IsProportionalEnabled = false;
+		float m_ProportionalRadius = 1.0f;
+		size_t m_TranslationSeedCount = 0;
+		glm::vec3 m_LastTranslationDelta = { 0.0f, 0.0f, 0.0f };
+
+		// [추가] 위치 SoA 사본 (8개씩 블록). hover 검사, 바운딩 박스처럼 전체를 도는 루프는 여기서 SIMD로
+		// 버전이 바뀌면 통째로 다시 복사, 정점 이동은 m_Vertices와 함께 갱신해서 복사 생략
+		PositionStore m_PositionStore;
+		uint32_t m_PositionStoreTopologyVersion = ~0u;
+		uint32_t m_PositionStorePositionVersion = ~0u;
+
+		// [수정] 카메라 (행렬/역행렬/절두체는 값이 바뀐 프레임에만 다시 계산)
+		EditorCamera m_Camera;
+
+        // 마우스 델타 계산용
+        glm::vec2 m_LastMousePos = { 0.0f, 0.0f }; // 이전 프레임 마우스 위치
+
+		// [에디터 그리드]
 		EditorGrid m_GridSystem;
 
 	private:
-		// --- [  и] ---
-		void CreateGraphicsPipeline();  // VAO, VBO, Shader 
-		void UpdateCamera(float width, float height); // ī޶  
-		void HandleInteraction();       // Raycasting  ̵  ó
-		void RenderScene();             //  ׸  (Draw Calls)
-		void UpdateCameraControl();		// ī޶ ̵ 
-		
-		// --- [ Լ] ---
-		glm::vec3 GetRayFromMouse();
-		bool CalculatePlaneIntersection(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planePoint, const glm::vec3& planeNormal, float& t);
-		glm::vec3 GetCameraPosition();
+		// [추가] 편집 메쉬 그리기 패킷 공통 정보 (AddMeshPacket이 셰이더 유니폼으로 풀어 실음)
+		struct MeshDraw
+		{
+			RenderPass Pass;
+			uint32_t State;  // RenderStateFlags
+			uint32_t Depth;  // SortKey::Depth
+			glm::vec4 Color;
+			int Lit;         // 0 = 단색, 1 = 정점 법선 조명, 2 = 면 법선(화면 미분) 조명
+		};
 
-		// ̴ 
-		void CheckShaderError(GLuint shader, const char* type);
-		void CheckProgramError(GLuint program);
-		const char* GetVertexShaderSource();
-		const char* GetFragmentShaderSource();
+		// --- [내부 로직 분리] ---
+		void CreateGraphicsPipeline();  // VAO, VBO 생성
+		void HandleInteraction();       // Raycasting 및 이동 로직 처리
+		void RenderScene();             // 실제 그리기 명령 (Draw Calls)
+		void UpdateCameraControl();		// 카메라 이동 조작
+		void OptimizeMesh();            // 미사용 정점 제거 + 캐시 최적화 (Ctrl+O)
+		void ExportMesh(const std::string& path); // 최적화한 사본을 OBJ로 내보내기 (Ctrl+S, 이미 있는 파일이면 실패)
+		void UploadIndexBuffer(GLuint buffer, const std::vector<uint32_t>& indices);
+		void SetSubdivision(SubdivisionScheme scheme, uint32_t level);
+		void UpdateSubdivision();       // 바뀐 버전만 다시 계산 + 업로드
+		void StartSimplify();
+		void PollSimplify();            // 진행률 로그, 끝났으면 결과 적용
+		void UpdateLOD();               // LOD 생성/업로드, 단계 선택, 점 표시 여부
+		void ReleaseLODBuffers();
+		void DrawMeshTriangles(const MeshDraw& draw); // 현재 LOD 단계로 삼각형 그리기 (전환 중이면 두 단계)
+		void DrawLODLevel(const MeshDraw& draw, uint32_t level, float ditherFade, int ditherInvert);
+		void UpdateMeshlets();          // 생성/바운딩 갱신 + 이번 프레임 컬링
+		void DrawMeshlets(const MeshDraw& draw, float ditherFade, int ditherInvert);
+		void AddMeshPacket(const MeshDraw& draw, DrawPacket packet, float ditherFade = 1.0f, int ditherInvert = 0);
+		void PlaceObjects(bool scatter); // 편집 메쉬를 씬 오브젝트로 배치
+		void PickObject();               // 마우스 광선으로 오브젝트 선택
+		void TranslateSelectedObject(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planeNormal);
+		void ToggleModifier(ModifierType type);
+		void BeginVertexTranslation();   // 이동 대상/시작 위치 준비 (G, E 공통)
+		void ApplyVertexTranslation(const glm::vec3& delta); // 델타 0 = 취소 (시작 위치로)
+		void UpdateSymmetryMap();
+		void AppendProportionalTargets(); // 이동 대상 뒤쪽을 현재 반경 안 정점으로 교체
+		void SetProportionalRadius(float radius);
+		void SyncPositionStore();
+		void UpdateModifiers();          // 스택 평가 + 바뀐 버퍼만 업로드
+
+		// --- [헬퍼 함수] ---
+		bool CalculatePlaneIntersection(const glm::vec3& rayOrigin, const glm::vec3& rayDir, const glm::vec3& planePoint, const glm::vec3& planeNormal, float& t);
 		
 	};
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include "Mixer/MemoryTracker.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include <glad/glad.h>
+#include <cstring>
+
+namespace Mixer {
+
+    // [신규] glBufferData + GPU 메모리 사용량 기록 (buffer = target에 바인딩되어 있는 버퍼)
+    inline void GpuBufferData(GLenum target, GLuint buffer, GLsizeiptr size, const void* data, GLenum usage)
+    {
+        glBufferData(target, size, data, usage);
+        MemoryTracker::SetGPUBufferSize(buffer, (size_t)size);
+    }
+
+    inline void GpuDeleteBuffers(GLsizei count, const GLuint* buffers)
+    {
+        for (GLsizei i = 0; i < count; i++)
+            MemoryTracker::ReleaseGPUBuffer(buffers[i]);
+        glDeleteBuffers(count, buffers);
+    }
+
+    // [추가] 렌더 스레드로 업로드. data는 명령 큐로 복사되므로 호출 직후 원본을 바꿔도 됨
+    inline void SubmitBufferData(GLenum target, GLuint buffer, GLsizeiptr size, const void* data, GLenum usage)
+    {
+        void* copy = nullptr;
+        if (data && size > 0)
+        {
+            copy = RenderThread::AllocateCommandData((size_t)size);
+            std::memcpy(copy, data, (size_t)size);
+        }
+        RenderThread::Submit([=]
+        {
+            glBindBuffer(target, buffer);
+            GpuBufferData(target, buffer, size, copy, usage);
+        });
+    }
+
+    inline void SubmitBufferSubData(GLenum target, GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data)
+    {
+        if (size <= 0)
+            return;
+        void* copy = RenderThread::AllocateCommandData((size_t)size);
+        std::memcpy(copy, data, (size_t)size);
+        RenderThread::Submit([=]
+        {
+            glBindBuffer(target, buffer);
+            glBufferSubData(target, offset, size, copy);
+        });
+    }
+
+    // [추가] 먼저 제출된 그리기 명령이 실행된 뒤에 삭제
+    inline void SubmitDeleteBuffer(GLuint buffer)
+    {
+        RenderThread::Submit([buffer] { GpuDeleteBuffers(1, &buffer); });
+    }
+}
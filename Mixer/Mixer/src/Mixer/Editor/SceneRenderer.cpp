@@ -0,0 +1,165 @@
+#include "SceneRenderer.h"
+#include <cstddef>
+#include "Mixer/Log.h"
+#include "Mixer/JobSystem.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/CommandBucket.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
+#include "GpuBuffer.h"
+#include "Mixer/Mesh/MeshNormals.h"
+#include "Mixer/Mesh/Frustum.h"
+
+namespace Mixer {
+
+    void SceneRenderer::Init()
+    {
+        // [수정] 셰이더는 assets/shaders/Instanced.* (인스턴스 속성: 2~5 = 모델 행렬, 6 = 선택 여부)
+        m_Shader = ShaderLibrary::Load("Instanced");
+    }
+
+    void SceneRenderer::UploadMesh(const SceneMesh& mesh)
+    {
+        MeshBuffers buffers;
+        buffers.IndexCount = (GLsizei)mesh.Indices.size();
+
+        MeshNormals normals;
+        normals.Update(mesh.Vertices, mesh.Indices);
+
+        glGenVertexArrays(1, &buffers.VAO);
+        glBindVertexArray(buffers.VAO);
+
+        glGenBuffers(1, &buffers.VBO);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers.VBO);
+        GpuBufferData(GL_ARRAY_BUFFER, buffers.VBO, mesh.Vertices.size() * sizeof(glm::vec3), mesh.Vertices.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
+        glGenBuffers(1, &buffers.NormalBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers.NormalBuffer);
+        GpuBufferData(GL_ARRAY_BUFFER, buffers.NormalBuffer, normals.GetVertexNormals().size() * sizeof(glm::vec3), normals.GetVertexNormals().data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
+        glGenBuffers(1, &buffers.IBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.IBO);
+        GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, buffers.IBO, mesh.Indices.size() * sizeof(uint32_t), mesh.Indices.data(), GL_STATIC_DRAW);
+
+        // 인스턴스 버퍼 (Divisor 1: 인스턴스마다 한 번씩 진행)
+        glGenBuffers(1, &buffers.InstanceBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers.InstanceBuffer);
+        GpuBufferData(GL_ARRAY_BUFFER, buffers.InstanceBuffer, 0, nullptr, GL_STREAM_DRAW);
+        for (int column = 0; column < 4; column++)
+        {
+            glEnableVertexAttribArray(2 + column);
+            glVertexAttribPointer(2 + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(sizeof(glm::vec4) * column));
+            glVertexAttribDivisor(2 + column, 1);
+        }
+        glEnableVertexAttribArray(6);
+        glVertexAttribIPointer(6, 1, GL_UNSIGNED_INT, sizeof(InstanceData), (void*)offsetof(InstanceData, Selected));
+        glVertexAttribDivisor(6, 1);
+
+        glBindVertexArray(0);
+        m_MeshBuffers.push_back(buffers);
+    }
+
+    void SceneRenderer::BuildInstances(const Scene& scene, const glm::mat4& viewProjection)
+    {
+        MemoryTagScope memoryTag(MemoryTag::GPUStaging); // [추가] 인스턴스 배열은 업로드용
+        const Registry& registry = scene.GetRegistry();
+        Frustum frustum = Frustum::FromMatrix(viewProjection);
+
+        // 1. 절두체 컬링 (병렬, Bounds 컬럼만 읽음)
+        m_Visible.assign(scene.GetSlotCount(), 0);
+        registry.ParallelEach<BoundsComponent>([&](Entity, const BoundsComponent& bounds)
+        {
+            if (bounds.Slot >= m_Visible.size())
+                return;
+            glm::vec3 center = (bounds.Min + bounds.Max) * 0.5f;
+            float radius = glm::length(bounds.Max - bounds.Min) * 0.5f;
+            m_Visible[bounds.Slot] = frustum.IntersectsSphere(center, radius) ? 1 : 0;
+        });
+
+        // 2. 메쉬별로 모음
+        m_Instances.resize(scene.GetMeshCount());
+        for (auto& instances : m_Instances)
+            instances.clear();
+
+        m_VisibleCount = 0;
+        registry.Each<TransformComponent, MeshComponent, BoundsComponent>([&](Entity entity, const TransformComponent& transform, const MeshComponent& mesh, const BoundsComponent& bounds)
+        {
+            if (bounds.Slot >= m_Visible.size() || !m_Visible[bounds.Slot])
+                return;
+            m_Instances[mesh.Mesh].push_back({ transform.World, registry.Has<SelectedComponent>(entity) ? 1u : 0u });
+            m_VisibleCount++;
+        });
+
+        // 3. 업로드 (명령 큐로 복사)
+        for (size_t mesh = 0; mesh < m_Instances.size(); mesh++)
+            SubmitBufferData(GL_ARRAY_BUFFER, m_MeshBuffers[mesh].InstanceBuffer, m_Instances[mesh].size() * sizeof(InstanceData), m_Instances[mesh].data(), GL_STREAM_DRAW);
+    }
+
+    void SceneRenderer::Render(const Scene& scene, const glm::mat4& viewProjection, const glm::vec3& lightDir)
+    {
+        if (scene.GetObjectCount() == 0)
+            return;
+
+        // [추가] 처음 그릴 때 셰이더 생성 (시작 시간 단축: 빈 씬이면 안 만듦)
+        if (!m_Shader.IsValid())
+            Init();
+
+        // 1. 새 메쉬 업로드 (메쉬는 추가만 되고 바뀌지 않음)
+        // [수정] VAO 이름이 바로 필요하므로 렌더 스레드에서 만들고 대기 (메쉬가 추가된 프레임만)
+        if (m_MeshBuffers.size() < scene.GetMeshCount())
+        {
+            RenderThread::ExecuteNow([&]
+            {
+                while (m_MeshBuffers.size() < scene.GetMeshCount())
+                    UploadMesh(scene.GetMesh((uint32_t)m_MeshBuffers.size()));
+            });
+        }
+
+        // 2. 씬이나 카메라가 바뀌었을 때만 인스턴스 재구성
+        if (m_InstanceSceneVersion != scene.GetVersion() || m_InstanceViewProjection != viewProjection)
+        {
+            BuildInstances(scene, viewProjection);
+            m_InstanceSceneVersion = scene.GetVersion();
+            m_InstanceViewProjection = viewProjection;
+        }
+
+        // 3. 메쉬마다 한 번씩 그림 (메쉬당 그리기 패킷 하나, 불투명 패스)
+        DrawPacket packet;
+        packet.Program = ShaderLibrary::GetProgram(m_Shader); // [수정] 다시 컴파일되면 바뀜
+        packet.State = RenderStateDepthTest;
+        packet.Mode = DrawMode::Elements;
+        uint64_t key = SortKey::Make(RenderPass::Opaque, packet.Program, packet.State);
+        for (size_t mesh = 0; mesh < m_Instances.size(); mesh++)
+        {
+            if (m_Instances[mesh].empty())
+                continue;
+            packet.VertexArray = m_MeshBuffers[mesh].VAO;
+            packet.IndexBuffer = m_MeshBuffers[mesh].IBO;
+            packet.Count = m_MeshBuffers[mesh].IndexCount;
+            packet.InstanceCount = (GLsizei)m_Instances[mesh].size();
+            CommandBucket::Add(key, packet, { { "u_ViewProjection", viewProjection }, { "u_LightDir", lightDir } });
+        }
+    }
+
+    void SceneRenderer::Shutdown()
+    {
+        // [수정] 렌더 스레드에서 삭제 (목록은 통째로 넘김)
+        RenderThread::Submit([meshBuffers = std::move(m_MeshBuffers)]
+        {
+            for (const auto& buffers : meshBuffers)
+            {
+                glDeleteVertexArrays(1, &buffers.VAO);
+                GpuDeleteBuffers(1, &buffers.VBO);
+                GpuDeleteBuffers(1, &buffers.NormalBuffer);
+                GpuDeleteBuffers(1, &buffers.IBO);
+                GpuDeleteBuffers(1, &buffers.InstanceBuffer);
+            }
+        });
+        m_MeshBuffers.clear();
+        ShaderLibrary::Release(m_Shader);
+        m_Shader = ShaderHandle();
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Mixer/Scene/Scene.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Mixer {
+
+    // 씬 오브젝트를 메쉬별 인스턴싱으로 그림 (메쉬 하나당 Draw Call 하나)
+    class SceneRenderer
+    {
+    public:
+        SceneRenderer() = default;
+        ~SceneRenderer() = default;
+
+        void Init();  // 인스턴싱 셰이더 로드 (첫 오브젝트가 생길 때 Render가 부름)
+        void Render(const Scene& scene, const glm::mat4& viewProjection, const glm::vec3& lightDir);
+        void Shutdown(); // 자원 해제
+
+        size_t GetVisibleCount() const { return m_VisibleCount; }
+
+    private:
+        struct InstanceData
+        {
+            glm::mat4 Model;
+            uint32_t Selected; // SelectedComponent가 있으면 1 (강조)
+        };
+
+        struct MeshBuffers
+        {
+            GLuint VAO = 0;
+            GLuint VBO = 0;
+            GLuint NormalBuffer = 0;
+            GLuint IBO = 0;
+            GLuint InstanceBuffer = 0;
+            GLsizei IndexCount = 0;
+        };
+
+        void UploadMesh(const SceneMesh& mesh); // 새로 추가된 메쉬만
+        void BuildInstances(const Scene& scene, const glm::mat4& viewProjection); // 절두체 컬링 + 메쉬별로 모음
+
+    private:
+        ShaderHandle m_Shader; // [수정] 빈 씬이면 로드 안 함 (시작 시간 단축)
+        std::vector<MeshBuffers> m_MeshBuffers;
+        std::vector<std::vector<InstanceData>> m_Instances; // 메쉬별 보이는 인스턴스
+        std::vector<uint8_t> m_Visible;                     // BoundsComponent::Slot 번호
+        size_t m_VisibleCount = 0;
+
+        // 씬도 카메라도 그대로면 인스턴스 버퍼 재사용
+        uint32_t m_InstanceSceneVersion = ~0u;
+        glm::mat4 m_InstanceViewProjection = glm::mat4(0.0f);
+    };
+}
@@ -1,51 +1,13 @@
 #include "Texture.h"
-#include "stb_image.h" //  ּ
-#include <iostream>
 
 namespace Mixer {
     Texture::Texture(const std::string& path)
-        : m_FilePath(path), m_LocalBuffer(nullptr), m_Width(0), m_Height(0), m_BPP(0)
+        : m_Handle(TextureManager::Load(path)), m_FilePath(path)
     {
-        // ̹ Ʒ  ε (OpenGL ǥ Ư ʿ)
-        stbi_set_flip_vertically_on_load(1);
-
-        m_LocalBuffer = stbi_load(path.c_str(), &m_Width, &m_Height, &m_BPP, 4); // RGBA = 4 channels
-
-        glGenTextures(1, &m_RendererID);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
-
-        // ؽó Ķ  (ʼ)
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-        if (m_LocalBuffer)
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Width, m_Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_LocalBuffer);
-            glGenerateMipmap(GL_TEXTURE_2D);
-        }
-        else
-        {
-            std::cout << "Failed to load texture: " << path << std::endl;
-        }
-
-        stbi_image_free(m_LocalBuffer);
     }
 
     Texture::~Texture()
     {
-        glDeleteTextures(1, &m_RendererID);
-    }
-
-    void Texture::Bind(unsigned int slot) const
-    {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
-    }
-
-    void Texture::Unbind() const
-    {
-        glBindTexture(GL_TEXTURE_2D, 0);
+        TextureManager::Release(m_Handle); // 마지막 참조면 렌더 스레드에서 삭제
     }
-}
\ No newline at end of file
+}
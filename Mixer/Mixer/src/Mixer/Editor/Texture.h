@@ -1,24 +1,28 @@
 #pragma once
+#include "Mixer/Renderer/TextureManager.h"
 #include <string>
 #include <glad/glad.h>
 
 namespace Mixer {
+    // [수정] TextureManager 핸들 래퍼 (메인 스레드). 생성은 바로 끝나고 디코딩/업로드는 백그라운드에서,
+    // 준비되기 전에는 GetRendererID가 대체 텍스처를 돌려줌. 같은 경로는 텍스처 하나를 공유
     class Texture
     {
     public:
         Texture(const std::string& path);
         ~Texture();
 
-        void Bind(unsigned int slot = 0) const;
-        void Unbind() const;
+        Texture(const Texture&) = delete;
+        Texture& operator=(const Texture&) = delete;
 
-        inline int GetWidth() const { return m_Width; }
-        inline int GetHeight() const { return m_Height; }
+        inline bool IsReady() const { return TextureManager::IsReady(m_Handle); }
+        inline int GetWidth() const { return TextureManager::GetWidth(m_Handle); }   // 디코딩 전엔 0
+        inline int GetHeight() const { return TextureManager::GetHeight(m_Handle); }
+        inline GLuint GetRendererID() const { return TextureManager::GetRendererID(m_Handle); } // 그리기 패킷용
+        inline const std::string& GetPath() const { return m_FilePath; }
 
     private:
-        GLuint m_RendererID;
+        TextureHandle m_Handle;
         std::string m_FilePath;
-        unsigned char* m_LocalBuffer;
-        int m_Width, m_Height, m_BPP; // Bits Per Pixel
     };
-}
\ No newline at end of file
+}
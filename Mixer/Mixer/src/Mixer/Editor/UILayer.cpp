@@ -1,5 +1,9 @@
 #include "UILayer.h"
-#include "Mixer/Events/KeyEvent.h" // Ű ̺Ʈ
+#include "Mixer/Events/KeyEvent.h" // 키 이벤트
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/CommandBucket.h"
+#include "Mixer/Renderer/ShaderLibrary.h"
+#include "GpuBuffer.h"
 #include <iostream>
 
 namespace Mixer {
@@ -8,111 +12,82 @@ namespace Mixer {
 
     void UILayer::OnAttach()
     {
-        // 1. ؽó ε (assets/textures/help.png  ž մϴ!)
-        //  ϰ ۾ ִ PNG մϴ.
+        // 1. 텍스처 로드 (assets/textures/help.png 파일을 만드셔야 합니다!)
+        // 배경은 투명하고 글씨가 쓰여있는 PNG를 권장합니다.
+        // [수정] 디코딩/업로드는 백그라운드 (준비될 때까지 대체 텍스처)
         m_HelpTexture = std::make_unique<Texture>("assets/textures/MixerUI.png");
+        // [수정] 텍스처용 셰이더 (assets/shaders/UI.*, 텍스처 슬롯 0번은 그리기 패킷의 u_Texture로)
+        m_Shader = ShaderLibrary::Load("UI");
 
-        // 2. ȭ ü  簢 (Quad) 
-        // ġ(x,y) + ؽóǥ(u,v)
-        float vertices[] = {
-            // ġ        // UV
-           -1.0f, -1.0f,   0.0f, 0.0f, // 
-            1.0f, -1.0f,   1.0f, 0.0f, // 
-            1.0f,  1.0f,   1.0f, 1.0f, // 
-           -1.0f,  1.0f,   0.0f, 1.0f  // »
-        };
-
-        uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
-
-        // 3.  
-        glGenVertexArrays(1, &m_VAO);
-        glBindVertexArray(m_VAO);
-
-        glGenBuffers(1, &m_VBO);
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-        glEnableVertexAttribArray(0); // Pos
-        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-
-        glEnableVertexAttribArray(1); // UV
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-
-        glGenBuffers(1, &m_IBO);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-        // 4. ؽó ̴ (ſ )
-        const char* vsSrc = R"(#version 330 core
-layout(location = 0) in vec2 a_Pos;
-layout(location = 1) in vec2 a_TexCoord;
-out vec2 v_TexCoord;
-void main() {
-    gl_Position = vec4(a_Pos, 0.0, 1.0); // Z=0
-    v_TexCoord = a_TexCoord;
-})";
-        const char* fsSrc = R"(#version 330 core
-layout(location = 0) out vec4 color;
-in vec2 v_TexCoord;
-uniform sampler2D u_Texture;
-void main() {
-    color = texture(u_Texture, v_TexCoord);
-})";
-
-        GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vs, 1, &vsSrc, nullptr);
-        glCompileShader(vs);
-        GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fs, 1, &fsSrc, nullptr);
-        glCompileShader(fs);
-
-        m_Shader = glCreateProgram();
-        glAttachShader(m_Shader, vs);
-        glAttachShader(m_Shader, fs);
-        glLinkProgram(m_Shader);
-
-        glDeleteShader(vs);
-        glDeleteShader(fs);
-
-        // ̴ ؽó  0 ڴٰ ˸
-        glUseProgram(m_Shader);
-        glUniform1i(glGetUniformLocation(m_Shader, "u_Texture"), 0);
+        // [수정] GL 자원 생성은 렌더 스레드에서 (끝날 때까지 대기)
+        RenderThread::ExecuteNow([this]
+        {
+            // 2. 화면 전체를 덮는 사각형 (Quad) 데이터
+            // 위치(x,y) + 텍스처좌표(u,v)
+            float vertices[] = {
+                // 위치        // UV
+               -1.0f, -1.0f,   0.0f, 0.0f, // 좌하
+                1.0f, -1.0f,   1.0f, 0.0f, // 우하
+                1.0f,  1.0f,   1.0f, 1.0f, // 우상
+               -1.0f,  1.0f,   0.0f, 1.0f  // 좌상
+            };
+
+            uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
+
+            // 3. 버퍼 생성
+            glGenVertexArrays(1, &m_VAO);
+            glBindVertexArray(m_VAO);
+
+            glGenBuffers(1, &m_VBO);
+            glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+            GpuBufferData(GL_ARRAY_BUFFER, m_VBO, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+            glEnableVertexAttribArray(0); // Pos
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+
+            glEnableVertexAttribArray(1); // UV
+            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+
+            glGenBuffers(1, &m_IBO);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+            GpuBufferData(GL_ELEMENT_ARRAY_BUFFER, m_IBO, sizeof(indices), indices, GL_STATIC_DRAW);
+        });
     }
 
     void UILayer::OnDetach()
     {
-        glDeleteVertexArrays(1, &m_VAO);
-        glDeleteBuffers(1, &m_VBO);
-        glDeleteBuffers(1, &m_IBO);
-        glDeleteProgram(m_Shader);
+        GLuint vao = m_VAO, vbo = m_VBO, ibo = m_IBO;
+        RenderThread::Submit([vao, vbo, ibo]
+        {
+            glDeleteVertexArrays(1, &vao);
+            GpuDeleteBuffers(1, &vbo);
+            GpuDeleteBuffers(1, &ibo);
+        });
+        ShaderLibrary::Release(m_Shader);
+        m_HelpTexture.reset(); // [수정] 텍스처 삭제는 TextureManager가 렌더 스레드로 넘김
     }
 
     void UILayer::OnUpdate()
     {
         if (!m_IsVisible) return;
 
-        // [ٽ] (Alpha Blending) Ȱȭ
-        // ̰    ̹ ˰ ɴϴ.
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        // 2D UI̹Ƿ  ׽Ʈ ϴ (  ׸ )
-        glDisable(GL_DEPTH_TEST);
-
-        glUseProgram(m_Shader);
-        m_HelpTexture->Bind(0); // 0 Կ ؽó ε
-
-        glBindVertexArray(m_VAO);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
-
-        //  ( 3D  )
-        glEnable(GL_DEPTH_TEST);
-        glDisable(GL_BLEND);
+        // [수정] 그리기 패킷으로 제출. UI 패스는 항상 마지막에 그려짐
+        // [핵심] 투명도(Alpha Blending) 활성화 - 이게 없으면 투명 배경 이미지가 검게 나옵니다.
+        // 2D UI이므로 깊이 테스트는 끕니다 (맨 위에 그리기 위해)
+        DrawPacket packet;
+        packet.Program = ShaderLibrary::GetProgram(m_Shader);
+        packet.VertexArray = m_VAO;
+        packet.IndexBuffer = m_IBO;
+        packet.Texture = m_HelpTexture->GetRendererID(); // 0번 슬롯
+        packet.State = RenderStateBlend;
+        packet.Mode = DrawMode::Elements;
+        packet.Count = 6;
+        CommandBucket::Add(SortKey::Make(RenderPass::UI, packet.Program, packet.State), packet, { { "u_Texture", 0 } });
     }
 
     void UILayer::OnEvent(Event& e)
     {
-        // F1 Ű   
+        // F1 키를 누르면 도움말 토글
         if (e.GetEventType() == EventType::KeyPressed)
         {
             KeyPressedEvent& event = (KeyPressedEvent&)e;
@@ -120,6 +95,11 @@ void main() {
             {
                 m_IsVisible = !m_IsVisible;
             }
+            // [추가] F2 : 메모리 사용량 보고서 (태그별 힙 + GPU 버퍼)
+            else if (event.GetKeyCode() == 291)
+            {
+                MemoryTracker::DumpReport();
+            }
         }
     }
 }
\ No newline at end of file
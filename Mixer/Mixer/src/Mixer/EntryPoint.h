@@ -2,6 +2,9 @@
 
 #ifdef MX_PLATFORM_WINDOWS
 
+// [추가] 애플리케이션의 operator new/delete도 엔진의 할당기로 (MemoryTracker.h 참고)
+#include "Mixer/MemoryHooks.h"
+
 extern Mixer::Application* Mixer::CreateApplication();
 
 int main(int argc, char** argv)
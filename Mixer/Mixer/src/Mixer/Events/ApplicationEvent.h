@@ -12,9 +12,9 @@ namespace Mixer {
 		inline unsigned int GetWidth() const { return m_Width; }
 		inline unsigned int GetHeight() const { return m_Height; }
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "WindowResizeEvent: " << m_Width << ", " << m_Height;
 			return ss.str();
 		}
@@ -2,6 +2,7 @@
 
 #include "mxpch.h"
 #include "Mixer/Core.h"
+#include "Mixer/FrameAllocator.h"
 
 namespace Mixer {
 
@@ -37,7 +38,7 @@ namespace Mixer {
 		virtual EventType GetEventType() const = 0;
 		virtual const char* GetName() const = 0;
 		virtual int GetCategoryFlags() const = 0;
-		virtual std::string ToString() const { return GetName(); }
+		virtual FrameString ToString() const { return GetName(); } // [수정] 프레임 임시 메모리: 로그용, 보관 금지
 
 		inline bool IsInCategory(EventCategory category)
 		{
@@ -24,9 +24,9 @@ namespace Mixer {
 
 		inline int GetRepeatCount() const { return m_RepeatCount; }
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "KeyPressedEvent: " << m_KeyCode << " (" << m_RepeatCount << " repeats)";
 			return ss.str();
 		}
@@ -42,9 +42,9 @@ namespace Mixer {
 		KeyReleasedEvent(int keycode)
 			: KeyEvent(keycode) {}
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "KeyReleasedEvent: " << m_KeyCode;
 			return ss.str();
 		}
@@ -12,9 +12,9 @@ namespace Mixer {
 		inline float GetX() const { return m_MouseX; }
 		inline float GetY() const { return m_MouseY; }
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "MouseMovedEvent: " << m_MouseX << ", " << m_MouseY;
 			return ss.str();
 		}
@@ -34,9 +34,9 @@ namespace Mixer {
 		inline float GetXOffset() const { return m_XOffset; }
 		inline float GetYOffset() const { return m_YOffset; }
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "MouseScrolledEvent: " << GetXOffset() << ", " << GetYOffset();
 			return ss.str();
 		}
@@ -65,9 +65,9 @@ namespace Mixer {
 		MouseButtonPressedEvent(int button)
 			: MouseButtonEvent(button) {}
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "MouseButtonPressedEvent: " << m_Button;
 			return ss.str();
 		}
@@ -80,9 +80,9 @@ namespace Mixer {
 		MouseButtonReleasedEvent(int button)
 			: MouseButtonEvent(button) {}
 
-		std::string ToString() const override
+		FrameString ToString() const override
 		{
-			std::stringstream ss;
+			FrameStringStream ss;
 			ss << "MouseButtonReleasedEvent: " << m_Button;
 			return ss.str();
 		}
@@ -0,0 +1,150 @@
+#include "mxpch.h"
+#include "FrameAllocator.h"
+
+#include <mutex>
+
+namespace Mixer {
+
+	static constexpr size_t DefaultArenaCapacity = 1024 * 1024;
+
+	static size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	static uint8_t* AllocateBuffer(size_t size)
+	{
+		return static_cast<uint8_t*>(::operator new(size, std::align_val_t(64)));
+	}
+
+	static void FreeBuffer(void* buffer)
+	{
+		::operator delete(buffer, std::align_val_t(64));
+	}
+
+	LinearArena::LinearArena(size_t capacity)
+		: m_Buffer(AllocateBuffer(capacity)), m_Capacity(capacity)
+	{
+	}
+
+	LinearArena::~LinearArena()
+	{
+		for (void* block : m_Overflow)
+			FreeBuffer(block);
+		FreeBuffer(m_Buffer);
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		if (alignment > 64)
+			alignment = 64; // 버퍼는 64 정렬 (엔진에서 그 이상을 요구하는 곳은 없음)
+
+		size_t offset = AlignUp(m_Offset, alignment);
+		void* result;
+		if (offset + size <= m_Capacity)
+		{
+			result = m_Buffer + offset;
+			m_Offset = offset + size;
+		}
+		else
+		{
+			result = AllocateBuffer(size > 0 ? size : 1);
+			m_Overflow.push_back(result);
+			m_OverflowBytes += size;
+		}
+
+		size_t used = GetUsed();
+		if (used > m_HighWaterMark.load(std::memory_order_relaxed))
+			m_HighWaterMark.store(used, std::memory_order_relaxed);
+		return result;
+	}
+
+	void LinearArena::Free(void* ptr, size_t size)
+	{
+		uint8_t* bytes = static_cast<uint8_t*>(ptr);
+		if (bytes >= m_Buffer && bytes + size == m_Buffer + m_Offset)
+			m_Offset = bytes - m_Buffer;
+	}
+
+	void LinearArena::Reset()
+	{
+		for (void* block : m_Overflow)
+			FreeBuffer(block);
+
+		if (!m_Overflow.empty())
+		{
+			// 최대치 (2의 거듭제곱으로 올림)로 키워서 다음 프레임은 버퍼 하나 안에서 끝나게
+			size_t capacity = m_Capacity;
+			while (capacity < GetHighWaterMark())
+				capacity *= 2;
+			FreeBuffer(m_Buffer);
+			m_Buffer = AllocateBuffer(capacity);
+			m_Capacity = capacity;
+			m_Overflow.clear();
+		}
+
+		m_Offset = 0;
+		m_OverflowBytes = 0;
+	}
+
+	struct FrameAllocatorData
+	{
+		std::mutex Mutex;
+		std::vector<std::unique_ptr<LinearArena>> Arenas;
+		std::atomic<uint64_t> Frame{ 0 };
+	};
+
+	static FrameAllocatorData s_Data;
+	static thread_local LinearArena* t_Arena = nullptr;
+	static thread_local uint64_t t_ArenaFrame = 0; // 이 스레드의 아레나를 마지막으로 초기화한 프레임
+
+	static LinearArena& GetThreadArena()
+	{
+		if (!t_Arena)
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.Arenas.push_back(std::make_unique<LinearArena>(DefaultArenaCapacity));
+			t_Arena = s_Data.Arenas.back().get();
+			t_ArenaFrame = s_Data.Frame.load();
+		}
+
+		uint64_t frame = s_Data.Frame.load(std::memory_order_acquire);
+		if (t_ArenaFrame != frame)
+		{
+			t_Arena->Reset();
+			t_ArenaFrame = frame;
+		}
+		return *t_Arena;
+	}
+
+	void FrameAllocator::BeginFrame()
+	{
+		s_Data.Frame.fetch_add(1, std::memory_order_release);
+		GetThreadArena(); // 메인 스레드 아레나는 첫 할당 때가 아니라 지금 초기화
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment)
+	{
+		return GetThreadArena().Allocate(size, alignment);
+	}
+
+	void FrameAllocator::Free(void* ptr, size_t size)
+	{
+		// 다른 스레드나 다음 프레임에서 해제한 블록은 그냥 무시
+		if (t_Arena && t_ArenaFrame == s_Data.Frame.load(std::memory_order_relaxed))
+			t_Arena->Free(ptr, size);
+	}
+
+	FrameAllocatorStats FrameAllocator::GetStats()
+	{
+		FrameAllocatorStats stats;
+		stats.Used = t_Arena ? t_Arena->GetUsed() : 0;
+
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		for (const std::unique_ptr<LinearArena>& arena : s_Data.Arenas)
+			stats.HighWaterMark += arena->GetHighWaterMark();
+		stats.ArenaCount = (uint32_t)s_Data.Arenas.size();
+		return stats;
+	}
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <string>
+#include <sstream>
+
+namespace Mixer {
+
+	// 버퍼 하나에서 앞으로만 잘라 주는 할당기. 스레드 안전하지 않음 (스레드마다 하나, FrameAllocator 참고)
+	// 안 들어가는 할당은 다음 Reset까지 힙으로, Reset 때 관측한 최대치로 버퍼를 키워서 다음 프레임은 들어가게 함
+	class MIXER_API LinearArena
+	{
+	public:
+		explicit LinearArena(size_t capacity);
+		~LinearArena();
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment);
+		// 가장 최근 할당만 돌려받음 (커지는 vector가 자리를 다시 쓸 수 있게)
+		void Free(void* ptr, size_t size);
+		void Reset();
+
+		size_t GetUsed() const { return m_Offset + m_OverflowBytes; }
+		size_t GetCapacity() const { return m_Capacity; }
+		size_t GetHighWaterMark() const { return m_HighWaterMark.load(std::memory_order_relaxed); }
+
+	private:
+		uint8_t* m_Buffer = nullptr;
+		size_t m_Capacity = 0;
+		size_t m_Offset = 0;
+		std::vector<void*> m_Overflow;
+		size_t m_OverflowBytes = 0;
+		std::atomic<size_t> m_HighWaterMark{ 0 };
+	};
+
+	struct FrameAllocatorStats
+	{
+		size_t Used = 0;          // 호출한 스레드, 이번 프레임
+		size_t HighWaterMark = 0; // 스레드별 최대치의 합
+		uint32_t ArenaCount = 0;
+	};
+
+	// 다음 BeginFrame까지만 유효한 임시 메모리. 스레드마다 아레나 하나 (처음 쓸 때 생성) -> 작업에서도 잠금 없이 할당
+	// 아레나는 그 스레드가 새 프레임에 처음 할당할 때 초기화됨. 여기서 받은 메모리는 프레임을 넘겨 들고 있으면 안 됨
+	// (LOD 생성처럼 오래 걸리는 작업은 일반 힙 사용)
+	class MIXER_API FrameAllocator
+	{
+	public:
+		// Application::Run이 매 프레임 시작에 호출
+		static void BeginFrame();
+
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+		static void Free(void* ptr, size_t size);
+
+		static FrameAllocatorStats GetStats();
+	};
+
+	// STL 할당기. deallocate는 가장 최근 블록만 돌려받고, 나머지는 프레임 초기화 때 한꺼번에 해제
+	template<typename T>
+	class FrameStlAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameStlAllocator() noexcept = default;
+		template<typename U>
+		FrameStlAllocator(const FrameStlAllocator<U>&) noexcept {}
+
+		T* allocate(size_t count) { return static_cast<T*>(FrameAllocator::Allocate(count * sizeof(T), alignof(T))); }
+		void deallocate(T* ptr, size_t count) noexcept { FrameAllocator::Free(ptr, count * sizeof(T)); }
+
+		template<typename U>
+		bool operator==(const FrameStlAllocator<U>&) const noexcept { return true; }
+		template<typename U>
+		bool operator!=(const FrameStlAllocator<U>&) const noexcept { return false; }
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+	template<typename T, typename Compare = std::less<T>>
+	using FrameSet = std::set<T, Compare, FrameStlAllocator<T>>;
+	template<typename K, typename V, typename Hash = std::hash<K>>
+	using FrameUnorderedMap = std::unordered_map<K, V, Hash, std::equal_to<K>, FrameStlAllocator<std::pair<const K, V>>>;
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameStlAllocator<char>>;
+	using FrameStringStream = std::basic_stringstream<char, std::char_traits<char>, FrameStlAllocator<char>>;
+
+}
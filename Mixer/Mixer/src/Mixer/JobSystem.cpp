@@ -0,0 +1,169 @@
+#include "mxpch.h"
+#include "JobSystem.h"
+#include "MemoryTracker.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace Mixer {
+
+	struct Job
+	{
+		std::function<void()> Function;
+		JobContext* Context;
+		MemoryTag Tag = MemoryTag::General; // 작업 안의 할당은 작업을 넣은 스레드의 태그로 집계
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<Job> Queue;
+		std::mutex QueueMutex;
+		std::condition_variable WakeCondition;
+		bool Running = false;
+	};
+
+	static JobSystemData s_Data;
+
+	// 이 context의 가장 오래된 작업만 꺼냄: 기다리는 쪽이 남의 긴 작업 (단순화 전체, 텍스처 변환 등)을
+	// 집어서 자기 스레드가 그만큼 멈추면 안 됨
+	static bool PopJob(const JobContext& context, Job& job)
+	{
+		std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+		auto it = std::find_if(s_Data.Queue.begin(), s_Data.Queue.end(), [&context](const Job& queued) { return queued.Context == &context; });
+		if (it == s_Data.Queue.end())
+			return false;
+
+		job = std::move(*it);
+		s_Data.Queue.erase(it);
+		return true;
+	}
+
+	static void RunJob(Job& job)
+	{
+		MemoryTagScope tag(job.Tag);
+		job.Function();
+		job.Context->Counter.fetch_sub(1);
+	}
+
+	static void WorkerLoop()
+	{
+		while (true)
+		{
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(s_Data.QueueMutex);
+				s_Data.WakeCondition.wait(lock, [] { return !s_Data.Queue.empty() || !s_Data.Running; });
+				if (!s_Data.Running && s_Data.Queue.empty())
+					return;
+
+				job = std::move(s_Data.Queue.front());
+				s_Data.Queue.pop_front();
+			}
+			RunJob(job);
+		}
+	}
+
+	void JobSystem::Init(uint32_t threadCount)
+	{
+		if (s_Data.Running)
+			return;
+
+		if (threadCount == 0)
+		{
+			uint32_t cores = std::thread::hardware_concurrency();
+			threadCount = cores > 1 ? cores - 1 : 1;
+		}
+
+		s_Data.Running = true;
+		for (uint32_t i = 0; i < threadCount; i++)
+			s_Data.Workers.emplace_back(WorkerLoop);
+
+		MX_CORE_INFO("JobSystem started with {0} worker threads", threadCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+			s_Data.Running = false;
+		}
+		s_Data.WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data.Workers)
+			worker.join();
+		s_Data.Workers.clear();
+	}
+
+	uint32_t JobSystem::GetThreadCount()
+	{
+		return (uint32_t)s_Data.Workers.size() + 1; // 작업 스레드 + 호출 스레드
+	}
+
+	void JobSystem::Execute(JobContext& context, const std::function<void()>& job)
+	{
+		context.Counter.fetch_add(1);
+
+		// 초기화 전이면 바로 실행 (호출하는 쪽에 따로 대체 경로가 필요 없게)
+		if (s_Data.Workers.empty())
+		{
+			job();
+			context.Counter.fetch_sub(1);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+			s_Data.Queue.push_back({ job, &context, MemoryTracker::GetThreadTag() });
+		}
+		s_Data.WakeCondition.notify_one();
+	}
+
+	void JobSystem::Dispatch(JobContext& context, uint32_t count, uint32_t groupSize, const RangeFn& job)
+	{
+		if (count == 0)
+			return;
+		if (groupSize == 0)
+			groupSize = 1;
+
+		uint32_t groupCount = (count + groupSize - 1) / groupSize;
+		if (groupCount == 1 || s_Data.Workers.empty())
+		{
+			job(0, count);
+			return;
+		}
+
+		context.Counter.fetch_add(groupCount);
+		MemoryTag tag = MemoryTracker::GetThreadTag();
+		{
+			std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+			for (uint32_t group = 0; group < groupCount; group++)
+			{
+				uint32_t begin = group * groupSize;
+				uint32_t end = std::min(begin + groupSize, count);
+				s_Data.Queue.push_back({ [job, begin, end]() { job(begin, end); }, &context, tag });
+			}
+		}
+		s_Data.WakeCondition.notify_all();
+	}
+
+	bool JobSystem::IsBusy(const JobContext& context)
+	{
+		return context.Counter.load() > 0;
+	}
+
+	void JobSystem::Wait(JobContext& context)
+	{
+		while (IsBusy(context))
+		{
+			Job job;
+			if (PopJob(context, job))
+				RunJob(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+}
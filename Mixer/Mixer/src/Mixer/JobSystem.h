@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <atomic>
+#include <functional>
+
+namespace Mixer {
+
+	// 작업 묶음의 완료 추적 (JobSystem::Wait로 기다림)
+	struct JobContext
+	{
+		std::atomic<uint32_t> Counter{ 0 };
+	};
+
+	class MIXER_API JobSystem
+	{
+	public:
+		using RangeFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+		static void Init(uint32_t threadCount = 0); // 0: 코어 수 - 1
+		static void Shutdown();
+
+		static uint32_t GetThreadCount();
+
+		static void Execute(JobContext& context, const std::function<void()>& job);
+		// [0, count)를 groupSize씩 나눠서 병렬 실행
+		static void Dispatch(JobContext& context, uint32_t count, uint32_t groupSize, const RangeFn& job);
+
+		static bool IsBusy(const JobContext& context);
+		// 기다리는 스레드는 멈춰 있지 않고 이 context의 대기 중인 작업을 같이 처리
+		static void Wait(JobContext& context);
+	};
+
+}
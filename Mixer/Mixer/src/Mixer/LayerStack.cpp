@@ -3,42 +3,166 @@
 
 namespace Mixer {
 
-	LayerStack::LayerStack()
+	static uint32_t SlotIndex(LayerHandle handle) { return (uint32_t)handle; }
+	static uint32_t SlotGeneration(LayerHandle handle) { return (uint32_t)(handle >> 32); }
+
+	LayerStack::~LayerStack()
 	{
-		m_LayerInsert = m_Layers.begin();
+		Clear();
 	}
 
-	LayerStack::~LayerStack()
+	LayerHandle LayerStack::PushLayer(std::unique_ptr<Layer> layer)
 	{
-		for (Layer* layer : m_Layers)
-			delete layer;
+		return Push(std::move(layer), false);
 	}
 
-	void LayerStack::PushLayer(Layer* layer)
+	LayerHandle LayerStack::PushOverlay(std::unique_ptr<Layer> overlay)
 	{
-		m_LayerInsert = m_Layers.emplace(m_LayerInsert, layer);
+		return Push(std::move(overlay), true);
 	}
 
-	void LayerStack::PushOverlay(Layer* overlay)
+	LayerHandle LayerStack::Push(std::unique_ptr<Layer> layer, bool overlay)
 	{
-		m_Layers.emplace_back(overlay);
+		uint32_t index;
+		if (!m_FreeSlots.empty())
+		{
+			index = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)m_Slots.size();
+			m_Slots.emplace_back();
+		}
+
+		Slot& slot = m_Slots[index];
+		slot.Instance = std::move(layer);
+		slot.Overlay = overlay;
+		slot.Attached = false;
+		slot.Enabled = true;
+		slot.PendingRemove = false;
+		slot.Mask = LayerUpdateAll;
+		m_PendingAdd.push_back(index);
+		return (LayerHandle(slot.Generation) << 32) | index;
 	}
 
-	void LayerStack::PopLayer(Layer* layer)
+	void LayerStack::PopLayer(LayerHandle handle)
 	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), layer);
-		if (it != m_Layers.end())
+		Slot* slot = Find(handle);
+		if (!slot || slot->PendingRemove)
+			return;
+
+		slot->PendingRemove = true;
+		m_PendingRemove.push_back(SlotIndex(handle));
+	}
+
+	LayerStack::Slot* LayerStack::Find(LayerHandle handle)
+	{
+		uint32_t index = SlotIndex(handle);
+		if (handle == NullLayer || index >= m_Slots.size())
+			return nullptr;
+		Slot& slot = m_Slots[index];
+		return slot.Instance && slot.Generation == SlotGeneration(handle) ? &slot : nullptr;
+	}
+
+	const LayerStack::Slot* LayerStack::Find(LayerHandle handle) const
+	{
+		return const_cast<LayerStack*>(this)->Find(handle);
+	}
+
+	bool LayerStack::IsValid(LayerHandle handle) const
+	{
+		const Slot* slot = Find(handle);
+		return slot && !slot->PendingRemove;
+	}
+
+	Layer* LayerStack::Get(LayerHandle handle) const
+	{
+		const Slot* slot = Find(handle);
+		return slot ? slot->Instance.get() : nullptr;
+	}
+
+	void LayerStack::SetEnabled(LayerHandle handle, bool enabled)
+	{
+		if (Slot* slot = Find(handle))
+			slot->Enabled = enabled;
+	}
+
+	bool LayerStack::IsEnabled(LayerHandle handle) const
+	{
+		const Slot* slot = Find(handle);
+		return slot && slot->Enabled && !slot->PendingRemove;
+	}
+
+	void LayerStack::SetUpdateMask(LayerHandle handle, uint32_t mask)
+	{
+		if (Slot* slot = Find(handle))
+			slot->Mask = mask;
+	}
+
+	void LayerStack::ApplyPending()
+	{
+		// OnAttach/OnDetach에서 다시 Push/Pop할 수 있음 -> 예약이 없을 때까지 반복
+		while (!m_PendingAdd.empty() || !m_PendingRemove.empty())
 		{
-			m_Layers.erase(it);
-			m_LayerInsert--;
+			std::vector<uint32_t> removals;
+			removals.swap(m_PendingRemove);
+			if (!removals.empty())
+			{
+				// 한꺼번에 순서 목록을 한 번만 훑음
+				m_Order.erase(std::remove_if(m_Order.begin(), m_Order.end(),
+					[&](uint32_t index) { return m_Slots[index].PendingRemove; }), m_Order.end());
+				m_OverlayStart = 0;
+				while (m_OverlayStart < m_Order.size() && !m_Slots[m_Order[m_OverlayStart]].Overlay)
+					m_OverlayStart++;
+
+				for (uint32_t index : removals)
+				{
+					// 붙기 전에 Pop됨: 추가 예약에서 빼기만
+					if (!m_Slots[index].Attached)
+						m_PendingAdd.erase(std::remove(m_PendingAdd.begin(), m_PendingAdd.end(), index), m_PendingAdd.end());
+
+					std::unique_ptr<Layer> layer = std::move(m_Slots[index].Instance);
+					if (m_Slots[index].Attached)
+						layer->OnDetach();
+					m_Slots[index].Attached = false;
+					m_Slots[index].PendingRemove = false;
+					m_Slots[index].Generation++;
+					m_FreeSlots.push_back(index);
+				}
+			}
+
+			std::vector<uint32_t> additions;
+			additions.swap(m_PendingAdd);
+			for (uint32_t index : additions)
+			{
+				Slot& slot = m_Slots[index];
+				if (slot.Overlay)
+				{
+					m_Order.push_back(index);
+				}
+				else
+				{
+					m_Order.insert(m_Order.begin() + m_OverlayStart, index);
+					m_OverlayStart++;
+				}
+				slot.Attached = true;
+				m_Slots[index].Instance->OnAttach();
+			}
 		}
 	}
 
-	void LayerStack::PopOverlay(Layer* overlay)
+	void LayerStack::Clear()
 	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), overlay);
-		if (it != m_Layers.end())
-			m_Layers.erase(it);
+		for (auto it = m_Order.rbegin(); it != m_Order.rend(); ++it)
+			m_Slots[*it].Instance->OnDetach();
+
+		m_Slots.clear();
+		m_FreeSlots.clear();
+		m_Order.clear();
+		m_OverlayStart = 0;
+		m_PendingAdd.clear();
+		m_PendingRemove.clear();
 	}
 
 }
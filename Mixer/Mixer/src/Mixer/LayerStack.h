@@ -4,25 +4,100 @@
 #include "Layer.h"
 
 #include <vector>
+#include <memory>
 
 namespace Mixer {
 
+	// [추가] 하위 32비트: 슬롯 번호, 상위 32비트: 세대 (지난 핸들은 무시됨
+	// 옛 핸들이 다시 맞으려면 같은 슬롯을 2^32번 재사용해야 함)
+	using LayerHandle = uint64_t;
+	static constexpr LayerHandle NullLayer = ~0ull;
+
+	// [추가] 레이어가 받을 콜백
+	enum LayerUpdateMask : uint32_t
+	{
+		LayerUpdateNone   = 0,
+		LayerUpdateTick   = BIT(0), // OnUpdate
+		LayerUpdateEvents = BIT(1), // OnEvent
+		LayerUpdateAll    = LayerUpdateTick | LayerUpdateEvents
+	};
+
+	// [수정] 레이어를 소유함. Push/Pop은 변경을 예약만 하고 ApplyPending (Application이 매 프레임 시작에 호출)이
+	// 붙이기/떼기를 함 -> OnUpdate/OnEvent 안에서 레이어를 추가/제거해도 진행 중인 순회가 깨지지 않음
+	// 켜기/끄기와 갱신 마스크는 바로 적용되고 순서는 바꾸지 않음
 	class MIXER_API LayerStack
 	{
 	public:
-		LayerStack();
+		LayerStack() = default;
 		~LayerStack();
 
-		void PushLayer(Layer* layer);
-		void PushOverlay(Layer* overlay);
-		void PopLayer(Layer* layer);
-		void PopOverlay(Layer* overlay);
+		LayerStack(const LayerStack&) = delete;
+		LayerStack& operator=(const LayerStack&) = delete;
+
+		LayerHandle PushLayer(std::unique_ptr<Layer> layer);
+		LayerHandle PushOverlay(std::unique_ptr<Layer> overlay);
+		void PopLayer(LayerHandle handle); // 레이어/오버레이 모두, 콜백은 바로 끊김
+
+		bool IsValid(LayerHandle handle) const;
+		Layer* Get(LayerHandle handle) const;
+
+		void SetEnabled(LayerHandle handle, bool enabled);
+		bool IsEnabled(LayerHandle handle) const;
+		void SetUpdateMask(LayerHandle handle, uint32_t mask);
+
+		void ApplyPending();
+		// 전부 떼고 삭제 (오버레이부터)
+		void Clear();
+
+		// 붙어 있고 켜져 있으며 마스크가 mask와 겹치는 레이어: 아래에서 위로
+		template<typename Fn>
+		void Each(uint32_t mask, Fn&& fn)
+		{
+			for (uint32_t index : m_Order)
+			{
+				const Slot& slot = m_Slots[index];
+				if (slot.Enabled && !slot.PendingRemove && (slot.Mask & mask))
+					fn(*slot.Instance);
+			}
+		}
+
+		// 위에서 아래로, fn이 true를 돌려주면 (이벤트 처리됨) 멈춤
+		template<typename Fn>
+		void EachReverse(uint32_t mask, Fn&& fn)
+		{
+			for (auto it = m_Order.rbegin(); it != m_Order.rend(); ++it)
+			{
+				const Slot& slot = m_Slots[*it];
+				if (slot.Enabled && !slot.PendingRemove && (slot.Mask & mask) && fn(*slot.Instance))
+					return;
+			}
+		}
+
+		size_t GetLayerCount() const { return m_Order.size(); }
+
+	private:
+		struct Slot
+		{
+			std::unique_ptr<Layer> Instance;
+			uint32_t Generation = 0;
+			bool Overlay = false;
+			bool Attached = false;
+			bool Enabled = true;
+			bool PendingRemove = false;
+			uint32_t Mask = LayerUpdateAll;
+		};
+
+		LayerHandle Push(std::unique_ptr<Layer> layer, bool overlay);
+		Slot* Find(LayerHandle handle);
+		const Slot* Find(LayerHandle handle) const;
 
-		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
-		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
 	private:
-		std::vector<Layer*> m_Layers;
-		std::vector<Layer*>::iterator m_LayerInsert;
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeSlots;
+		std::vector<uint32_t> m_Order;        // 붙어 있는 슬롯: 레이어, 그 다음 오버레이
+		uint32_t m_OverlayStart = 0;          // m_Order에서 첫 오버레이 위치
+		std::vector<uint32_t> m_PendingAdd;
+		std::vector<uint32_t> m_PendingRemove;
 	};
 
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core.h"
+#include "MemoryTracker.h"
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
 
@@ -19,16 +20,17 @@ namespace Mixer {
 }
 
 
+// [추가] 로그 문자열 만들기는 MemoryTag::Logging으로 집계
 //Core log macros
-#define MX_CORE_ERROR(...) ::Mixer::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define MX_CORE_WARN(...) ::Mixer::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define MX_CORE_INFO(...) ::Mixer::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define MX_CORE_TRACE(...) ::Mixer::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define MX_CORE_CRITICAL(...) ::Mixer::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define MX_CORE_ERROR(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetCoreLogger()->error(__VA_ARGS__); } while (0)
+#define MX_CORE_WARN(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetCoreLogger()->warn(__VA_ARGS__); } while (0)
+#define MX_CORE_INFO(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetCoreLogger()->info(__VA_ARGS__); } while (0)
+#define MX_CORE_TRACE(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetCoreLogger()->trace(__VA_ARGS__); } while (0)
+#define MX_CORE_CRITICAL(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetCoreLogger()->critical(__VA_ARGS__); } while (0)
 
 //Client log macros
-#define MX_ERROR(...) ::Mixer::Log::GetClientLogger()->error(__VA_ARGS__)
-#define MX_WARN(...) ::Mixer::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define MX_INFO(...) ::Mixer::Log::GetClientLogger()->info(__VA_ARGS__)
-#define MX_TRACE(...) ::Mixer::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define MX_CRITICAL(...) ::Mixer::Log::GetClientLogger()->critical(__VA_ARGS__)
\ No newline at end of file
+#define MX_ERROR(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetClientLogger()->error(__VA_ARGS__); } while (0)
+#define MX_WARN(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetClientLogger()->warn(__VA_ARGS__); } while (0)
+#define MX_INFO(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetClientLogger()->info(__VA_ARGS__); } while (0)
+#define MX_TRACE(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetClientLogger()->trace(__VA_ARGS__); } while (0)
+#define MX_CRITICAL(...) do { ::Mixer::MemoryTagScope mxLogTag(::Mixer::MemoryTag::Logging); ::Mixer::Log::GetClientLogger()->critical(__VA_ARGS__); } while (0)
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Mixer/MemoryTracker.h"
+
+#include <new>
+
+// MemoryTracker::Allocate/Free로 넘기는 전역 operator new/delete 대체
+// 모듈마다 operator new/delete가 따로 있으므로 모듈당 정확히 한 번 포함: 엔진은 MemoryTracker.cpp,
+// 애플리케이션은 EntryPoint.h. 그러면 어느 모듈이 해제하든 블록은 항상 같은 할당기에서 나온 것
+#ifdef MX_TRACK_MEMORY
+
+namespace {
+
+	void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+	{
+		void* ptr = Mixer::MemoryTracker::Allocate(size, alignment);
+		if (!ptr)
+			throw std::bad_alloc();
+		return ptr;
+	}
+
+}
+
+void* operator new(size_t size) { return TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return Mixer::MemoryTracker::Allocate(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return Mixer::MemoryTracker::Allocate(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return Mixer::MemoryTracker::Allocate(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return Mixer::MemoryTracker::Allocate(size, (size_t)alignment); }
+
+void operator delete(void* ptr) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Mixer::MemoryTracker::Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Mixer::MemoryTracker::Free(ptr); }
+
+#endif // MX_TRACK_MEMORY
@@ -0,0 +1,235 @@
+#include "mxpch.h"
+#include "MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace Mixer {
+
+	struct TagCounters
+	{
+		constexpr TagCounters(size_t budget = 0) : Budget(budget) {}
+
+		std::atomic<size_t> Current{ 0 };
+		std::atomic<size_t> Peak{ 0 };
+		std::atomic<uint64_t> Count{ 0 };
+		std::atomic<size_t> Budget;
+		bool Warned = false; // 메인 스레드에서만 (CheckBudgets)
+	};
+
+	static constexpr size_t MB = 1024 * 1024;
+
+	// 상수 초기화 -> 동적 초기화보다 먼저 일어나는 할당에서도 사용 가능
+	// (기본 예산: General, Mesh, GPU staging, Undo, Events, Logging)
+	static TagCounters s_Tags[(size_t)MemoryTag::Count] = { 0, 2048 * MB, 256 * MB, 512 * MB, 1 * MB, 8 * MB };
+	static TagCounters s_GPU(2048 * MB);
+	static thread_local MemoryTag t_Tag = MemoryTag::General;
+
+	struct GPUBufferTable
+	{
+		std::mutex Mutex;
+		std::unordered_map<uint32_t, size_t> Sizes;
+	};
+
+	static GPUBufferTable& GetGPUBuffers()
+	{
+		static GPUBufferTable table;
+		return table;
+	}
+
+	static void Add(TagCounters& counters, size_t bytes)
+	{
+		size_t current = counters.Current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		counters.Count.fetch_add(1, std::memory_order_relaxed);
+		size_t peak = counters.Peak.load(std::memory_order_relaxed);
+		while (current > peak && !counters.Peak.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static MemoryTagStats ToStats(const TagCounters& counters)
+	{
+		MemoryTagStats stats;
+		stats.CurrentBytes = counters.Current.load(std::memory_order_relaxed);
+		stats.PeakBytes = counters.Peak.load(std::memory_order_relaxed);
+		stats.AllocationCount = counters.Count.load(std::memory_order_relaxed);
+		stats.Budget = counters.Budget.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		switch (tag)
+		{
+		case MemoryTag::General:    return "General";
+		case MemoryTag::Mesh:       return "Mesh";
+		case MemoryTag::GPUStaging: return "GPU staging";
+		case MemoryTag::Undo:       return "Undo";
+		case MemoryTag::Events:     return "Events";
+		case MemoryTag::Logging:    return "Logging";
+		default:                    return "?";
+		}
+	}
+
+	MemoryTag MemoryTracker::GetThreadTag()
+	{
+		return t_Tag;
+	}
+
+	void MemoryTracker::SetThreadTag(MemoryTag tag)
+	{
+		t_Tag = tag;
+	}
+
+	void MemoryTracker::SetBudget(MemoryTag tag, size_t bytes)
+	{
+		s_Tags[(size_t)tag].Budget = bytes;
+	}
+
+	void MemoryTracker::SetGPUBudget(size_t bytes)
+	{
+		s_GPU.Budget = bytes;
+	}
+
+	MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		return ToStats(s_Tags[(size_t)tag]);
+	}
+
+	MemoryTagStats MemoryTracker::GetGPUStats()
+	{
+		return ToStats(s_GPU);
+	}
+
+	void MemoryTracker::SetGPUBufferSize(uint32_t buffer, size_t bytes)
+	{
+		GPUBufferTable& table = GetGPUBuffers();
+		std::lock_guard<std::mutex> lock(table.Mutex);
+		auto it = table.Sizes.find(buffer);
+		if (it != table.Sizes.end())
+		{
+			s_GPU.Current.fetch_sub(it->second, std::memory_order_relaxed);
+			if (bytes == 0)
+			{
+				table.Sizes.erase(it);
+				return;
+			}
+			it->second = bytes;
+		}
+		else if (bytes > 0)
+		{
+			table.Sizes.emplace(buffer, bytes);
+		}
+		if (bytes > 0)
+			Add(s_GPU, bytes);
+	}
+
+	void MemoryTracker::ReleaseGPUBuffer(uint32_t buffer)
+	{
+		SetGPUBufferSize(buffer, 0);
+	}
+
+	static void CheckBudget(TagCounters& counters, const char* name)
+	{
+		size_t budget = counters.Budget.load(std::memory_order_relaxed);
+		if (budget == 0)
+			return;
+
+		size_t current = counters.Current.load(std::memory_order_relaxed);
+		if (!counters.Warned && current > budget)
+		{
+			counters.Warned = true;
+			MX_CORE_WARN("Memory budget exceeded: {0} uses {1:.1f} MB of {2:.1f} MB", name, current / (double)MB, budget / (double)MB);
+		}
+		else if (counters.Warned && current < budget - budget / 10)
+		{
+			counters.Warned = false;
+		}
+	}
+
+	void MemoryTracker::CheckBudgets()
+	{
+		for (size_t tag = 0; tag < (size_t)MemoryTag::Count; tag++)
+			CheckBudget(s_Tags[tag], GetTagName((MemoryTag)tag));
+		CheckBudget(s_GPU, "GPU buffers");
+	}
+
+	void MemoryTracker::DumpReport()
+	{
+	#ifndef MX_TRACK_MEMORY
+		MX_CORE_INFO("Memory report: heap tracking is disabled in this build (GPU buffers only)");
+	#endif
+		MX_CORE_INFO("Memory report (MB)");
+		MX_CORE_INFO("  {0:<12} {1:>10} {2:>10} {3:>10} {4:>12}", "Tag", "Current", "Peak", "Budget", "Allocations");
+
+		auto logRow = [](const char* name, const MemoryTagStats& stats)
+		{
+			MX_CORE_INFO("  {0:<12} {1:>10.2f} {2:>10.2f} {3:>10} {4:>12}", name,
+				stats.CurrentBytes / (double)MB, stats.PeakBytes / (double)MB,
+				stats.Budget > 0 ? std::to_string(stats.Budget / MB) : std::string("-"), stats.AllocationCount);
+		};
+		for (size_t tag = 0; tag < (size_t)MemoryTag::Count; tag++)
+			logRow(GetTagName((MemoryTag)tag), GetStats((MemoryTag)tag));
+
+		size_t bufferCount;
+		{
+			GPUBufferTable& table = GetGPUBuffers();
+			std::lock_guard<std::mutex> lock(table.Mutex);
+			bufferCount = table.Sizes.size();
+		}
+		logRow("GPU buffers", GetGPUStats());
+		MX_CORE_INFO("  ({0} live GL buffers)", bufferCount);
+	}
+
+	// 블록마다 크기와 태그를 담은 헤더를 붙임 -> 해제는 (다른 스레드에서라도) 할당한 태그로 집계
+	struct AllocationHeader
+	{
+		void* Base;
+		size_t Size;
+		uint32_t Tag;
+	};
+
+	void* MemoryTracker::Allocate(size_t size, size_t alignment) noexcept
+	{
+		if (alignment < alignof(std::max_align_t))
+			alignment = alignof(std::max_align_t);
+
+		void* base = std::malloc(size + alignment + sizeof(AllocationHeader));
+		if (!base)
+			return nullptr;
+
+		uintptr_t user = ((uintptr_t)base + sizeof(AllocationHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+		header->Base = base;
+		header->Size = size;
+		header->Tag = (uint32_t)t_Tag;
+		OnAllocate((MemoryTag)header->Tag, size);
+		return reinterpret_cast<void*>(user);
+	}
+
+	void MemoryTracker::Free(void* ptr) noexcept
+	{
+		if (!ptr)
+			return;
+
+		AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+		OnFree((MemoryTag)header->Tag, header->Size);
+		std::free(header->Base);
+	}
+
+	void MemoryTracker::OnAllocate(MemoryTag tag, size_t bytes)
+	{
+		Add(s_Tags[(size_t)tag], bytes);
+	}
+
+	void MemoryTracker::OnFree(MemoryTag tag, size_t bytes)
+	{
+		s_Tags[(size_t)tag].Current.fetch_sub(bytes, std::memory_order_relaxed);
+	}
+
+}
+
+// 엔진 모듈의 operator new/delete (애플리케이션은 EntryPoint.h로 따로 가짐)
+#include "Mixer/MemoryHooks.h"
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 할당 용도. 호출한 스레드의 현재 태그 (MemoryTagScope 참고)로 집계
+	// 작업은 작업을 넣은 스레드의 태그를 물려받음
+	enum class MemoryTag : uint8_t
+	{
+		General = 0,
+		Mesh,
+		GPUStaging, // glBufferData에 넘기려고만 만든 CPU 쪽 복사본
+		Undo,
+		Events,
+		Logging,
+		Count
+	};
+
+	struct MemoryTagStats
+	{
+		size_t CurrentBytes = 0;
+		size_t PeakBytes = 0;
+		uint64_t AllocationCount = 0; // 시작 후 누적
+		size_t Budget = 0;            // 0: 예산 없음
+	};
+
+	// 힙 메모리는 바꿔 끼운 전역 operator new/delete로 태그별 집계 (MX_TRACK_MEMORY가 정의된 경우만, 아니면 전부 0)
+	// GPU 버퍼 메모리는 GpuBuffer 함수들로 집계. 예산 검사는 Application이 프레임마다 한 번
+	// 엔진과 애플리케이션 모두 new/delete를 Allocate/Free로 바꾸므로 (MemoryHooks.h) 어느 모듈에서 해제해도 됨
+	class MIXER_API MemoryTracker
+	{
+	public:
+		static const char* GetTagName(MemoryTag tag);
+
+		static MemoryTag GetThreadTag();
+		static void SetThreadTag(MemoryTag tag);
+
+		static void SetBudget(MemoryTag tag, size_t bytes);
+		static void SetGPUBudget(size_t bytes);
+		static MemoryTagStats GetStats(MemoryTag tag);
+		static MemoryTagStats GetGPUStats();
+
+		// buffer: GL 버퍼 이름. 다시 올리면 이전 크기를 대체, 0바이트 (또는 Release)면 목록에서 뺌
+		static void SetGPUBufferSize(uint32_t buffer, size_t bytes);
+		static void ReleaseGPUBuffer(uint32_t buffer);
+
+		// 태그가 예산을 넘으면 한 번 경고 (90% 아래로 내려가면 다시 경고 가능)
+		static void CheckBudgets();
+		static void DumpReport();
+
+		// 할당 훅 (MemoryHooks.h). Free에는 Allocate가 돌려준 포인터만
+		static void* Allocate(size_t size, size_t alignment) noexcept;
+		static void Free(void* ptr) noexcept;
+		static void OnAllocate(MemoryTag tag, size_t bytes);
+		static void OnFree(MemoryTag tag, size_t bytes);
+	};
+
+	class MemoryTagScope
+	{
+	public:
+		explicit MemoryTagScope(MemoryTag tag)
+			: m_Previous(MemoryTracker::GetThreadTag())
+		{
+			MemoryTracker::SetThreadTag(tag);
+		}
+		~MemoryTagScope() { MemoryTracker::SetThreadTag(m_Previous); }
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+	private:
+		MemoryTag m_Previous;
+	};
+
+}
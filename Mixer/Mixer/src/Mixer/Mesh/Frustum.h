@@ -0,0 +1,43 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Mixer {
+
+	// 뷰-프로젝션 행렬에서 뽑은 절두체 평면 6개 (법선이 안쪽을 향함)
+	struct Frustum
+	{
+		glm::vec4 Planes[6];
+
+		// Gribb-Hartmann: 행렬의 행끼리 더하고 빼서 평면을 얻음 (glm은 열 우선이라 m[col][row])
+		static Frustum FromMatrix(const glm::mat4& m)
+		{
+			Frustum frustum;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int side = 0; side < 2; side++)
+				{
+					float sign = side == 0 ? 1.0f : -1.0f;
+					glm::vec4 plane(
+						m[0][3] + sign * m[0][i],
+						m[1][3] + sign * m[1][i],
+						m[2][3] + sign * m[2][i],
+						m[3][3] + sign * m[3][i]);
+					float length = glm::length(glm::vec3(plane.x, plane.y, plane.z));
+					frustum.Planes[i * 2 + side] = plane / length;
+				}
+			}
+			return frustum;
+		}
+
+		bool IntersectsSphere(const glm::vec3& center, float radius) const
+		{
+			for (const auto& plane : Planes)
+			{
+				if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+					return false;
+			}
+			return true;
+		}
+	};
+}
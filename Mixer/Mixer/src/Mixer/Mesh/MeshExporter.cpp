@@ -0,0 +1,43 @@
+#include "mxpch.h"
+#include "MeshExporter.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace Mixer {
+
+	bool MeshExporter::ExportOBJ(const std::string& path,
+		const std::vector<glm::vec3>& vertices,
+		const std::vector<uint32_t>& indices,
+		const std::vector<uint32_t>& edgeIndices)
+	{
+		// 덮어쓰지 않음 (새 이름은 호출하는 쪽에서: Paths::MakeUniquePath)
+		std::error_code error;
+		if (std::filesystem::exists(path, error))
+		{
+			MX_CORE_ERROR("Export target already exists, not overwriting: {0}", path);
+			return false;
+		}
+
+		std::ofstream file(path);
+		if (!file)
+		{
+			MX_CORE_ERROR("Failed to open {0} for export", path);
+			return false;
+		}
+
+		file << "# Mixer\n";
+		for (const glm::vec3& v : vertices)
+			file << "v " << v.x << ' ' << v.y << ' ' << v.z << '\n';
+
+		// OBJ 인덱스는 1부터 시작
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+			file << "f " << indices[i] + 1 << ' ' << indices[i + 1] + 1 << ' ' << indices[i + 2] + 1 << '\n';
+
+		for (size_t i = 0; i + 1 < edgeIndices.size(); i += 2)
+			file << "l " << edgeIndices[i] + 1 << ' ' << edgeIndices[i + 1] + 1 << '\n';
+
+		MX_CORE_INFO("Exported {0} ({1} vertices, {2} triangles)", path, vertices.size(), indices.size() / 3);
+		return true;
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	class MeshExporter
+	{
+	public:
+		// Wavefront OBJ 저장 (면: f, 고립된 선: l). path가 이미 있으면 실패 (덮어쓰지 않음)
+		static bool ExportOBJ(const std::string& path,
+			const std::vector<glm::vec3>& vertices,
+			const std::vector<uint32_t>& indices,
+			const std::vector<uint32_t>& edgeIndices);
+	};
+}
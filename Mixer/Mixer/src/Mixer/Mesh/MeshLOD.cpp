@@ -0,0 +1,76 @@
+#include "mxpch.h"
+#include "MeshLOD.h"
+#include "MeshSimplifier.h"
+
+#include <cfloat>
+
+namespace Mixer {
+
+	std::vector<MeshLODLevel> MeshLOD::Build(const std::vector<glm::vec3>& vertices,
+		const std::vector<uint32_t>& indices,
+		const std::atomic<bool>* cancel)
+	{
+		std::vector<MeshLODLevel> levels(1);
+		levels[0].Indices = indices;
+
+		glm::vec3 minPos(FLT_MAX), maxPos(-FLT_MAX);
+		for (const auto& p : vertices)
+		{
+			minPos = glm::min(minPos, p);
+			maxPos = glm::max(maxPos, p);
+		}
+		float extent = vertices.empty() ? 0.0f : glm::length(maxPos - minPos);
+
+		SimplifyOptions options;
+		options.TargetError = 1.0f;    // 개수로만 제한 (오차는 단계 선택에서 판단)
+		options.PreserveBoundary = true;
+
+		while (levels.size() < MaxLevels)
+		{
+			const MeshLODLevel& previous = levels.back();
+			size_t triangleCount = previous.Indices.size() / 3;
+			if (triangleCount / 2 < MinTriangles)
+				break;
+
+			options.TargetTriangleCount = triangleCount / 2;
+			SimplifyResult result = MeshSimplifier::Simplify(vertices, previous.Indices, options, nullptr, cancel);
+			if (result.Cancelled)
+				return {};
+
+			// 거의 줄지 않으면 (경계뿐인 메쉬 등) 더 만들어도 의미 없음
+			if (result.TriangleCount * 10 > triangleCount * 9)
+				break;
+
+			MeshLODLevel level;
+			level.Indices = std::move(result.Indices);
+			level.Error = previous.Error + result.Error * extent;
+			levels.push_back(std::move(level));
+		}
+		return levels;
+	}
+
+	uint32_t MeshLOD::SelectLevel(const std::vector<float>& levelErrors, float pixelsPerUnit, float pixelThreshold)
+	{
+		uint32_t selected = 0;
+		for (uint32_t i = 1; i < levelErrors.size(); i++)
+		{
+			if (levelErrors[i] * pixelsPerUnit > pixelThreshold)
+				break;
+			selected = i;
+		}
+		return selected;
+	}
+
+	bool LODBuildTask::Start(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices)
+	{
+		return BackgroundTask::Start([vertices, indices](const std::atomic<bool>& cancel, std::atomic<float>&)
+		{
+			return MeshLOD::Build(vertices, indices, &cancel);
+		});
+	}
+
+	bool LODBuildTask::TakeResult(std::vector<MeshLODLevel>& outLevels)
+	{
+		return BackgroundTask::TakeResult(outLevels) && !outLevels.empty();
+	}
+}
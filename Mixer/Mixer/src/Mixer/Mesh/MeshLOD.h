@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Mixer/BackgroundTask.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+namespace Mixer {
+
+	struct MeshLODLevel
+	{
+		std::vector<uint32_t> Indices; // 원본 정점 버퍼를 그대로 참조
+		float Error = 0.0f;            // 원본 대비 오차 (월드 단위, 누적)
+	};
+
+	// 단순화 단계 목록 (0단계 = 원본). 모든 단계가 같은 정점 버퍼를 공유하므로
+	// 단계 전환은 인덱스 버퍼만 바꾸면 됨
+	class MeshLOD
+	{
+	public:
+		static constexpr uint32_t MaxLevels = 6;
+		static constexpr size_t MinTriangles = 256; // 이보다 작은 단계는 만들지 않음
+
+		// 다음 단계는 이전 단계의 절반 (이전 결과를 이어서 단순화)
+		static std::vector<MeshLODLevel> Build(const std::vector<glm::vec3>& vertices,
+			const std::vector<uint32_t>& indices,
+			const std::atomic<bool>* cancel = nullptr);
+
+		// 화면에서 오차가 pixelThreshold 픽셀 이하인 가장 거친 단계
+		// pixelsPerUnit: 메쉬 위치에서 월드 1 단위가 화면에서 차지하는 픽셀 수
+		static uint32_t SelectLevel(const std::vector<float>& levelErrors, float pixelsPerUnit, float pixelThreshold);
+	};
+
+	// 백그라운드 LOD 생성
+	class LODBuildTask : public BackgroundTask<std::vector<MeshLODLevel>>
+	{
+	public:
+		bool Start(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+		// 취소된 작업(빈 결과)은 false
+		bool TakeResult(std::vector<MeshLODLevel>& outLevels);
+	};
+}
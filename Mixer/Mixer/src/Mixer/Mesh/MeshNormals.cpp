@@ -0,0 +1,267 @@
+#include "mxpch.h"
+#include "MeshNormals.h"
+#include "Mixer/JobSystem.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#include <xmmintrin.h>
+	#define MX_NORMALS_SSE
+#endif
+
+namespace Mixer {
+
+	static constexpr uint32_t NormalJobGroupSize = 4096;
+	// 바뀐 구간 사이 간격이 이 정점 수 이하면 한 구간으로 (업로드 명령 수 < 몇 백 바이트 더 복사)
+	static constexpr uint32_t RangeMergeGap = 32;
+	// 구간이 이보다 많으면 처음~끝 한 구간으로 (흩어진 선택)
+	static constexpr size_t MaxChangedRanges = 64;
+
+	// 면 목록 faces[begin, end)의 외적 계산. SSE로 삼각형 4개씩 처리
+	static void ComputeFaceNormals(const glm::vec3* vertices, const uint32_t* indices,
+		const uint32_t* faces, uint32_t begin, uint32_t end, glm::vec3* outNormals)
+	{
+		uint32_t i = begin;
+#ifdef MX_NORMALS_SSE
+		alignas(16) float e1[3][4], e2[3][4], n[3][4];
+		for (; i + 4 <= end; i += 4)
+		{
+			// 4개 삼각형의 두 변을 SoA로 모음
+			for (int k = 0; k < 4; k++)
+			{
+				const uint32_t* tri = &indices[faces[i + k] * 3];
+				const glm::vec3& a = vertices[tri[0]];
+				const glm::vec3& b = vertices[tri[1]];
+				const glm::vec3& c = vertices[tri[2]];
+				for (int axis = 0; axis < 3; axis++)
+				{
+					e1[axis][k] = b[axis] - a[axis];
+					e2[axis][k] = c[axis] - a[axis];
+				}
+			}
+
+			__m128 e1x = _mm_load_ps(e1[0]), e1y = _mm_load_ps(e1[1]), e1z = _mm_load_ps(e1[2]);
+			__m128 e2x = _mm_load_ps(e2[0]), e2y = _mm_load_ps(e2[1]), e2z = _mm_load_ps(e2[2]);
+
+			_mm_store_ps(n[0], _mm_sub_ps(_mm_mul_ps(e1y, e2z), _mm_mul_ps(e1z, e2y)));
+			_mm_store_ps(n[1], _mm_sub_ps(_mm_mul_ps(e1z, e2x), _mm_mul_ps(e1x, e2z)));
+			_mm_store_ps(n[2], _mm_sub_ps(_mm_mul_ps(e1x, e2y), _mm_mul_ps(e1y, e2x)));
+
+			for (int k = 0; k < 4; k++)
+				outNormals[faces[i + k]] = { n[0][k], n[1][k], n[2][k] };
+		}
+#endif
+		for (; i < end; i++)
+		{
+			const uint32_t* tri = &indices[faces[i] * 3];
+			const glm::vec3& a = vertices[tri[0]];
+			outNormals[faces[i]] = glm::cross(vertices[tri[1]] - a, vertices[tri[2]] - a);
+		}
+	}
+
+	void MeshNormals::MarkDirty(uint32_t vertex)
+	{
+		if (m_NeedsFullRebuild)
+			return;
+
+		if (vertex >= m_VertexDirtyFlags.size())
+			m_VertexDirtyFlags.resize(vertex + 1, 0);
+		AddDirtyVertex(vertex);
+	}
+
+	void MeshNormals::AddDirtyVertex(uint32_t vertex)
+	{
+		if (m_VertexDirtyFlags[vertex])
+			return;
+		m_VertexDirtyFlags[vertex] = 1;
+		m_DirtyVertices.push_back(vertex);
+	}
+
+	void MeshNormals::AddDirtyFace(uint32_t face)
+	{
+		if (m_FaceDirtyFlags[face])
+			return;
+		m_FaceDirtyFlags[face] = 1;
+		m_DirtyFaces.push_back(face);
+	}
+
+	void MeshNormals::Update(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices)
+	{
+		size_t faceCount = indices.size() / 3;
+		m_ChangedRanges.clear();
+		bool appendOnly = vertices.size() >= m_VertexCount && indices.size() >= m_IndexCount;
+
+		// 1. 전체 재계산 (처음, 최적화 후, 삭제 등)
+		if (m_NeedsFullRebuild || !appendOnly)
+		{
+			m_FaceNormals.assign(faceCount, glm::vec3(0.0f));
+			m_VertexNormals.assign(vertices.size(), glm::vec3(0.0f));
+			RebuildAdjacency(vertices.size(), indices);
+
+			std::vector<uint32_t> all(std::max(faceCount, vertices.size()));
+			for (uint32_t i = 0; i < all.size(); i++)
+				all[i] = i;
+
+			RecomputeFaces(vertices, indices, std::vector<uint32_t>(all.begin(), all.begin() + faceCount));
+			RecomputeVertices(std::vector<uint32_t>(all.begin(), all.begin() + vertices.size()));
+
+			m_DirtyVertices.clear();
+			m_VertexDirtyFlags.assign(vertices.size(), 0);
+			m_FaceDirtyFlags.assign(faceCount, 0);
+			m_UpdateFlags.assign(vertices.size(), 0);
+			m_VertexCount = vertices.size();
+			m_IndexCount = indices.size();
+			m_NeedsFullRebuild = false;
+			if (!vertices.empty())
+				m_ChangedRanges.push_back({ 0, (uint32_t)vertices.size() });
+			return;
+		}
+
+		// 2. 뒤에 추가된 정점/면 (Extrude, 면 생성): 새 면의 정점만 dirty로 표시
+		if (vertices.size() != m_VertexCount || indices.size() != m_IndexCount)
+		{
+			size_t oldFaceCount = m_IndexCount / 3;
+			m_FaceNormals.resize(faceCount, glm::vec3(0.0f));
+			m_VertexNormals.resize(vertices.size(), glm::vec3(0.0f));
+			m_VertexDirtyFlags.resize(vertices.size(), 0);
+			m_UpdateFlags.resize(vertices.size(), 0);
+			m_FaceDirtyFlags.resize(faceCount, 0);
+
+			if (indices.size() != m_IndexCount)
+				RebuildAdjacency(vertices.size(), indices);
+			else
+				m_AdjOffsets.resize(vertices.size() + 1, m_AdjOffsets.empty() ? 0 : m_AdjOffsets.back());
+
+			for (size_t f = oldFaceCount; f < faceCount; f++)
+			{
+				for (int j = 0; j < 3; j++)
+					AddDirtyVertex(indices[f * 3 + j]);
+			}
+
+			m_VertexCount = vertices.size();
+			m_IndexCount = indices.size();
+		}
+
+		if (m_DirtyVertices.empty())
+			return;
+
+		// 3. 움직인 정점에 닿은 면 -> 그 면들의 정점 순서로 갱신
+		for (uint32_t v : m_DirtyVertices)
+		{
+			if (v >= m_VertexCount)
+				continue;
+			for (uint32_t a = m_AdjOffsets[v]; a < m_AdjOffsets[v + 1]; a++)
+				AddDirtyFace(m_AdjFaces[a]);
+		}
+		RecomputeFaces(vertices, indices, m_DirtyFaces);
+
+		m_UpdateVertices.clear();
+		for (uint32_t v : m_DirtyVertices)
+		{
+			if (v < m_VertexCount && !m_UpdateFlags[v])
+			{
+				m_UpdateFlags[v] = 1;
+				m_UpdateVertices.push_back(v);
+			}
+		}
+		for (uint32_t f : m_DirtyFaces)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				uint32_t v = indices[f * 3 + j];
+				if (!m_UpdateFlags[v])
+				{
+					m_UpdateFlags[v] = 1;
+					m_UpdateVertices.push_back(v);
+				}
+			}
+		}
+		RecomputeVertices(m_UpdateVertices);
+
+		// 플래그 초기화 (목록에 있는 것만)
+		for (uint32_t v : m_DirtyVertices)
+			m_VertexDirtyFlags[v] = 0;
+		for (uint32_t f : m_DirtyFaces)
+			m_FaceDirtyFlags[f] = 0;
+		for (uint32_t v : m_UpdateVertices)
+			m_UpdateFlags[v] = 0;
+		m_DirtyVertices.clear();
+		m_DirtyFaces.clear();
+
+		BuildChangedRanges();
+	}
+
+	void MeshNormals::BuildChangedRanges()
+	{
+		if (m_UpdateVertices.empty())
+			return;
+
+		std::sort(m_UpdateVertices.begin(), m_UpdateVertices.end());
+		Range current = { m_UpdateVertices[0], 1 };
+		for (size_t i = 1; i < m_UpdateVertices.size(); i++)
+		{
+			uint32_t v = m_UpdateVertices[i];
+			if (v - (current.First + current.Count) <= RangeMergeGap)
+			{
+				current.Count = v - current.First + 1;
+				continue;
+			}
+			m_ChangedRanges.push_back(current);
+			current = { v, 1 };
+		}
+		m_ChangedRanges.push_back(current);
+
+		if (m_ChangedRanges.size() > MaxChangedRanges)
+		{
+			uint32_t first = m_ChangedRanges.front().First;
+			const Range& last = m_ChangedRanges.back();
+			m_ChangedRanges.assign(1, { first, last.First + last.Count - first });
+		}
+	}
+
+	void MeshNormals::RebuildAdjacency(size_t vertexCount, const std::vector<uint32_t>& indices)
+	{
+		size_t faceCount = indices.size() / 3;
+		m_AdjOffsets.assign(vertexCount + 1, 0);
+		for (size_t i = 0; i < faceCount * 3; i++)
+			m_AdjOffsets[indices[i] + 1]++;
+		for (size_t v = 0; v < vertexCount; v++)
+			m_AdjOffsets[v + 1] += m_AdjOffsets[v];
+
+		m_AdjFaces.resize(m_AdjOffsets[vertexCount]);
+		std::vector<uint32_t> fill(m_AdjOffsets.begin(), m_AdjOffsets.end() - 1);
+		for (size_t f = 0; f < faceCount; f++)
+		{
+			for (int j = 0; j < 3; j++)
+				m_AdjFaces[fill[indices[f * 3 + j]]++] = (uint32_t)f;
+		}
+	}
+
+	void MeshNormals::RecomputeFaces(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, const std::vector<uint32_t>& faces)
+	{
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)faces.size(), NormalJobGroupSize, [&](uint32_t begin, uint32_t end)
+		{
+			ComputeFaceNormals(vertices.data(), indices.data(), faces.data(), begin, end, m_FaceNormals.data());
+		});
+		JobSystem::Wait(context);
+	}
+
+	void MeshNormals::RecomputeVertices(const std::vector<uint32_t>& verticesToUpdate)
+	{
+		// 정점마다 인접 면 법선을 모아서 더함 (Gather) - 스레드 간 쓰기 충돌 없음
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)verticesToUpdate.size(), NormalJobGroupSize, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				uint32_t v = verticesToUpdate[i];
+				glm::vec3 sum(0.0f);
+				for (uint32_t a = m_AdjOffsets[v]; a < m_AdjOffsets[v + 1]; a++)
+					sum += m_FaceNormals[m_AdjFaces[a]];
+
+				float length = glm::length(sum);
+				m_VertexNormals[v] = length > 1e-20f ? sum / length : glm::vec3(0.0f);
+			}
+		});
+		JobSystem::Wait(context);
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 면(Face) / 정점(Vertex) 법선 버퍼
+	// 움직인 정점에 닿은 면과 그 면의 정점만 다시 계산 (G 드래그 중 전체 재계산 방지)
+	class MeshNormals
+	{
+	public:
+		// 정점 법선 구간 [First, First + Count)
+		struct Range
+		{
+			uint32_t First;
+			uint32_t Count;
+		};
+
+		// 정점이 움직였음을 기록
+		void MarkDirty(uint32_t vertex);
+		// 인덱스 순서가 통째로 바뀐 경우 (최적화 등) 다음 Update에서 전체 재계산
+		void Invalidate() { m_NeedsFullRebuild = true; }
+
+		// 인덱스/정점이 뒤에 추가되기만 했으면 새 면만 계산, 아니면 Invalidate 이후 전체 계산
+		void Update(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+
+		// 면 법선은 정규화하지 않은 외적 (길이 = 면적 x 2, 정점 법선의 면적 가중치로 사용)
+		const std::vector<glm::vec3>& GetFaceNormals() const { return m_FaceNormals; }
+		const std::vector<glm::vec3>& GetVertexNormals() const { return m_VertexNormals; }
+		// 마지막 Update에서 다시 계산한 정점 법선 구간 (번호 순, GPU 부분 업로드용). 없으면 빈 목록
+		const std::vector<Range>& GetChangedRanges() const { return m_ChangedRanges; }
+
+	private:
+		void RebuildAdjacency(size_t vertexCount, const std::vector<uint32_t>& indices);
+		void RecomputeFaces(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, const std::vector<uint32_t>& faces);
+		void RecomputeVertices(const std::vector<uint32_t>& verticesToUpdate);
+		void AddDirtyFace(uint32_t face);
+		void AddDirtyVertex(uint32_t vertex);
+		void BuildChangedRanges();
+
+	private:
+		std::vector<glm::vec3> m_FaceNormals;
+		std::vector<glm::vec3> m_VertexNormals;
+
+		// 정점 -> 면 인접 리스트 (CSR)
+		std::vector<uint32_t> m_AdjOffsets;
+		std::vector<uint32_t> m_AdjFaces;
+
+		size_t m_VertexCount = 0;
+		size_t m_IndexCount = 0;
+		bool m_NeedsFullRebuild = true;
+
+		// 이번 프레임에 다시 계산할 목록 (중복 방지 플래그 포함)
+		std::vector<uint32_t> m_DirtyVertices;
+		std::vector<uint8_t> m_VertexDirtyFlags;
+		std::vector<uint32_t> m_DirtyFaces;
+		std::vector<uint8_t> m_FaceDirtyFlags;
+		std::vector<uint32_t> m_UpdateVertices;
+		std::vector<uint8_t> m_UpdateFlags;
+		std::vector<Range> m_ChangedRanges;
+	};
+}
@@ -0,0 +1,188 @@
+#include "mxpch.h"
+#include "MeshOptimizer.h"
+
+namespace Mixer {
+
+	MeshOptimizeStats MeshOptimizer::Optimize(std::vector<glm::vec3>& vertices,
+		std::vector<uint32_t>& indices,
+		std::vector<uint32_t>& edgeIndices,
+		std::vector<uint32_t>& remap)
+	{
+		MeshOptimizeStats stats;
+		stats.VerticesBefore = vertices.size();
+		stats.ACMRBefore = ComputeACMR(indices, vertices.size());
+
+		// 1. 삼각형 순서 재정렬 (정점 번호는 그대로)
+		OptimizeVertexCache(indices, vertices.size());
+
+		// 2. 정점 순서 재정렬 + 미사용 정점 제거
+		size_t newCount = GenerateFetchRemap(remap, vertices.size(), indices, edgeIndices);
+		RemapIndices(indices, remap);
+		RemapIndices(edgeIndices, remap);
+		RemapVertices(vertices, remap, newCount);
+
+		stats.VerticesAfter = vertices.size();
+		stats.ACMRAfter = ComputeACMR(indices, vertices.size());
+		stats.Use16BitIndices = CanUse16BitIndices(vertices.size());
+		return stats;
+	}
+
+	float MeshOptimizer::ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+	{
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0)
+			return 0.0f;
+
+		// 정점마다 "캐시에 들어간 시각"을 기록하면 FIFO 캐시를 O(1)로 흉내낼 수 있음
+		std::vector<uint32_t> timestamp(vertexCount, 0);
+		uint32_t time = cacheSize + 1;
+		size_t misses = 0;
+
+		for (size_t i = 0; i < triangleCount * 3; i++)
+		{
+			uint32_t v = indices[i];
+			if (time - timestamp[v] > cacheSize)
+			{
+				timestamp[v] = time++;
+				misses++;
+			}
+		}
+
+		return (float)misses / (float)triangleCount;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+	{
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0)
+			return;
+
+		// 1. 정점 -> 삼각형 인접 리스트 (CSR)
+		std::vector<uint32_t> liveCount(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			liveCount[indices[i]]++;
+
+		std::vector<uint32_t> adjOffset(vertexCount + 1, 0);
+		for (size_t v = 0; v < vertexCount; v++)
+			adjOffset[v + 1] = adjOffset[v] + liveCount[v];
+
+		std::vector<uint32_t> adjTriangles(adjOffset[vertexCount]);
+		std::vector<uint32_t> fill(adjOffset.begin(), adjOffset.end() - 1);
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			for (int j = 0; j < 3; j++)
+				adjTriangles[fill[indices[t * 3 + j]]++] = (uint32_t)t;
+		}
+
+		// 2. Tipsify
+		std::vector<uint32_t> cacheTime(vertexCount, 0);
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> deadEndStack;
+		std::vector<uint32_t> candidates;
+		std::vector<uint32_t> result;
+		result.reserve(triangleCount * 3);
+
+		uint32_t timeStamp = cacheSize + 1;
+		size_t cursor = 0;
+		int64_t fanning = 0;
+
+		while (fanning >= 0)
+		{
+			candidates.clear();
+
+			// 현재 정점(fanning)을 공유하는 삼각형을 전부 출력
+			for (uint32_t a = adjOffset[fanning]; a < adjOffset[fanning + 1]; a++)
+			{
+				uint32_t t = adjTriangles[a];
+				if (emitted[t])
+					continue;
+
+				for (int j = 0; j < 3; j++)
+				{
+					uint32_t v = indices[t * 3 + j];
+					result.push_back(v);
+					deadEndStack.push_back(v);
+					candidates.push_back(v);
+					liveCount[v]--;
+
+					if (timeStamp - cacheTime[v] > cacheSize)
+						cacheTime[v] = timeStamp++;
+				}
+				emitted[t] = true;
+			}
+
+			// 다음 fanning 정점 선택: 캐시에 남아있을 정점 중 가장 오래된 것
+			int64_t next = -1;
+			int64_t bestPriority = -1;
+			for (uint32_t v : candidates)
+			{
+				if (liveCount[v] == 0)
+					continue;
+
+				int64_t priority = 0;
+				if (timeStamp - cacheTime[v] + 2 * liveCount[v] <= cacheSize)
+					priority = timeStamp - cacheTime[v];
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					next = v;
+				}
+			}
+
+			// 후보가 없으면 dead-end 스택 -> 순차 탐색 순서로 복귀
+			if (next == -1)
+			{
+				while (!deadEndStack.empty())
+				{
+					uint32_t d = deadEndStack.back();
+					deadEndStack.pop_back();
+					if (liveCount[d] > 0)
+					{
+						next = d;
+						break;
+					}
+				}
+
+				while (next == -1 && cursor < vertexCount)
+				{
+					if (liveCount[cursor] > 0)
+						next = (int64_t)cursor;
+					cursor++;
+				}
+			}
+
+			fanning = next;
+		}
+
+		indices.swap(result);
+	}
+
+	size_t MeshOptimizer::GenerateFetchRemap(std::vector<uint32_t>& remap, size_t vertexCount,
+		const std::vector<uint32_t>& indices, const std::vector<uint32_t>& edgeIndices)
+	{
+		remap.assign(vertexCount, InvalidIndex);
+		uint32_t next = 0;
+
+		for (uint32_t v : indices)
+		{
+			if (remap[v] == InvalidIndex)
+				remap[v] = next++;
+		}
+
+		// 면이 없는 고립된 선(Edge)의 정점도 "사용 중"으로 취급
+		for (uint32_t v : edgeIndices)
+		{
+			if (remap[v] == InvalidIndex)
+				remap[v] = next++;
+		}
+
+		return next;
+	}
+
+	void MeshOptimizer::RemapIndices(std::vector<uint32_t>& indices, const std::vector<uint32_t>& remap)
+	{
+		for (uint32_t& index : indices)
+			index = remap[index];
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 최적화 결과 (로그 출력용)
+	struct MeshOptimizeStats
+	{
+		size_t VerticesBefore = 0;
+		size_t VerticesAfter = 0;
+		float ACMRBefore = 0.0f; // Average Cache Miss Ratio (삼각형당 캐시 미스 수)
+		float ACMRAfter = 0.0f;
+		bool Use16BitIndices = false;
+	};
+
+	class MeshOptimizer
+	{
+	public:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+		static constexpr uint32_t DefaultCacheSize = 16;
+
+		// 전체 파이프라인: 미사용 정점 제거 -> 삼각형 순서 최적화(Tipsify) -> 정점 순서 최적화
+		// remap[old] = new (제거된 정점은 InvalidIndex). 선택 목록 등을 갱신할 때 사용
+		static MeshOptimizeStats Optimize(std::vector<glm::vec3>& vertices,
+			std::vector<uint32_t>& indices,
+			std::vector<uint32_t>& edgeIndices,
+			std::vector<uint32_t>& remap);
+
+		// FIFO 캐시 시뮬레이션으로 ACMR 계산
+		static float ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = DefaultCacheSize);
+
+		// Tipsify (Sander et al. 2007): 삼각형 순서를 post-transform 캐시에 맞게 재정렬 (O(n))
+		static void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = DefaultCacheSize);
+
+		// 인덱스에서 처음 등장하는 순서대로 정점 번호를 다시 매김 (참조되지 않는 정점은 제거)
+		// 반환값: 새 정점 개수
+		static size_t GenerateFetchRemap(std::vector<uint32_t>& remap, size_t vertexCount,
+			const std::vector<uint32_t>& indices, const std::vector<uint32_t>& edgeIndices);
+
+		static void RemapIndices(std::vector<uint32_t>& indices, const std::vector<uint32_t>& remap);
+
+		template<typename T>
+		static void RemapVertices(std::vector<T>& vertices, const std::vector<uint32_t>& remap, size_t newCount)
+		{
+			std::vector<T> result(newCount);
+			for (size_t i = 0; i < vertices.size(); i++)
+			{
+				if (remap[i] != InvalidIndex)
+					result[remap[i]] = vertices[i];
+			}
+			vertices.swap(result);
+		}
+
+		// 정점 수가 65535 이하이면 16비트 인덱스로 충분
+		static bool CanUse16BitIndices(size_t vertexCount) { return vertexCount <= 0xFFFF; }
+	};
+}
@@ -0,0 +1,399 @@
+#include "mxpch.h"
+#include "MeshSimplifier.h"
+
+#include <cmath>
+#include <cfloat>
+
+namespace Mixer {
+
+	static constexpr uint32_t SimplifyJobGroupSize = 4096;
+
+	namespace {
+
+		// 대칭 4x4 행렬 (상삼각 10개). 평면 (a, b, c, d)까지 거리 제곱의 합
+		// 면적 가중치 합(Weight)으로 나눠서 평균 거리 제곱으로 평가 -> 오차 기준과 단위가 같음
+		struct Quadric
+		{
+			double A[10] = {};
+			double Weight = 0.0;
+
+			void AddPlane(const glm::dvec3& n, double d, double weight)
+			{
+				A[0] += weight * n.x * n.x; A[1] += weight * n.x * n.y; A[2] += weight * n.x * n.z; A[3] += weight * n.x * d;
+				A[4] += weight * n.y * n.y; A[5] += weight * n.y * n.z; A[6] += weight * n.y * d;
+				A[7] += weight * n.z * n.z; A[8] += weight * n.z * d;
+				A[9] += weight * d * d;
+				Weight += weight;
+			}
+
+			void Add(const Quadric& other)
+			{
+				for (int i = 0; i < 10; i++)
+					A[i] += other.A[i];
+				Weight += other.Weight;
+			}
+
+			double Evaluate(const glm::vec3& p) const
+			{
+				double x = p.x, y = p.y, z = p.z;
+				double result = A[0] * x * x + 2.0 * A[1] * x * y + 2.0 * A[2] * x * z + 2.0 * A[3] * x
+					+ A[4] * y * y + 2.0 * A[5] * y * z + 2.0 * A[6] * y
+					+ A[7] * z * z + 2.0 * A[8] * z
+					+ A[9];
+				return Weight > 0.0 ? std::max(result, 0.0) / Weight : 0.0;
+			}
+		};
+
+		struct Collapse
+		{
+			uint32_t From = 0, To = 0;
+			float Cost = 0.0f;
+		};
+
+		uint64_t EdgeKey(uint32_t a, uint32_t b)
+		{
+			return ((uint64_t)std::min(a, b) << 32) | std::max(a, b);
+		}
+
+		// 엣지 c.From -> c.To 합치기가 안전한지 검사
+		// neighbors는 호출한 스레드의 작업용 버퍼
+		bool IsCollapseValid(const Collapse& c, const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& triangles,
+			const std::vector<uint32_t>& adjOffsets, const std::vector<uint32_t>& adjFaces, std::vector<uint32_t>& neighbors)
+		{
+			// 링크 조건: 두 점의 공통 이웃 수 == 엣지를 공유하는 면 수 (아니면 토폴로지가 꼬임)
+			neighbors.clear();
+			uint32_t sharedFaces = 0;
+			for (uint32_t a = adjOffsets[c.From]; a < adjOffsets[c.From + 1]; a++)
+			{
+				const uint32_t* tri = &triangles[adjFaces[a] * 3];
+				bool hasTo = tri[0] == c.To || tri[1] == c.To || tri[2] == c.To;
+				sharedFaces += hasTo ? 1 : 0;
+				for (int j = 0; j < 3; j++)
+				{
+					if (tri[j] != c.From && tri[j] != c.To)
+						neighbors.push_back(tri[j]);
+				}
+			}
+			std::sort(neighbors.begin(), neighbors.end());
+			neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+			uint32_t common = 0;
+			for (uint32_t a = adjOffsets[c.To]; a < adjOffsets[c.To + 1]; a++)
+			{
+				const uint32_t* tri = &triangles[adjFaces[a] * 3];
+				for (int j = 0; j < 3; j++)
+				{
+					auto it = std::lower_bound(neighbors.begin(), neighbors.end(), tri[j]);
+					if (it != neighbors.end() && *it == tri[j])
+					{
+						common++;
+						neighbors.erase(it); // 한 번만 셈
+					}
+				}
+			}
+			if (common != sharedFaces)
+				return false;
+
+			// 면 뒤집힘 검사: 남는 면의 법선이 크게 돌아가거나 찌그러지면 거부
+			for (uint32_t a = adjOffsets[c.From]; a < adjOffsets[c.From + 1]; a++)
+			{
+				const uint32_t* tri = &triangles[adjFaces[a] * 3];
+				if (tri[0] == c.To || tri[1] == c.To || tri[2] == c.To)
+					continue;
+
+				glm::vec3 p[3], q[3];
+				for (int j = 0; j < 3; j++)
+				{
+					p[j] = vertices[tri[j]];
+					q[j] = tri[j] == c.From ? vertices[c.To] : p[j];
+				}
+				glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+				glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+				float lengthBefore = glm::length(before), lengthAfter = glm::length(after);
+				if (lengthBefore < 1e-12f)
+					continue; // 원래 찌그러진 면 (같은 위치의 점) -> 더 나빠질 게 없음
+				if (lengthAfter < 1e-12f || glm::dot(before, after) < 0.25f * lengthBefore * lengthAfter)
+					return false;
+			}
+			return true;
+		}
+
+		// 정점 -> 삼각형 인접 리스트 (CSR)
+		void BuildAdjacency(size_t vertexCount, const std::vector<uint32_t>& triangles,
+			std::vector<uint32_t>& offsets, std::vector<uint32_t>& faces)
+		{
+			offsets.assign(vertexCount + 1, 0);
+			for (uint32_t v : triangles)
+				offsets[v + 1]++;
+			for (size_t v = 0; v < vertexCount; v++)
+				offsets[v + 1] += offsets[v];
+
+			faces.resize(triangles.size());
+			std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+			for (size_t i = 0; i < triangles.size(); i++)
+				faces[fill[triangles[i]]++] = (uint32_t)(i / 3);
+		}
+	}
+
+	SimplifyResult MeshSimplifier::Simplify(const std::vector<glm::vec3>& vertices,
+		const std::vector<uint32_t>& indices,
+		const SimplifyOptions& options,
+		std::atomic<float>* progress,
+		const std::atomic<bool>* cancel)
+	{
+		SimplifyResult result;
+		size_t vertexCount = vertices.size();
+
+		// 1. 퇴화 삼각형(같은 점이 두 번) 제거한 작업용 복사본
+		std::vector<uint32_t> triangles;
+		triangles.reserve(indices.size());
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+			if (a == b || b == c || c == a)
+				continue;
+			triangles.insert(triangles.end(), { a, b, c });
+		}
+
+		size_t initialCount = triangles.size() / 3;
+		size_t targetCount = std::min(options.TargetTriangleCount, initialCount);
+
+		// 2. 오차 기준: 바운딩 박스 대각선
+		glm::vec3 minPos(FLT_MAX), maxPos(-FLT_MAX);
+		for (const auto& p : vertices)
+		{
+			minPos = glm::min(minPos, p);
+			maxPos = glm::max(maxPos, p);
+		}
+		float extent = vertices.empty() ? 1.0f : std::max(glm::length(maxPos - minPos), 1e-6f);
+		double errorLimit = (double)options.TargetError * extent;
+		errorLimit *= errorLimit;
+
+		std::vector<uint32_t> adjOffsets, adjFaces;
+		BuildAdjacency(vertexCount, triangles, adjOffsets, adjFaces);
+
+		// 3. 경계 정점 찾기 (면이 하나뿐인 엣지의 두 끝점)
+		std::vector<uint8_t> locked(vertexCount, 0);
+		if (options.PreserveBoundary)
+		{
+			std::vector<uint64_t> edgeKeys;
+			edgeKeys.reserve(triangles.size());
+			for (size_t i = 0; i < triangles.size(); i += 3)
+			{
+				for (int j = 0; j < 3; j++)
+					edgeKeys.push_back(EdgeKey(triangles[i + j], triangles[i + (j + 1) % 3]));
+			}
+			std::sort(edgeKeys.begin(), edgeKeys.end());
+			for (size_t i = 0; i < edgeKeys.size();)
+			{
+				size_t j = i;
+				while (j < edgeKeys.size() && edgeKeys[j] == edgeKeys[i])
+					j++;
+				if (j - i == 1)
+				{
+					locked[edgeKeys[i] >> 32] = 1;
+					locked[edgeKeys[i] & 0xFFFFFFFF] = 1;
+				}
+				i = j;
+			}
+		}
+
+		// 4. 정점마다 인접 면 평면의 Quadric 합 (면적 가중, 정점 단위 Gather라 병렬 안전)
+		std::vector<Quadric> quadrics(vertexCount);
+		{
+			JobContext context;
+			JobSystem::Dispatch(context, (uint32_t)vertexCount, SimplifyJobGroupSize, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t v = begin; v < end; v++)
+				{
+					for (uint32_t a = adjOffsets[v]; a < adjOffsets[v + 1]; a++)
+					{
+						const uint32_t* tri = &triangles[adjFaces[a] * 3];
+						glm::dvec3 p0 = vertices[tri[0]], p1 = vertices[tri[1]], p2 = vertices[tri[2]];
+						glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+						double area2 = glm::length(n);
+						if (area2 < 1e-20)
+							continue;
+						n /= area2;
+						quadrics[v].AddPlane(n, -glm::dot(n, p0), area2 * 0.5);
+					}
+				}
+			});
+			JobSystem::Wait(context);
+		}
+
+		// 5. 반복: 엣지 비용 계산 -> 병렬 검사 -> 독립 집합 선택 -> 병렬 적용 -> 압축
+		std::vector<uint8_t> marked(vertexCount, 0);
+		std::vector<uint64_t> edgeKeys;
+		std::vector<Collapse> candidates, batch;
+		std::vector<uint8_t> valid;
+		float maxAppliedCost = 0.0f;
+
+		while (triangles.size() / 3 > targetCount)
+		{
+			if (cancel && cancel->load())
+			{
+				result.Cancelled = true;
+				break;
+			}
+
+			// 5-1. 엣지 목록 (중복 제거)
+			edgeKeys.clear();
+			for (size_t i = 0; i < triangles.size(); i += 3)
+			{
+				for (int j = 0; j < 3; j++)
+					edgeKeys.push_back(EdgeKey(triangles[i + j], triangles[i + (j + 1) % 3]));
+			}
+			std::sort(edgeKeys.begin(), edgeKeys.end());
+			edgeKeys.erase(std::unique(edgeKeys.begin(), edgeKeys.end()), edgeKeys.end());
+
+			// 5-2. 엣지별 비용 (두 방향 중 싼 쪽, 잠긴 정점은 출발점이 될 수 없음)
+			candidates.resize(edgeKeys.size());
+			JobContext costContext;
+			JobSystem::Dispatch(costContext, (uint32_t)edgeKeys.size(), SimplifyJobGroupSize, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t e = begin; e < end; e++)
+				{
+					uint32_t a = (uint32_t)(edgeKeys[e] >> 32);
+					uint32_t b = (uint32_t)(edgeKeys[e] & 0xFFFFFFFF);
+					Quadric q = quadrics[a];
+					q.Add(quadrics[b]);
+
+					Collapse collapse = { a, b, FLT_MAX };
+					if (!locked[a])
+						collapse.Cost = (float)q.Evaluate(vertices[b]);
+					if (!locked[b])
+					{
+						float cost = (float)q.Evaluate(vertices[a]);
+						if (cost < collapse.Cost)
+							collapse = { b, a, cost };
+					}
+					candidates[e] = collapse;
+				}
+			});
+			JobSystem::Wait(costContext);
+
+			candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+				[errorLimit](const Collapse& c) { return (double)c.Cost > errorLimit; }), candidates.end());
+			if (candidates.empty())
+				break;
+			std::sort(candidates.begin(), candidates.end(), [](const Collapse& a, const Collapse& b) { return a.Cost < b.Cost; });
+
+			// 5-3. 토폴로지/뒤집힘 검사 (읽기 전용이라 병렬). 거부된 엣지가 독립 집합 자리를 차지하지 않도록 먼저 걸러냄
+			// 하위 1/3 비용까지만 검사해서 비싼 엣지가 먼저 합쳐지는 것을 막고, 전부 거부되면 나머지도 검사
+			size_t window = std::upper_bound(candidates.begin(), candidates.end(), candidates[candidates.size() / 3].Cost,
+				[](float cost, const Collapse& c) { return cost < c.Cost; }) - candidates.begin();
+			size_t checked = 0, validCount = 0;
+			while (checked < candidates.size() && validCount == 0)
+			{
+				valid.assign(window - checked, 0);
+				JobContext validContext;
+				JobSystem::Dispatch(validContext, (uint32_t)(window - checked), SimplifyJobGroupSize, [&](uint32_t begin, uint32_t end)
+				{
+					std::vector<uint32_t> neighbors;
+					for (uint32_t i = begin; i < end; i++)
+						valid[i] = IsCollapseValid(candidates[checked + i], vertices, triangles, adjOffsets, adjFaces, neighbors) ? 1 : 0;
+				});
+				JobSystem::Wait(validContext);
+
+				for (size_t i = 0; i < valid.size(); i++)
+				{
+					if (valid[i])
+						candidates[validCount++] = candidates[checked + i];
+				}
+				checked = window;
+				window = candidates.size();
+			}
+			candidates.resize(validCount);
+			if (candidates.empty())
+				break;
+
+			// 5-4. 독립 집합: 싼 순서로, 주변 삼각형이 이미 고른 엣지와 겹치지 않는 것만 선택
+			size_t trianglesToRemove = triangles.size() / 3 - targetCount;
+			batch.clear();
+			std::fill(marked.begin(), marked.end(), 0);
+
+			for (size_t i = 0; i < candidates.size() && batch.size() * 2 < trianglesToRemove + 1; i++)
+			{
+				const Collapse& c = candidates[i];
+				bool free = true;
+				for (uint32_t v : { c.From, c.To })
+				{
+					for (uint32_t a = adjOffsets[v]; a < adjOffsets[v + 1] && free; a++)
+					{
+						const uint32_t* tri = &triangles[adjFaces[a] * 3];
+						free = !marked[tri[0]] && !marked[tri[1]] && !marked[tri[2]];
+					}
+				}
+				if (!free)
+					continue;
+
+				for (uint32_t v : { c.From, c.To })
+				{
+					for (uint32_t a = adjOffsets[v]; a < adjOffsets[v + 1]; a++)
+					{
+						const uint32_t* tri = &triangles[adjFaces[a] * 3];
+						marked[tri[0]] = marked[tri[1]] = marked[tri[2]] = 1;
+					}
+				}
+				batch.push_back(c);
+				maxAppliedCost = std::max(maxAppliedCost, c.Cost);
+			}
+
+			// 5-5. 적용 (서로의 주변 삼각형이 겹치지 않으므로 병렬로 써도 안전, 검사 결과도 그대로 유효)
+			JobContext applyContext;
+			JobSystem::Dispatch(applyContext, (uint32_t)batch.size(), 256, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					const Collapse& c = batch[i];
+					for (uint32_t a = adjOffsets[c.From]; a < adjOffsets[c.From + 1]; a++)
+					{
+						uint32_t* tri = &triangles[adjFaces[a] * 3];
+						for (int j = 0; j < 3; j++)
+						{
+							if (tri[j] == c.From)
+								tri[j] = c.To;
+						}
+					}
+					quadrics[c.To].Add(quadrics[c.From]);
+				}
+			});
+			JobSystem::Wait(applyContext);
+
+			// 5-6. 퇴화 삼각형 압축 + 인접 리스트 재구성
+			size_t write = 0;
+			for (size_t i = 0; i < triangles.size(); i += 3)
+			{
+				uint32_t a = triangles[i], b = triangles[i + 1], c = triangles[i + 2];
+				if (a == b || b == c || c == a)
+					continue;
+				triangles[write++] = a;
+				triangles[write++] = b;
+				triangles[write++] = c;
+			}
+			triangles.resize(write);
+			BuildAdjacency(vertexCount, triangles, adjOffsets, adjFaces);
+
+			if (progress && initialCount > targetCount)
+				progress->store((float)(initialCount - triangles.size() / 3) / (float)(initialCount - targetCount));
+		}
+
+		if (progress)
+			progress->store(1.0f);
+
+		result.TriangleCount = triangles.size() / 3;
+		result.Error = std::sqrt(maxAppliedCost) / extent;
+		result.Indices = std::move(triangles);
+		return result;
+	}
+
+	bool SimplifyTask::Start(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, const SimplifyOptions& options)
+	{
+		// 입력은 복사해서 넘김 (편집이 계속되어도 워커는 시작 시점의 메쉬를 씀)
+		return BackgroundTask::Start([vertices, indices, options](const std::atomic<bool>& cancel, std::atomic<float>& progress)
+		{
+			return MeshSimplifier::Simplify(vertices, indices, options, &progress, &cancel);
+		});
+	}
+}
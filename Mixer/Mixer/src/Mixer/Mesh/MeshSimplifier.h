@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Mixer/BackgroundTask.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+namespace Mixer {
+
+	struct SimplifyOptions
+	{
+		size_t TargetTriangleCount = 0; // 이 개수 이하가 되면 중단
+		float TargetError = 0.01f;      // 허용 오차 (바운딩 박스 대각선 대비 비율)
+		bool PreserveBoundary = true;   // 경계 정점(열린 구멍의 테두리)은 움직이지 않음
+	};
+
+	struct SimplifyResult
+	{
+		std::vector<uint32_t> Indices;  // 원본 정점 번호를 그대로 참조하는 삼각형 목록
+		size_t TriangleCount = 0;
+		float Error = 0.0f;             // 실제 적용된 최대 오차 (대각선 대비 비율)
+		bool Cancelled = false;
+	};
+
+	// QEM(Garland-Heckbert) 기반 메쉬 단순화
+	// 엣지를 한쪽 끝점으로 합치는 방식(Half-Edge Collapse)이라 정점 위치는 바뀌지 않음
+	// -> 결과 인덱스 버퍼를 원본 정점 버퍼와 함께 프록시/LOD로 바로 사용 가능
+	// 한 번에 서로 겹치지 않는(독립 집합) 엣지들을 골라 병렬로 합침
+	class MeshSimplifier
+	{
+	public:
+		static SimplifyResult Simplify(const std::vector<glm::vec3>& vertices,
+			const std::vector<uint32_t>& indices,
+			const SimplifyOptions& options,
+			std::atomic<float>* progress = nullptr,
+			const std::atomic<bool>* cancel = nullptr);
+	};
+
+	// 백그라운드 단순화 작업 (입력을 복사해서 JobSystem 워커에서 실행)
+	class SimplifyTask : public BackgroundTask<SimplifyResult>
+	{
+	public:
+		// 이미 실행 중이면 false. 결과는 TakeResult로 한 번만
+		bool Start(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, const SimplifyOptions& options);
+	};
+}
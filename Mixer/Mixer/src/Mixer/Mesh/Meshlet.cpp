@@ -0,0 +1,215 @@
+#include "mxpch.h"
+#include "Meshlet.h"
+#include "Mixer/JobSystem.h"
+
+#include <cfloat>
+#include <cmath>
+
+namespace Mixer {
+
+	static constexpr uint32_t MeshletJobGroupSize = 256;
+
+	MeshletMesh MeshletBuilder::Build(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices)
+	{
+		MeshletMesh mesh;
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		uint32_t triangleCount = (uint32_t)(indices.size() / 3);
+		mesh.Indices.reserve(triangleCount * 3);
+
+		// 정점 -> 삼각형 인접 리스트 (CSR)
+		std::vector<uint32_t> adjOffsets(vertexCount + 1, 0), adjFaces(triangleCount * 3);
+		for (uint32_t i = 0; i < triangleCount * 3; i++)
+			adjOffsets[indices[i] + 1]++;
+		for (uint32_t v = 0; v < vertexCount; v++)
+			adjOffsets[v + 1] += adjOffsets[v];
+		{
+			std::vector<uint32_t> fill(adjOffsets.begin(), adjOffsets.end() - 1);
+			for (uint32_t i = 0; i < triangleCount * 3; i++)
+				adjFaces[fill[indices[i]]++] = i / 3;
+		}
+
+		std::vector<uint8_t> assigned(triangleCount, 0);
+		std::vector<uint32_t> vertexStamp(vertexCount, ~0u);    // 이 정점이 들어간 메쉬렛 번호
+		std::vector<uint32_t> candidateStamp(triangleCount, ~0u); // 후보 목록 중복 방지
+		std::vector<uint32_t> candidates;
+
+		uint32_t seed = 0;
+		while (true)
+		{
+			while (seed < triangleCount && assigned[seed])
+				seed++;
+			if (seed == triangleCount)
+				break;
+
+			uint32_t id = (uint32_t)mesh.Meshlets.size();
+			Meshlet meshlet;
+			meshlet.IndexOffset = (uint32_t)mesh.Indices.size();
+			uint32_t meshletVertices = 0, meshletTriangles = 0;
+
+			candidates.clear();
+			candidates.push_back(seed);
+			candidateStamp[seed] = id;
+
+			while (meshletTriangles < MaxTriangles)
+			{
+				// 새로 늘어나는 정점이 가장 적은 후보 (0개면 바로 선택)
+				uint32_t best = ~0u, bestNew = 4;
+				size_t write = 0;
+				for (size_t i = 0; i < candidates.size(); i++)
+				{
+					uint32_t t = candidates[i];
+					if (assigned[t])
+						continue;
+					candidates[write++] = t;
+
+					uint32_t newVertices = 0;
+					for (int j = 0; j < 3; j++)
+						newVertices += vertexStamp[indices[t * 3 + j]] != id ? 1 : 0;
+					if (newVertices < bestNew && meshletVertices + newVertices <= MaxVertices)
+					{
+						best = t;
+						bestNew = newVertices;
+					}
+				}
+				candidates.resize(write);
+
+				// 이어지는 삼각형이 없으면 여기서 끝 (멀리 떨어진 삼각형을 섞으면 바운딩 구가 커짐)
+				if (best == ~0u)
+					break;
+
+				assigned[best] = 1;
+				meshletTriangles++;
+				for (int j = 0; j < 3; j++)
+				{
+					uint32_t v = indices[best * 3 + j];
+					mesh.Indices.push_back(v);
+					if (vertexStamp[v] == id)
+						continue;
+
+					vertexStamp[v] = id;
+					meshletVertices++;
+					for (uint32_t a = adjOffsets[v]; a < adjOffsets[v + 1]; a++)
+					{
+						uint32_t neighbor = adjFaces[a];
+						if (!assigned[neighbor] && candidateStamp[neighbor] != id)
+						{
+							candidateStamp[neighbor] = id;
+							candidates.push_back(neighbor);
+						}
+					}
+				}
+			}
+
+			meshlet.IndexCount = (uint32_t)mesh.Indices.size() - meshlet.IndexOffset;
+			mesh.Meshlets.push_back(meshlet);
+		}
+
+		UpdateBounds(vertices, mesh);
+		return mesh;
+	}
+
+	void MeshletBuilder::UpdateBounds(const std::vector<glm::vec3>& vertices, MeshletMesh& mesh)
+	{
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)mesh.Meshlets.size(), MeshletJobGroupSize, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				ComputeBounds(vertices, mesh.Indices, mesh.Meshlets[i]);
+		});
+		JobSystem::Wait(context);
+	}
+
+	void MeshletBuilder::ComputeBounds(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, Meshlet& meshlet)
+	{
+		uint32_t begin = meshlet.IndexOffset, end = meshlet.IndexOffset + meshlet.IndexCount;
+
+		// 1. 바운딩 구: AABB 중심 + 가장 먼 점까지 거리
+		glm::vec3 minPos(FLT_MAX), maxPos(-FLT_MAX);
+		for (uint32_t i = begin; i < end; i++)
+		{
+			minPos = glm::min(minPos, vertices[indices[i]]);
+			maxPos = glm::max(maxPos, vertices[indices[i]]);
+		}
+		meshlet.Center = (minPos + maxPos) * 0.5f;
+		float radiusSq = 0.0f;
+		for (uint32_t i = begin; i < end; i++)
+		{
+			glm::vec3 d = vertices[indices[i]] - meshlet.Center;
+			radiusSq = std::max(radiusSq, glm::dot(d, d));
+		}
+		meshlet.Radius = std::sqrt(radiusSq);
+
+		// 2. 법선 원뿔: 축 = 단위 법선 평균, 퍼짐 = 축과 가장 많이 벌어진 법선
+		glm::vec3 normals[MaxTriangles];
+		uint32_t normalCount = 0;
+		glm::vec3 axis(0.0f);
+		for (uint32_t i = begin; i + 2 < end; i += 3)
+		{
+			const glm::vec3& a = vertices[indices[i]];
+			glm::vec3 n = glm::cross(vertices[indices[i + 1]] - a, vertices[indices[i + 2]] - a);
+			float length = glm::length(n);
+			if (length < 1e-20f || normalCount == MaxTriangles)
+				continue;
+			normals[normalCount++] = n / length;
+			axis += n / length;
+		}
+
+		meshlet.ConeCutoff = 1.0f;
+		float axisLength = glm::length(axis);
+		if (normalCount == 0 || axisLength < 1e-6f)
+			return;
+
+		meshlet.ConeAxis = axis / axisLength;
+		float minDot = 1.0f;
+		for (uint32_t i = 0; i < normalCount; i++)
+			minDot = std::min(minDot, glm::dot(normals[i], meshlet.ConeAxis));
+
+		// 90도 이상 퍼지면 어느 방향에서든 앞면이 하나는 보임 -> 원뿔 없음
+		if (minDot > 0.0f)
+			meshlet.ConeCutoff = std::sqrt(1.0f - minDot * minDot); // sin(퍼짐 각도)
+	}
+
+	void MeshletBuilder::Cull(const MeshletMesh& mesh, const Frustum& frustum, const glm::vec3& cameraPosition,
+		bool cullBackfaces, std::vector<DrawElementsIndirectCommand>& outCommands)
+	{
+		std::vector<uint8_t> visible(mesh.Meshlets.size(), 0);
+
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)mesh.Meshlets.size(), MeshletJobGroupSize * 4, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				const Meshlet& meshlet = mesh.Meshlets[i];
+				if (!frustum.IntersectsSphere(meshlet.Center, meshlet.Radius))
+					continue;
+
+				// 구 안의 어느 점에서 봐도 원뿔 안의 모든 법선이 카메라 반대쪽이면 전부 뒷면
+				if (cullBackfaces && meshlet.ConeCutoff < 1.0f)
+				{
+					glm::vec3 toCenter = meshlet.Center - cameraPosition;
+					float distance = glm::length(toCenter);
+					if (glm::dot(toCenter, meshlet.ConeAxis) > meshlet.ConeCutoff * distance + meshlet.Radius * (1.0f + meshlet.ConeCutoff))
+						continue;
+				}
+				visible[i] = 1;
+			}
+		});
+		JobSystem::Wait(context);
+
+		outCommands.clear();
+		for (size_t i = 0; i < mesh.Meshlets.size(); i++)
+		{
+			if (!visible[i])
+				continue;
+
+			// 연속된 메쉬렛은 명령 하나로 합침
+			const Meshlet& meshlet = mesh.Meshlets[i];
+			if (!outCommands.empty() && outCommands.back().FirstIndex + outCommands.back().Count == meshlet.IndexOffset)
+			{
+				outCommands.back().Count += meshlet.IndexCount;
+				continue;
+			}
+			outCommands.push_back({ meshlet.IndexCount, 1, meshlet.IndexOffset, 0, 0 });
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Frustum.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 작은 삼각형 묶음. 삼각형은 MeshletMesh::Indices 안에 연속으로 저장됨
+	struct Meshlet
+	{
+		uint32_t IndexOffset = 0;   // Indices 안의 시작 위치
+		uint32_t IndexCount = 0;
+
+		// 바운딩 구
+		glm::vec3 Center = { 0.0f, 0.0f, 0.0f };
+		float Radius = 0.0f;
+
+		// 법선 원뿔: 모든 면 법선이 축에서 asin(ConeCutoff) 이내 (ConeCutoff >= 1 이면 원뿔 없음)
+		glm::vec3 ConeAxis = { 0.0f, 0.0f, 1.0f };
+		float ConeCutoff = 1.0f;
+	};
+
+	struct MeshletMesh
+	{
+		std::vector<Meshlet> Meshlets;
+		std::vector<uint32_t> Indices; // 메쉬렛 순서로 재배열된 삼각형 (원본 정점 번호)
+	};
+
+	// glMultiDrawElementsIndirect 명령 (GL 4.3 규격 그대로)
+	struct DrawElementsIndirectCommand
+	{
+		uint32_t Count;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		int32_t BaseVertex;
+		uint32_t BaseInstance;
+	};
+
+	class MeshletBuilder
+	{
+	public:
+		static constexpr uint32_t MaxVertices = 64;
+		static constexpr uint32_t MaxTriangles = 124;
+
+		// 인접한 삼각형을 새 정점이 적게 늘어나는 순서로 모아서 메쉬렛 구성
+		static MeshletMesh Build(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+
+		// 정점만 움직였을 때 구/원뿔만 다시 계산 (병렬)
+		static void UpdateBounds(const std::vector<glm::vec3>& vertices, MeshletMesh& mesh);
+
+		// 보이는 메쉬렛의 그리기 명령 생성 (병렬 컬링)
+		// cullBackfaces: 뒷면 제거를 켠 경우만 원뿔 컬링 (양면 렌더링이면 뒷면도 보이므로)
+		static void Cull(const MeshletMesh& mesh, const Frustum& frustum, const glm::vec3& cameraPosition,
+			bool cullBackfaces, std::vector<DrawElementsIndirectCommand>& outCommands);
+
+	private:
+		static void ComputeBounds(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, Meshlet& meshlet);
+	};
+}
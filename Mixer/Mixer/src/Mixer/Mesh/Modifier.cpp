@@ -0,0 +1,572 @@
+#include "mxpch.h"
+#include "Modifier.h"
+#include "Mixer/JobSystem.h"
+
+#include <cfloat>
+#include <cmath>
+#include <queue>
+#include <tuple>
+
+namespace Mixer {
+
+	static constexpr uint32_t ModifierJobGroupSize = 4096;
+
+	static uint64_t EdgeKey(uint32_t a, uint32_t b)
+	{
+		return a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+	}
+
+	// 무방향 모서리 -> 붙은 면 (최대 2개까지 기록, Count는 실제 개수)
+	struct ModifierEdge
+	{
+		uint32_t Faces[2] = { ~0u, ~0u };
+		uint32_t Count = 0;
+	};
+
+	static void BuildEdgeFaces(const std::vector<uint32_t>& indices, std::unordered_map<uint64_t, ModifierEdge>& edges)
+	{
+		edges.clear();
+		edges.reserve(indices.size());
+		for (uint32_t face = 0; face < (uint32_t)indices.size() / 3; face++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				ModifierEdge& edge = edges[EdgeKey(indices[face * 3 + j], indices[face * 3 + (j + 1) % 3])];
+				if (edge.Count < 2)
+					edge.Faces[edge.Count] = face;
+				edge.Count++;
+			}
+		}
+	}
+
+	// 면 안에 a -> b 방향 모서리가 있는지
+	static bool HasDirectedEdge(const uint32_t* tri, uint32_t a, uint32_t b)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			if (tri[j] == a && tri[(j + 1) % 3] == b)
+				return true;
+		}
+		return false;
+	}
+
+	void Modifier::OrientFaces(const std::vector<glm::vec3>& vertices, std::vector<uint32_t>& indices)
+	{
+		uint32_t faceCount = (uint32_t)indices.size() / 3;
+		std::unordered_map<uint64_t, ModifierEdge> edges;
+		BuildEdgeFaces(indices, edges);
+
+		// 1. 연결 요소별 BFS: 이웃이 같은 방향 모서리를 가지면 이웃을 뒤집음
+		std::vector<uint8_t> visited(faceCount, 0);
+		std::vector<uint32_t> component;
+		std::queue<uint32_t> queue;
+		for (uint32_t seed = 0; seed < faceCount; seed++)
+		{
+			if (visited[seed])
+				continue;
+
+			component.clear();
+			visited[seed] = 1;
+			queue.push(seed);
+			while (!queue.empty())
+			{
+				uint32_t face = queue.front();
+				queue.pop();
+				component.push_back(face);
+
+				uint32_t* tri = &indices[face * 3];
+				for (int j = 0; j < 3; j++)
+				{
+					uint32_t a = tri[j], b = tri[(j + 1) % 3];
+					const ModifierEdge& edge = edges[EdgeKey(a, b)];
+					if (edge.Count != 2)
+						continue; // 경계 또는 비매니폴드 모서리는 건너뜀
+
+					uint32_t neighbor = edge.Faces[0] == face ? edge.Faces[1] : edge.Faces[0];
+					if (visited[neighbor])
+						continue;
+
+					visited[neighbor] = 1;
+					uint32_t* other = &indices[neighbor * 3];
+					if (HasDirectedEdge(other, a, b))
+						std::swap(other[1], other[2]);
+					queue.push(neighbor);
+				}
+			}
+
+			// 2. 부호 있는 부피가 음수면 요소 전체를 뒤집음 (법선이 바깥을 향하게)
+			float volume = 0.0f;
+			for (uint32_t face : component)
+			{
+				const uint32_t* tri = &indices[face * 3];
+				volume += glm::dot(vertices[tri[0]], glm::cross(vertices[tri[1]], vertices[tri[2]]));
+			}
+			if (volume < 0.0f)
+			{
+				for (uint32_t face : component)
+					std::swap(indices[face * 3 + 1], indices[face * 3 + 2]);
+			}
+		}
+	}
+
+	// ---------------------------------------------------------------------
+	// Mirror
+	// ---------------------------------------------------------------------
+
+	void MirrorModifier::BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output)
+	{
+		uint32_t vertexCount = (uint32_t)vertices.size();
+
+		// 평면 위 정점은 원본을 그대로 쓰고, 나머지만 원본 뒤에 복사
+		std::vector<uint32_t> mirrored(vertexCount);
+		m_CopySources.clear();
+		for (uint32_t i = 0; i < vertexCount; i++)
+		{
+			if (std::fabs(vertices[i][m_Axis]) <= m_MergeDistance)
+			{
+				mirrored[i] = i;
+			}
+			else
+			{
+				mirrored[i] = vertexCount + (uint32_t)m_CopySources.size();
+				m_CopySources.push_back(i);
+			}
+		}
+
+		output.Indices = indices;
+		output.Indices.reserve(indices.size() * 2);
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+			if (mirrored[a] == a && mirrored[b] == b && mirrored[c] == c)
+				continue; // 평면에 누운 면은 겹치므로 한 번만
+
+			// 반사하면 감기 방향이 뒤집히므로 b, c 교환
+			output.Indices.push_back(mirrored[a]);
+			output.Indices.push_back(mirrored[c]);
+			output.Indices.push_back(mirrored[b]);
+		}
+
+		output.Vertices.resize(vertexCount + m_CopySources.size());
+	}
+
+	void MirrorModifier::EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output)
+	{
+		std::copy(vertices.begin(), vertices.end(), output.Vertices.begin());
+
+		size_t vertexCount = vertices.size();
+		for (size_t i = 0; i < m_CopySources.size(); i++)
+		{
+			glm::vec3 p = vertices[m_CopySources[i]];
+			p[m_Axis] = -p[m_Axis];
+			output.Vertices[vertexCount + i] = p;
+		}
+	}
+
+	// ---------------------------------------------------------------------
+	// Array
+	// ---------------------------------------------------------------------
+
+	void ArrayModifier::BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output)
+	{
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		output.Indices.resize(indices.size() * m_Count);
+		for (uint32_t k = 0; k < m_Count; k++)
+		{
+			uint32_t* dst = &output.Indices[indices.size() * k];
+			for (size_t i = 0; i < indices.size(); i++)
+				dst[i] = indices[i] + vertexCount * k;
+		}
+
+		output.Vertices.resize((size_t)vertexCount * m_Count);
+	}
+
+	void ArrayModifier::EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output)
+	{
+		if (vertices.empty())
+			return;
+
+		glm::vec3 boundsMin(FLT_MAX), boundsMax(-FLT_MAX);
+		for (const auto& p : vertices)
+		{
+			boundsMin = glm::min(boundsMin, p);
+			boundsMax = glm::max(boundsMax, p);
+		}
+		glm::vec3 step = (boundsMax - boundsMin) * m_RelativeOffset;
+
+		// 복사본 단위로 분배 (복사본이 작으면 여러 개를 한 그룹으로)
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		uint32_t groupSize = std::max(1u, ModifierJobGroupSize / vertexCount);
+		const glm::vec3* src = vertices.data();
+		glm::vec3* dst = output.Vertices.data();
+
+		JobContext context;
+		JobSystem::Dispatch(context, m_Count, groupSize, [=](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t k = begin; k < end; k++)
+			{
+				glm::vec3 offset = step * (float)k;
+				glm::vec3* out = dst + (size_t)vertexCount * k;
+				for (uint32_t i = 0; i < vertexCount; i++)
+					out[i] = src[i] + offset;
+			}
+		});
+		JobSystem::Wait(context);
+	}
+
+	// ---------------------------------------------------------------------
+	// Subdivide
+	// ---------------------------------------------------------------------
+
+	void SubdivideModifier::BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output)
+	{
+		m_Surface.SetCage(indices, vertices.size());
+		m_Surface.SetScheme(m_Scheme);
+		m_Surface.SetLevel(std::min(m_Level, SubdivisionSurface::MaxLevel));
+
+		output.Indices = m_Surface.GetTriangles();
+	}
+
+	void SubdivideModifier::EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output)
+	{
+		m_Surface.Evaluate(vertices);
+		output.Vertices = m_Surface.GetPositions();
+	}
+
+	// ---------------------------------------------------------------------
+	// Solidify
+	// ---------------------------------------------------------------------
+
+	void SolidifyModifier::BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output)
+	{
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		m_Faces = indices;
+		OrientFaces(vertices, m_Faces);
+
+		// 바깥 면 + 뒤집은 안쪽 면 (정점 + n)
+		output.Indices = m_Faces;
+		output.Indices.reserve(m_Faces.size() * 2);
+		for (size_t i = 0; i + 2 < m_Faces.size(); i += 3)
+		{
+			output.Indices.push_back(m_Faces[i] + vertexCount);
+			output.Indices.push_back(m_Faces[i + 2] + vertexCount);
+			output.Indices.push_back(m_Faces[i + 1] + vertexCount);
+		}
+
+		// 면이 하나뿐인 모서리(a -> b)에 바깥/안쪽을 잇는 사각형
+		std::unordered_map<uint64_t, ModifierEdge> edges;
+		BuildEdgeFaces(m_Faces, edges);
+		for (size_t i = 0; i + 2 < m_Faces.size(); i += 3)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				uint32_t a = m_Faces[i + j], b = m_Faces[i + (j + 1) % 3];
+				if (edges[EdgeKey(a, b)].Count != 1)
+					continue;
+
+				uint32_t innerA = a + vertexCount, innerB = b + vertexCount;
+				output.Indices.insert(output.Indices.end(), { b, a, innerA });
+				output.Indices.insert(output.Indices.end(), { b, innerA, innerB });
+			}
+		}
+
+		output.Vertices.resize((size_t)vertexCount * 2);
+	}
+
+	void SolidifyModifier::EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output)
+	{
+		// 면적 가중 정점 법선
+		size_t vertexCount = vertices.size();
+		std::vector<glm::vec3> normals(vertexCount, glm::vec3(0.0f));
+		for (size_t i = 0; i + 2 < m_Faces.size(); i += 3)
+		{
+			uint32_t a = m_Faces[i], b = m_Faces[i + 1], c = m_Faces[i + 2];
+			glm::vec3 n = glm::cross(vertices[b] - vertices[a], vertices[c] - vertices[a]);
+			normals[a] += n;
+			normals[b] += n;
+			normals[c] += n;
+		}
+
+		const glm::vec3* src = vertices.data();
+		const glm::vec3* normal = normals.data();
+		glm::vec3* dst = output.Vertices.data();
+		float thickness = m_Thickness;
+
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)vertexCount, ModifierJobGroupSize, [=](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				float length = glm::length(normal[i]);
+				glm::vec3 n = length > 0.0f ? normal[i] / length : glm::vec3(0.0f);
+				dst[i] = src[i];
+				dst[i + vertexCount] = src[i] - n * thickness;
+			}
+		});
+		JobSystem::Wait(context);
+	}
+
+	// ---------------------------------------------------------------------
+	// Bevel
+	// ---------------------------------------------------------------------
+
+	static uint32_t FindGroup(std::vector<uint32_t>& parent, uint32_t i)
+	{
+		while (parent[i] != i)
+		{
+			parent[i] = parent[parent[i]];
+			i = parent[i];
+		}
+		return i;
+	}
+
+	void BevelModifier::BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output)
+	{
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		m_Sources.clear();
+		m_NeighborOffsets.clear();
+		m_Neighbors.clear();
+
+		std::vector<uint32_t> faces = indices;
+		OrientFaces(vertices, faces);
+		uint32_t faceCount = (uint32_t)faces.size() / 3;
+
+		std::unordered_map<uint64_t, ModifierEdge> edges;
+		BuildEdgeFaces(faces, edges);
+
+		bool closed = true;
+		for (const auto& [key, edge] : edges)
+			closed &= edge.Count == 2;
+		if (!closed)
+		{
+			// 경계/비매니폴드가 있으면 그대로 통과 (모든 정점이 이웃 없이 자기 자신)
+			MX_CORE_WARN("Bevel: mesh is not a closed manifold, passing through");
+			m_Sources.resize(vertexCount);
+			for (uint32_t i = 0; i < vertexCount; i++)
+				m_Sources[i] = i;
+			m_NeighborOffsets.assign(vertexCount + 1, 0);
+			m_Neighbors.clear();
+			m_Opposites.clear();
+			output.Indices = indices;
+			output.Vertices.resize(vertexCount);
+			return;
+		}
+
+		// 1. 날카롭지 않은 모서리로 이어진 면끼리 한 묶음 (union-find)
+		std::vector<glm::vec3> faceNormals(faceCount);
+		for (uint32_t f = 0; f < faceCount; f++)
+		{
+			const uint32_t* tri = &faces[f * 3];
+			glm::vec3 n = glm::cross(vertices[tri[1]] - vertices[tri[0]], vertices[tri[2]] - vertices[tri[0]]);
+			float length = glm::length(n);
+			faceNormals[f] = length > 0.0f ? n / length : glm::vec3(0.0f);
+		}
+
+		float cosLimit = std::cos(glm::radians(m_AngleDegrees));
+		std::vector<uint32_t> parent(faceCount);
+		for (uint32_t f = 0; f < faceCount; f++)
+			parent[f] = f;
+
+		std::vector<uint64_t> sharpEdges;
+		for (const auto& [key, edge] : edges)
+		{
+			if (glm::dot(faceNormals[edge.Faces[0]], faceNormals[edge.Faces[1]]) < cosLimit)
+			{
+				sharpEdges.push_back(key);
+				continue;
+			}
+			uint32_t a = FindGroup(parent, edge.Faces[0]), b = FindGroup(parent, edge.Faces[1]);
+			if (a != b)
+				parent[a] = b;
+		}
+		std::sort(sharpEdges.begin(), sharpEdges.end()); // unordered_map 순회 순서와 무관하게 같은 결과
+
+		std::vector<uint32_t> group(faceCount);
+		for (uint32_t f = 0; f < faceCount; f++)
+			group[f] = FindGroup(parent, f);
+
+		// 2. (정점, 묶음)마다 출력 정점 하나
+		std::unordered_map<uint64_t, uint32_t> copies;
+		auto copyOf = [&](uint32_t v, uint32_t g)
+		{
+			auto [it, inserted] = copies.try_emplace(((uint64_t)v << 32) | g, (uint32_t)m_Sources.size());
+			if (inserted)
+				m_Sources.push_back(v);
+			return it->second;
+		};
+
+		output.Indices.resize(faces.size());
+		for (uint32_t f = 0; f < faceCount; f++)
+		{
+			for (int j = 0; j < 3; j++)
+				output.Indices[f * 3 + j] = copyOf(faces[f * 3 + j], group[f]);
+		}
+
+		// 3. 날카로운 모서리: 양쪽 복사본에 (모서리 반대쪽 끝, 자기 쪽 면의 나머지 꼭짓점) 등록 + 띠 면 두 개
+		struct BevelEdge
+		{
+			uint32_t Copy, Neighbor, Opposite;
+			bool operator<(const BevelEdge& other) const { return std::tie(Copy, Neighbor, Opposite) < std::tie(other.Copy, other.Neighbor, other.Opposite); }
+			bool operator==(const BevelEdge& other) const { return Copy == other.Copy && Neighbor == other.Neighbor && Opposite == other.Opposite; }
+		};
+		auto thirdVertex = [&](uint32_t f, uint32_t a, uint32_t b)
+		{
+			const uint32_t* tri = &faces[f * 3];
+			return tri[0] != a && tri[0] != b ? tri[0] : (tri[1] != a && tri[1] != b ? tri[1] : tri[2]);
+		};
+		std::vector<BevelEdge> bevelEdges;
+		for (uint64_t key : sharpEdges)
+		{
+			const ModifierEdge& edge = edges[key];
+			uint32_t f0 = edge.Faces[0], f1 = edge.Faces[1];
+			uint32_t g0 = group[f0], g1 = group[f1];
+			if (g0 == g1)
+				continue; // 묶음 안쪽 주름은 벌리지 않음
+
+			// f0에 a -> b 방향이 오도록
+			uint32_t a = (uint32_t)(key >> 32), b = (uint32_t)key;
+			if (!HasDirectedEdge(&faces[f0 * 3], a, b))
+				std::swap(a, b);
+
+			uint32_t a0 = copyOf(a, g0), b0 = copyOf(b, g0);
+			uint32_t a1 = copyOf(a, g1), b1 = copyOf(b, g1);
+			uint32_t c0 = thirdVertex(f0, a, b), c1 = thirdVertex(f1, a, b);
+			bevelEdges.push_back({ a0, b, c0 });
+			bevelEdges.push_back({ b0, a, c0 });
+			bevelEdges.push_back({ a1, b, c1 });
+			bevelEdges.push_back({ b1, a, c1 });
+
+			// f0 쪽은 b0 -> a0, f1 쪽은 a1 -> b1로 이어짐
+			if (b0 != a0 && a0 != a1 && a1 != b0)
+				output.Indices.insert(output.Indices.end(), { b0, a0, a1 });
+			if (b0 != a1 && a1 != b1 && b1 != b0)
+				output.Indices.insert(output.Indices.end(), { b0, a1, b1 });
+		}
+
+		// 4. 묶음이 셋 이상 만나는 꼭짓점: 면을 돌면서 복사본을 순서대로 모아 구멍을 메움
+		//    (p -> v -> n 면에서 모서리 (p, v) 건너편으로 가면 바깥에서 봤을 때 반시계 방향)
+		std::vector<uint32_t> firstFace(vertexCount, ~0u);
+		for (uint32_t f = 0; f < faceCount; f++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				if (firstFace[faces[f * 3 + j]] == ~0u)
+					firstFace[faces[f * 3 + j]] = f;
+			}
+		}
+
+		std::vector<uint32_t> ring;
+		for (uint32_t v = 0; v < vertexCount; v++)
+		{
+			if (firstFace[v] == ~0u)
+				continue;
+
+			ring.clear();
+			uint32_t face = firstFace[v];
+			for (uint32_t step = 0; step < faceCount; step++)
+			{
+				if (ring.empty() || ring.back() != group[face])
+					ring.push_back(group[face]);
+
+				const uint32_t* tri = &faces[face * 3];
+				int corner = tri[0] == v ? 0 : (tri[1] == v ? 1 : 2);
+				uint32_t previous = tri[(corner + 2) % 3];
+				const ModifierEdge& edge = edges[EdgeKey(previous, v)];
+				face = edge.Faces[0] == face ? edge.Faces[1] : edge.Faces[0];
+				if (face == firstFace[v])
+					break;
+			}
+			while (ring.size() > 1 && ring.back() == ring.front())
+				ring.pop_back();
+
+			if (ring.size() < 3)
+				continue;
+
+			uint32_t first = copyOf(v, ring[0]);
+			for (size_t i = 1; i + 1 < ring.size(); i++)
+				output.Indices.insert(output.Indices.end(), { first, copyOf(v, ring[i]), copyOf(v, ring[i + 1]) });
+		}
+
+		// 5. 모서리 목록 CSR
+		std::sort(bevelEdges.begin(), bevelEdges.end());
+		bevelEdges.erase(std::unique(bevelEdges.begin(), bevelEdges.end()), bevelEdges.end());
+
+		uint32_t copyCount = (uint32_t)m_Sources.size();
+		m_NeighborOffsets.assign(copyCount + 1, 0);
+		for (const BevelEdge& edge : bevelEdges)
+			m_NeighborOffsets[edge.Copy + 1]++;
+		for (uint32_t i = 0; i < copyCount; i++)
+			m_NeighborOffsets[i + 1] += m_NeighborOffsets[i];
+
+		m_Neighbors.resize(bevelEdges.size());
+		m_Opposites.resize(bevelEdges.size());
+		for (size_t i = 0; i < bevelEdges.size(); i++)
+		{
+			m_Neighbors[i] = bevelEdges[i].Neighbor; // 정렬되어 있으므로 순서대로
+			m_Opposites[i] = bevelEdges[i].Opposite;
+		}
+
+		output.Vertices.resize(copyCount);
+	}
+
+	void BevelModifier::EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output)
+	{
+		const glm::vec3* src = vertices.data();
+		const uint32_t* sources = m_Sources.data();
+		const uint32_t* offsets = m_NeighborOffsets.data();
+		const uint32_t* neighbors = m_Neighbors.data();
+		const uint32_t* opposites = m_Opposites.data();
+		glm::vec3* dst = output.Vertices.data();
+		float width = m_Width;
+
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)m_Sources.size(), ModifierJobGroupSize, [=](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				glm::vec3 p = src[sources[i]];
+
+				// 모서리 k마다 면 안쪽으로 향하는 수직 방향 d_k (면 평면 위, 모서리와 직각)
+				// 모든 k에 대해 dot(offset, d_k) = width 가 되는 offset을 최소제곱으로:
+				// (sum d_k d_k^T + eps I) offset = width * sum d_k
+				// 모서리 둘이면 width * (d0 + d1) / (1 + dot(d0, d1)) -> 길이 width / sin(사이각 / 2)
+				// 일직선이면 (원기둥 테두리 중간) width * d. eps는 방향이 하나뿐일 때 나머지 축을 0으로 고정
+				glm::vec3 row0(1e-4f, 0.0f, 0.0f), row1(0.0f, 1e-4f, 0.0f), row2(0.0f, 0.0f, 1e-4f), rhs(0.0f);
+				uint32_t count = 0;
+				for (uint32_t k = offsets[i]; k < offsets[i + 1]; k++)
+				{
+					glm::vec3 tangent = src[neighbors[k]] - p;
+					float length = glm::length(tangent);
+					if (length <= 1e-12f)
+						continue;
+					tangent /= length;
+
+					glm::vec3 toOpposite = src[opposites[k]] - p;
+					glm::vec3 d = toOpposite - tangent * glm::dot(toOpposite, tangent);
+					length = glm::length(d);
+					if (length <= 1e-12f)
+						continue;
+					d /= length;
+
+					row0 += d * d.x;
+					row1 += d * d.y;
+					row2 += d * d.z;
+					rhs += d;
+					count++;
+				}
+
+				glm::vec3 offset(0.0f);
+				if (count > 0)
+				{
+					// 대칭 3x3: 역행렬 = 여인수 / 행렬식
+					glm::vec3 c0 = glm::cross(row1, row2), c1 = glm::cross(row2, row0), c2 = glm::cross(row0, row1);
+					float det = glm::dot(row0, c0);
+					if (std::abs(det) > 1e-20f)
+						offset = (c0 * rhs.x + c1 * rhs.y + c2 * rhs.z) * (width / det);
+				}
+				dst[i] = p + offset;
+			}
+		});
+		JobSystem::Wait(context);
+	}
+}
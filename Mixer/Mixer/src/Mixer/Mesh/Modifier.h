@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Subdivision.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	enum class ModifierType
+	{
+		Mirror,
+		Array,
+		Subdivide,
+		Solidify,
+		Bevel
+	};
+
+	struct ModifierMesh
+	{
+		std::vector<glm::vec3> Vertices;
+		std::vector<uint32_t> Indices;
+	};
+
+	// 비파괴 모디파이어 한 단계
+	// BuildTopology: 입력 토폴로지가 바뀌었을 때만 (출력 인덱스 + 위치 계산용 표)
+	// EvaluatePositions: 정점만 움직였을 때 (표로 위치만 다시 계산, output.Indices는 그대로)
+	class Modifier
+	{
+	public:
+		virtual ~Modifier() = default;
+
+		virtual ModifierType GetType() const = 0;
+		virtual const char* GetName() const = 0;
+
+		virtual void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) = 0;
+		virtual void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) = 0;
+
+		// 파라미터가 바뀌면 다음 평가에서 이 단계부터 다시 (topology = false면 위치만)
+		void MarkDirty(bool topology) { m_TopologyDirty |= topology; m_PositionDirty = true; }
+
+	protected:
+		// 면 감기 순서를 이웃끼리 맞추고 바깥을 향하게 뒤집음 (에디터 메쉬는 순서가 섞여 있을 수 있음)
+		static void OrientFaces(const std::vector<glm::vec3>& vertices, std::vector<uint32_t>& indices);
+
+	private:
+		friend class ModifierStack;
+		bool m_TopologyDirty = true;
+		bool m_PositionDirty = true;
+	};
+
+	// 축 평면(원점 기준)으로 대칭 복사. 평면 위 정점은 복사하지 않고 공유
+	class MirrorModifier : public Modifier
+	{
+	public:
+		ModifierType GetType() const override { return ModifierType::Mirror; }
+		const char* GetName() const override { return "Mirror"; }
+
+		void SetAxis(int axis) { m_Axis = axis; MarkDirty(false); }
+
+		void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) override;
+		void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) override;
+
+	private:
+		int m_Axis = 0;
+		float m_MergeDistance = 0.001f;      // 토폴로지 생성 시점 위치로 판단
+		std::vector<uint32_t> m_CopySources; // 복사된 정점 (출력 = 원본 뒤에 이 순서로)
+	};
+
+	// 바운딩 박스 크기 x RelativeOffset 간격으로 Count개 복사
+	class ArrayModifier : public Modifier
+	{
+	public:
+		ModifierType GetType() const override { return ModifierType::Array; }
+		const char* GetName() const override { return "Array"; }
+
+		void SetCount(uint32_t count) { m_Count = count > 0 ? count : 1; MarkDirty(true); }
+		void SetRelativeOffset(const glm::vec3& offset) { m_RelativeOffset = offset; MarkDirty(false); }
+
+		void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) override;
+		void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) override;
+
+	private:
+		uint32_t m_Count = 10;
+		glm::vec3 m_RelativeOffset = { 1.2f, 0.0f, 0.0f };
+	};
+
+	// 세분화 곡면 (SubdivisionSurface의 Stencil 표 재사용)
+	class SubdivideModifier : public Modifier
+	{
+	public:
+		ModifierType GetType() const override { return ModifierType::Subdivide; }
+		const char* GetName() const override { return "Subdivide"; }
+
+		void SetLevel(uint32_t level) { m_Level = level; MarkDirty(true); }
+		void SetScheme(SubdivisionScheme scheme) { m_Scheme = scheme; MarkDirty(true); }
+
+		void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) override;
+		void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) override;
+
+	private:
+		uint32_t m_Level = 2;
+		SubdivisionScheme m_Scheme = SubdivisionScheme::CatmullClark;
+		SubdivisionSurface m_Surface;
+	};
+
+	// 정점 법선 반대 방향으로 두께만큼 안쪽 껍질 + 열린 경계에 테두리 면
+	class SolidifyModifier : public Modifier
+	{
+	public:
+		ModifierType GetType() const override { return ModifierType::Solidify; }
+		const char* GetName() const override { return "Solidify"; }
+
+		void SetThickness(float thickness) { m_Thickness = thickness; MarkDirty(false); }
+
+		void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) override;
+		void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) override;
+
+	private:
+		float m_Thickness = 0.1f;
+		std::vector<uint32_t> m_Faces; // 방향을 맞춘 입력 면 (법선 계산용)
+	};
+
+	// 날카로운 모서리(면 각도 > Angle)를 한 단계 모따기 (닫힌 매니폴드만, 아니면 그대로 통과)
+	// 평평한 면 묶음마다 모서리 정점을 복사해서 날카로운 모서리 방향으로 Width만큼 안쪽으로 옮기고,
+	// 모서리에는 띠, 꼭짓점에는 구멍 메우는 면을 만듦
+	class BevelModifier : public Modifier
+	{
+	public:
+		ModifierType GetType() const override { return ModifierType::Bevel; }
+		const char* GetName() const override { return "Bevel"; }
+
+		void SetWidth(float width) { m_Width = width; MarkDirty(false); }
+		void SetAngle(float degrees) { m_AngleDegrees = degrees; MarkDirty(true); }
+
+		void BuildTopology(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices, ModifierMesh& output) override;
+		void EvaluatePositions(const std::vector<glm::vec3>& vertices, ModifierMesh& output) override;
+
+	private:
+		float m_Width = 0.1f;
+		float m_AngleDegrees = 30.0f;  // 토폴로지 생성 시점 위치로 판단
+
+		// 출력 정점 i = 입력[m_Sources[i]]를 자기 묶음 면 위에서, 닿은 날카로운 모서리마다 Width만큼 떨어지게 민 위치
+		// 모서리 k = (원본, m_Neighbors[k]), 그 모서리에 붙은 자기 묶음 면의 나머지 꼭짓점 = m_Opposites[k]
+		std::vector<uint32_t> m_Sources;
+		std::vector<uint32_t> m_NeighborOffsets; // CSR (출력 정점 수 + 1)
+		std::vector<uint32_t> m_Neighbors;
+		std::vector<uint32_t> m_Opposites;
+	};
+}
@@ -0,0 +1,91 @@
+#include "mxpch.h"
+#include "ModifierStack.h"
+
+namespace Mixer {
+
+	Modifier* ModifierStack::Add(std::unique_ptr<Modifier> modifier)
+	{
+		Stage stage;
+		stage.Instance = std::move(modifier);
+		m_Stages.push_back(std::move(stage));
+		return m_Stages.back().Instance.get();
+	}
+
+	void ModifierStack::Remove(ModifierType type)
+	{
+		for (size_t i = 0; i < m_Stages.size(); i++)
+		{
+			if (m_Stages[i].Instance->GetType() != type)
+				continue;
+
+			m_Stages.erase(m_Stages.begin() + i);
+			Invalidate(i); // 뒤 단계는 입력이 바뀜
+			return;
+		}
+	}
+
+	void ModifierStack::Clear()
+	{
+		m_Stages.clear();
+	}
+
+	Modifier* ModifierStack::Find(ModifierType type) const
+	{
+		for (const Stage& stage : m_Stages)
+		{
+			if (stage.Instance->GetType() == type)
+				return stage.Instance.get();
+		}
+		return nullptr;
+	}
+
+	void ModifierStack::Invalidate(size_t first)
+	{
+		for (size_t i = first; i < m_Stages.size(); i++)
+		{
+			m_Stages[i].InputTopologyVersion = ~0u;
+			m_Stages[i].InputPositionVersion = ~0u;
+		}
+	}
+
+	bool ModifierStack::Evaluate(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices,
+		uint32_t topologyVersion, uint32_t positionVersion)
+	{
+		const std::vector<glm::vec3>* inputVertices = &vertices;
+		const std::vector<uint32_t>* inputIndices = &indices;
+		bool changed = false;
+
+		for (Stage& stage : m_Stages)
+		{
+			Modifier& modifier = *stage.Instance;
+
+			// 1. 토폴로지: 입력 토폴로지가 바뀌었거나 토폴로지 파라미터가 바뀐 경우만
+			bool rebuild = stage.InputTopologyVersion != topologyVersion || modifier.m_TopologyDirty;
+			if (rebuild)
+			{
+				modifier.BuildTopology(*inputVertices, *inputIndices, stage.Output);
+				stage.InputTopologyVersion = topologyVersion;
+				stage.OutputTopologyVersion = m_NextVersion++;
+				modifier.m_TopologyDirty = false;
+			}
+
+			// 2. 위치: 표만 다시 적용
+			if (rebuild || stage.InputPositionVersion != positionVersion || modifier.m_PositionDirty)
+			{
+				modifier.EvaluatePositions(*inputVertices, stage.Output);
+				stage.InputPositionVersion = positionVersion;
+				stage.OutputPositionVersion = m_NextVersion++;
+				modifier.m_PositionDirty = false;
+				changed = true;
+			}
+
+			// 다음 단계의 입력 = 이 단계의 출력
+			inputVertices = &stage.Output.Vertices;
+			inputIndices = &stage.Output.Indices;
+			topologyVersion = stage.OutputTopologyVersion;
+			positionVersion = stage.OutputPositionVersion;
+		}
+
+		return changed;
+	}
+}
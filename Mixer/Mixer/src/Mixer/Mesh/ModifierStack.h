@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Modifier.h"
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 모디파이어를 순서대로 적용. 단계마다 출력을 캐시해 두고,
+	// 입력 토폴로지가 그대로면 BuildTopology를 건너뛰고 위치만 다시 계산
+	class ModifierStack
+	{
+	public:
+		Modifier* Add(std::unique_ptr<Modifier> modifier);
+		void Remove(ModifierType type);
+		void Clear();
+
+		Modifier* Find(ModifierType type) const;
+		bool IsEmpty() const { return m_Stages.empty(); }
+		size_t GetCount() const { return m_Stages.size(); }
+		const Modifier& GetModifier(size_t index) const { return *m_Stages[index].Instance; }
+
+		// 버전은 호출하는 쪽의 편집 메쉬 버전 (바뀌었을 때만 그 단계부터 다시)
+		// 결과가 바뀌었으면 true
+		bool Evaluate(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices,
+			uint32_t topologyVersion, uint32_t positionVersion);
+
+		const ModifierMesh& GetResult() const { return m_Stages.back().Output; }
+		// 결과 버전 (업로드 판단용, 스택 구성이 바뀌어도 이전 값과 겹치지 않음)
+		uint32_t GetResultTopologyVersion() const { return m_Stages.empty() ? ~0u : m_Stages.back().OutputTopologyVersion; }
+		uint32_t GetResultPositionVersion() const { return m_Stages.empty() ? ~0u : m_Stages.back().OutputPositionVersion; }
+
+	private:
+		struct Stage
+		{
+			std::unique_ptr<Modifier> Instance;
+			ModifierMesh Output;
+
+			// 마지막으로 처리한 입력 버전 / 내보낸 출력 버전
+			uint32_t InputTopologyVersion = ~0u;
+			uint32_t InputPositionVersion = ~0u;
+			uint32_t OutputTopologyVersion = ~0u;
+			uint32_t OutputPositionVersion = ~0u;
+		};
+
+		void Invalidate(size_t first);
+
+	private:
+		std::vector<Stage> m_Stages;
+		uint32_t m_NextVersion = 0;
+	};
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Mixer {
+
+	// 정점 8개씩 축별로 모은 블록 (AoSoA). AVX 레지스터 하나 = 한 축 8개
+	// 함수 없는 구조체만 (변형 커널 파일이 glm/PositionStore 없이 포함)
+	struct alignas(32) PositionBlock
+	{
+		float X[8];
+		float Y[8];
+		float Z[8];
+	};
+}
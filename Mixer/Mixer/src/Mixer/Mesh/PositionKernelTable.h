@@ -0,0 +1,38 @@
+#pragma once
+
+#include "PositionBlock.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 명령어 집합별 커널 묶음. 변형마다 다른 컴파일 옵션으로 빌드한 파일에 있음 (빌드 설정 참고)
+	// 인자는 float 배열만: 변형 파일이 glm이나 PositionStore의 인라인 함수를 부르면 그 사본이 AVX 명령으로
+	// 컴파일되고, 링커가 같은 이름의 사본 중 아무거나 골라서 SSE 경로에서도 AVX 코드가 돌 수 있음
+	// 벡터는 float 3개 (x, y, z), 행렬은 glm과 같은 열 우선 16개, blocks는 PositionStore::GetBlocks()
+	struct PositionKernelTable
+	{
+		const char* Name;
+
+		// p = m * p (아핀 변환)
+		void (*Transform)(PositionBlock* blocks, size_t blockCount, const float* matrix);
+		// 대상 i: p = starts[i] + delta * scales[i] -> blocks와 aos 양쪽에 씀 (인덱스는 서로 달라야 함)
+		// count = 정점 수 (마지막 정점이면 블록의 빈 칸도 같이 씀, PositionStore::Set과 같음)
+		void (*TranslateSubset)(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+			const float* starts, const float* scales, size_t targetCount, const float* delta);
+		// 광선(직선)까지 거리 제곱 |cross(p - origin, direction)|^2이 가장 작은 점
+		// (maxDistance 미만만, 같으면 번호가 작은 쪽). 없으면 -1
+		int (*NearestToRay)(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+			const float* direction, float maxDistance, float* outDistance2);
+		// 비어 있으면 false
+		bool (*BoundingBox)(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax);
+	};
+
+	// 변형별 표 (이 빌드/아키텍처에 포함되지 않았으면 nullptr)
+	const PositionKernelTable* GetScalarPositionKernels();
+	const PositionKernelTable* GetSSE42PositionKernels();
+	const PositionKernelTable* GetAVX2PositionKernels();
+	const PositionKernelTable* GetAVX512PositionKernels();
+	const PositionKernelTable* GetNEONPositionKernels();
+}
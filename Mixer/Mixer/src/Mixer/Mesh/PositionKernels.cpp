@@ -0,0 +1,211 @@
+#include "mxpch.h"
+#include "PositionKernels.h"
+
+#include "Mixer/CpuFeatures.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace Mixer {
+	namespace PositionKernels {
+
+		static const PositionKernelTable* s_Active = GetScalarPositionKernels();
+
+		std::vector<const PositionKernelTable*> GetSupportedTables()
+		{
+			const CpuFeatures& features = CpuInfo::GetFeatures();
+			std::vector<const PositionKernelTable*> tables;
+			tables.push_back(GetScalarPositionKernels());
+
+			// 빌드에 포함됐고(nullptr 아님) CPU/OS가 지원하는 것만
+			if (features.SSE42 && GetSSE42PositionKernels())
+				tables.push_back(GetSSE42PositionKernels());
+			if (features.AVX2 && GetAVX2PositionKernels())
+				tables.push_back(GetAVX2PositionKernels());
+			if (features.AVX512 && GetAVX512PositionKernels())
+				tables.push_back(GetAVX512PositionKernels());
+			if (features.NEON && GetNEONPositionKernels())
+				tables.push_back(GetNEONPositionKernels());
+			return tables;
+		}
+
+		void Init()
+		{
+			s_Active = GetSupportedTables().back();
+			MX_CORE_INFO("Position kernels: {0}", s_Active->Name);
+		}
+
+		const char* GetVariantName()
+		{
+			return s_Active->Name;
+		}
+
+		// glm/PositionStore -> 표의 float 배열 인자 (변형 파일은 glm을 모름, PositionKernelTable.h 참고)
+		static void Transform(const PositionKernelTable& table, PositionStore& store, const glm::mat4& matrix)
+		{
+			table.Transform(store.GetBlocks(), store.GetBlockCount(), &matrix[0][0]);
+		}
+
+		static void TranslateSubset(const PositionKernelTable& table, PositionStore& store, glm::vec3* aos, const uint32_t* indices,
+			const glm::vec3* starts, const glm::vec3* scales, size_t count, const glm::vec3& delta)
+		{
+			table.TranslateSubset(store.GetBlocks(), store.GetCount(), (float*)aos, indices,
+				(const float*)starts, (const float*)scales, count, &delta.x);
+		}
+
+		static int NearestToRay(const PositionKernelTable& table, const PositionStore& store, const glm::vec3& origin,
+			const glm::vec3& direction, float maxDistance, float& outDistance)
+		{
+			float distance2 = 0.0f;
+			int nearest = table.NearestToRay(store.GetBlocks(), store.GetBlockCount(), store.GetCount(),
+				&origin.x, &direction.x, maxDistance, &distance2);
+			if (nearest >= 0)
+				outDistance = std::sqrt(distance2);
+			return nearest;
+		}
+
+		static bool BoundingBox(const PositionKernelTable& table, const PositionStore& store, glm::vec3& outMin, glm::vec3& outMax)
+		{
+			return table.BoundingBox(store.GetBlocks(), store.GetBlockCount(), &outMin.x, &outMax.x);
+		}
+
+		void Transform(PositionStore& store, const glm::mat4& matrix)
+		{
+			Transform(*s_Active, store, matrix);
+		}
+
+		void TranslateSubset(PositionStore& store, glm::vec3* aos, const uint32_t* indices,
+			const glm::vec3* starts, const glm::vec3* scales, size_t count, const glm::vec3& delta)
+		{
+			TranslateSubset(*s_Active, store, aos, indices, starts, scales, count, delta);
+		}
+
+		int NearestToRay(const PositionStore& store, const glm::vec3& origin, const glm::vec3& direction,
+			float maxDistance, float& outDistance)
+		{
+			return NearestToRay(*s_Active, store, origin, direction, maxDistance, outDistance);
+		}
+
+		bool BoundingBox(const PositionStore& store, glm::vec3& outMin, glm::vec3& outMax)
+		{
+			return BoundingBox(*s_Active, store, outMin, outMax);
+		}
+
+		// fn을 여러 번 돌려서 가장 빠른 시간 (ms)
+		template<typename Fn>
+		static float MeasureBest(int repeat, Fn&& fn)
+		{
+			float best = FLT_MAX;
+			for (int r = 0; r < repeat; r++)
+			{
+				auto start = std::chrono::steady_clock::now();
+				fn();
+				best = std::min(best, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+			}
+			return best;
+		}
+
+		void RunBenchmark(size_t pointCount)
+		{
+			const int Repeat = 5;
+
+			// 같은 난수 데이터 (시드 고정)
+			std::mt19937 random(1234);
+			std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+			std::vector<glm::vec3> points(pointCount);
+			for (glm::vec3& p : points)
+				p = { coordinate(random), coordinate(random), coordinate(random) };
+
+			// 이동 대상: 1/4을 섞인 순서로 (실제 드래그처럼 흩어 쓰기)
+			std::vector<uint32_t> targets(pointCount / 4);
+			for (size_t i = 0; i < targets.size(); i++)
+				targets[i] = (uint32_t)(i * 4);
+			std::shuffle(targets.begin(), targets.end(), random);
+			std::vector<glm::vec3> starts(targets.size()), scales(targets.size(), glm::vec3(0.5f));
+			for (size_t i = 0; i < targets.size(); i++)
+				starts[i] = points[targets[i]];
+
+			glm::mat4 matrix = glm::rotate(glm::mat4(1.0f), 0.3f, glm::vec3(0.0f, 1.0f, 0.0f));
+			matrix[3] = glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+			glm::vec3 rayOrigin = { -20.0f, 0.1f, 0.2f };
+			glm::vec3 rayDir = glm::normalize(glm::vec3(1.0f, 0.05f, -0.02f));
+
+			MX_CORE_INFO("Position kernel benchmark: {0} points, best of {1} (ms)", pointCount, Repeat);
+			MX_CORE_INFO("  {0:<8} {1:>10} {2:>10} {3:>10} {4:>10}", "Variant", "Transform", "Translate", "Nearest", "Bounds");
+
+			// 기준 결과 (스칼라)
+			std::vector<glm::vec3> referencePositions, referenceTranslated, referenceAos;
+			glm::vec3 referenceMin(0.0f), referenceMax(0.0f);
+			float referenceDistance = 0.0f;
+			int referenceNearest = -1;
+
+			PositionStore store;
+			std::vector<glm::vec3> aos;
+			for (const PositionKernelTable* table : GetSupportedTables())
+			{
+				// 변환은 제자리 연산이라 매번 원본을 다시 채우고 변환만 잼
+				float transformMs = FLT_MAX;
+				for (int r = 0; r < Repeat; r++)
+				{
+					store.Assign(points);
+					auto start = std::chrono::steady_clock::now();
+					Transform(*table, store, matrix);
+					transformMs = std::min(transformMs, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+				}
+				std::vector<glm::vec3> transformed(pointCount);
+				store.Interleave(transformed.data());
+
+				store.Assign(points);
+				aos = points;
+				float translateMs = MeasureBest(Repeat, [&]() {
+					TranslateSubset(*table, store, aos.data(), targets.data(), starts.data(), scales.data(), targets.size(), glm::vec3(0.1f, 0.2f, 0.3f));
+				});
+				std::vector<glm::vec3> translated(pointCount);
+				store.Interleave(translated.data());
+
+				int nearest = -1;
+				float distance = 0.0f;
+				float nearestMs = MeasureBest(Repeat, [&]() {
+					nearest = NearestToRay(*table, store, rayOrigin, rayDir, 0.3f, distance);
+				});
+
+				glm::vec3 boundsMin(0.0f), boundsMax(0.0f);
+				float boundsMs = MeasureBest(Repeat, [&]() {
+					BoundingBox(*table, store, boundsMin, boundsMax);
+				});
+
+				// 스칼라와 비교 (FMA 유무로 마지막 자리가 다를 수 있음 -> 허용 오차, 최근접은 거의 같은 거리면 통과)
+				bool match = true;
+				if (table == GetScalarPositionKernels())
+				{
+					referencePositions = transformed;
+					referenceTranslated = translated;
+					referenceAos = aos;
+					referenceMin = boundsMin;
+					referenceMax = boundsMax;
+					referenceNearest = nearest;
+					referenceDistance = distance;
+				}
+				else
+				{
+					for (size_t i = 0; i < pointCount && match; i++)
+						match = glm::length(transformed[i] - referencePositions[i]) <= 1e-4f;
+					// 이동은 저장소와 aos 양쪽 (흩어 쓰기 대상, 대상이 아닌 정점, 마지막 블록 빈 칸이 반영된 박스까지)
+					for (size_t i = 0; i < pointCount && match; i++)
+						match = glm::length(translated[i] - referenceTranslated[i]) <= 1e-4f && glm::length(aos[i] - referenceAos[i]) <= 1e-4f;
+					match = match && boundsMin == referenceMin && boundsMax == referenceMax;
+					match = match && (nearest == referenceNearest || ((nearest < 0) == (referenceNearest < 0) && std::abs(distance - referenceDistance) < 1e-5f));
+				}
+
+				MX_CORE_INFO("  {0:<8} {1:>10.3f} {2:>10.3f} {3:>10.3f} {4:>10.3f}{5}", table->Name,
+					transformMs, translateMs, nearestMs, boundsMs, match ? "" : "  MISMATCH");
+				if (!match)
+					MX_CORE_WARN("Position kernels '{0}' differ from the scalar reference", table->Name);
+			}
+		}
+	}
+}
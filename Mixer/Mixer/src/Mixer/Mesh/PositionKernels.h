@@ -0,0 +1,32 @@
+#pragma once
+
+#include "PositionStore.h"
+#include "PositionKernelTable.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 실행 중 선택된 표로 호출 (Init 전에는 스칼라)
+	namespace PositionKernels {
+
+		// CpuInfo::Detect 이후 한 번: 이 CPU에서 돌 수 있는 가장 넓은 변형 선택
+		void Init();
+		const char* GetVariantName();
+
+		// 이 CPU에서 실행 가능한 변형 (좁은 것부터)
+		std::vector<const PositionKernelTable*> GetSupportedTables();
+
+		// 모든 변형을 같은 데이터로 돌려서 시간 비교 + 결과가 스칼라와 같은지 확인 (로그 출력)
+		void RunBenchmark(size_t pointCount);
+
+		void Transform(PositionStore& store, const glm::mat4& matrix);
+		void TranslateSubset(PositionStore& store, glm::vec3* aos, const uint32_t* indices,
+			const glm::vec3* starts, const glm::vec3* scales, size_t count, const glm::vec3& delta);
+		int NearestToRay(const PositionStore& store, const glm::vec3& origin, const glm::vec3& direction,
+			float maxDistance, float& outDistance);
+		bool BoundingBox(const PositionStore& store, glm::vec3& outMin, glm::vec3& outMax);
+	}
+}
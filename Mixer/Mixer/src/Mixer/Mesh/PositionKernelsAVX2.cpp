@@ -0,0 +1,130 @@
+// AVX2 + FMA 변형 (이 파일만 /arch:AVX2, -mavx2 -mfma로 빌드). 블록 하나 = 레지스터 하나
+// mxpch.h, glm, PositionStore를 포함하지 않음 (공유 인라인 함수의 AVX 사본이 생기지 않게, PositionKernelTable.h 참고)
+#include "PositionKernelTable.h"
+#include "PositionKernelsCommon.h"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define MX_KERNELS_AVX2
+#endif
+
+namespace Mixer {
+
+#ifdef MX_KERNELS_AVX2
+
+	static void Transform(PositionBlock* blocks, size_t blockCount, const float* m)
+	{
+		__m256 m00 = _mm256_set1_ps(m[0]), m01 = _mm256_set1_ps(m[1]), m02 = _mm256_set1_ps(m[2]);
+		__m256 m10 = _mm256_set1_ps(m[4]), m11 = _mm256_set1_ps(m[5]), m12 = _mm256_set1_ps(m[6]);
+		__m256 m20 = _mm256_set1_ps(m[8]), m21 = _mm256_set1_ps(m[9]), m22 = _mm256_set1_ps(m[10]);
+		__m256 m30 = _mm256_set1_ps(m[12]), m31 = _mm256_set1_ps(m[13]), m32 = _mm256_set1_ps(m[14]);
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			__m256 x = _mm256_load_ps(blocks[b].X), y = _mm256_load_ps(blocks[b].Y), z = _mm256_load_ps(blocks[b].Z);
+			_mm256_store_ps(blocks[b].X, _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m10, y, _mm256_fmadd_ps(m20, z, m30))));
+			_mm256_store_ps(blocks[b].Y, _mm256_fmadd_ps(m01, x, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m21, z, m31))));
+			_mm256_store_ps(blocks[b].Z, _mm256_fmadd_ps(m02, x, _mm256_fmadd_ps(m12, y, _mm256_fmadd_ps(m22, z, m32))));
+		}
+	}
+
+	static void TranslateSubset(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+		const float* starts, const float* scales, size_t targetCount, const float* delta)
+	{
+		// 대상 8개 = float 24개 = 레지스터 3개. 델타는 xyz 반복이라 위상만 다른 3개 패턴
+		__m256 d0 = _mm256_setr_ps(delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1]);
+		__m256 d1 = _mm256_setr_ps(delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0]);
+		__m256 d2 = _mm256_setr_ps(delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2]);
+
+		alignas(32) float result[24];
+		size_t i = 0;
+		for (; i + 8 <= targetCount; i += 8)
+		{
+			const float* s = starts + i * 3;
+			const float* k = scales + i * 3;
+			_mm256_store_ps(result + 0, _mm256_fmadd_ps(_mm256_loadu_ps(k + 0), d0, _mm256_loadu_ps(s + 0)));
+			_mm256_store_ps(result + 8, _mm256_fmadd_ps(_mm256_loadu_ps(k + 8), d1, _mm256_loadu_ps(s + 8)));
+			_mm256_store_ps(result + 16, _mm256_fmadd_ps(_mm256_loadu_ps(k + 16), d2, _mm256_loadu_ps(s + 16)));
+
+			// 흩어 쓰기는 인덱스가 제각각이라 스칼라
+			for (int lane = 0; lane < 8; lane++)
+			{
+				const float* p = result + lane * 3;
+				PositionKernelsCommon::WritePosition(blocks, count, aos, indices[i + lane], p[0], p[1], p[2]);
+			}
+		}
+		PositionKernelsCommon::TranslateRange(blocks, count, aos, indices, starts, scales, i, targetCount, delta);
+	}
+
+	static int NearestToRay(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+		const float* direction, float maxDistance, float* outDistance2)
+	{
+		__m256 ox = _mm256_set1_ps(origin[0]), oy = _mm256_set1_ps(origin[1]), oz = _mm256_set1_ps(origin[2]);
+		__m256 dx = _mm256_set1_ps(direction[0]), dy = _mm256_set1_ps(direction[1]), dz = _mm256_set1_ps(direction[2]);
+		__m256 best = _mm256_set1_ps(maxDistance * maxDistance);
+		__m256i bestIndex = _mm256_set1_epi32(-1);
+		__m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+		__m256i step = _mm256_set1_epi32(8);
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			__m256 px = _mm256_sub_ps(_mm256_load_ps(blocks[b].X), ox);
+			__m256 py = _mm256_sub_ps(_mm256_load_ps(blocks[b].Y), oy);
+			__m256 pz = _mm256_sub_ps(_mm256_load_ps(blocks[b].Z), oz);
+
+			__m256 cx = _mm256_fmsub_ps(py, dz, _mm256_mul_ps(pz, dy));
+			__m256 cy = _mm256_fmsub_ps(pz, dx, _mm256_mul_ps(px, dz));
+			__m256 cz = _mm256_fmsub_ps(px, dy, _mm256_mul_ps(py, dx));
+			__m256 distance2 = _mm256_fmadd_ps(cx, cx, _mm256_fmadd_ps(cy, cy, _mm256_mul_ps(cz, cz)));
+
+			__m256 closer = _mm256_cmp_ps(distance2, best, _CMP_LT_OQ);
+			best = _mm256_blendv_ps(best, distance2, closer);
+			bestIndex = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(bestIndex), _mm256_castsi256_ps(index), closer));
+			index = _mm256_add_epi32(index, step);
+		}
+
+		alignas(32) float distances2[8];
+		alignas(32) int indices[8];
+		_mm256_store_ps(distances2, best);
+		_mm256_store_si256((__m256i*)indices, bestIndex);
+		return PositionKernelsCommon::ReduceNearest(distances2, indices, 8, count, outDistance2);
+	}
+
+	static bool BoundingBox(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax)
+	{
+		if (blockCount == 0)
+			return false;
+
+		__m256 minX = _mm256_load_ps(blocks[0].X), minY = _mm256_load_ps(blocks[0].Y), minZ = _mm256_load_ps(blocks[0].Z);
+		__m256 maxX = minX, maxY = minY, maxZ = minZ;
+		for (size_t b = 1; b < blockCount; b++)
+		{
+			__m256 x = _mm256_load_ps(blocks[b].X), y = _mm256_load_ps(blocks[b].Y), z = _mm256_load_ps(blocks[b].Z);
+			minX = _mm256_min_ps(minX, x); maxX = _mm256_max_ps(maxX, x);
+			minY = _mm256_min_ps(minY, y); maxY = _mm256_max_ps(maxY, y);
+			minZ = _mm256_min_ps(minZ, z); maxZ = _mm256_max_ps(maxZ, z);
+		}
+
+		alignas(32) float lanes[6][8];
+		_mm256_store_ps(lanes[0], minX); _mm256_store_ps(lanes[1], minY); _mm256_store_ps(lanes[2], minZ);
+		_mm256_store_ps(lanes[3], maxX); _mm256_store_ps(lanes[4], maxY); _mm256_store_ps(lanes[5], maxZ);
+		PositionKernelsCommon::ReduceBounds(lanes[0], lanes[1], lanes[2], lanes[3], lanes[4], lanes[5], 8, outMin, outMax);
+		return true;
+	}
+
+	static const PositionKernelTable s_Table = { "AVX2", Transform, TranslateSubset, NearestToRay, BoundingBox };
+
+	const PositionKernelTable* GetAVX2PositionKernels()
+	{
+		return &s_Table;
+	}
+
+#else
+
+	const PositionKernelTable* GetAVX2PositionKernels()
+	{
+		return nullptr;
+	}
+
+#endif
+}
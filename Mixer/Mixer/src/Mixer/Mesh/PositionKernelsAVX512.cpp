@@ -0,0 +1,156 @@
+// AVX-512F 변형 (이 파일만 /arch:AVX512, -mavx512f로 빌드). 블록 두 개 = 레지스터 하나
+// DQ/VL 확장은 쓰지 않음 (F만 있는 CPU도 지원)
+// mxpch.h, glm, PositionStore를 포함하지 않음 (공유 인라인 함수의 EVEX 사본이 생기지 않게, PositionKernelTable.h 참고)
+#include "PositionKernelTable.h"
+#include "PositionKernelsCommon.h"
+
+#if defined(__AVX512F__)
+	#include <immintrin.h>
+	#define MX_KERNELS_AVX512
+#endif
+
+namespace Mixer {
+
+#ifdef MX_KERNELS_AVX512
+
+	// 블록 두 개의 같은 축 -> 16칸 (홀수 개 남은 마지막 블록은 a == b로 불러서 위 절반을 무시)
+	static inline __m512 Load2(const float* a, const float* b)
+	{
+		__m512d low = _mm512_castpd256_pd512(_mm256_castps_pd(_mm256_load_ps(a)));
+		return _mm512_castpd_ps(_mm512_insertf64x4(low, _mm256_castps_pd(_mm256_load_ps(b)), 1));
+	}
+
+	static inline void Store2(float* a, float* b, __m512 v)
+	{
+		_mm256_store_ps(a, _mm512_castps512_ps256(v));
+		if (b != a)
+			_mm256_store_ps(b, _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+	}
+
+	static void Transform(PositionBlock* blocks, size_t blockCount, const float* m)
+	{
+		__m512 m00 = _mm512_set1_ps(m[0]), m01 = _mm512_set1_ps(m[1]), m02 = _mm512_set1_ps(m[2]);
+		__m512 m10 = _mm512_set1_ps(m[4]), m11 = _mm512_set1_ps(m[5]), m12 = _mm512_set1_ps(m[6]);
+		__m512 m20 = _mm512_set1_ps(m[8]), m21 = _mm512_set1_ps(m[9]), m22 = _mm512_set1_ps(m[10]);
+		__m512 m30 = _mm512_set1_ps(m[12]), m31 = _mm512_set1_ps(m[13]), m32 = _mm512_set1_ps(m[14]);
+
+		for (size_t b = 0; b < blockCount; b += 2)
+		{
+			PositionBlock& first = blocks[b];
+			PositionBlock& second = blocks[b + 1 < blockCount ? b + 1 : b];
+			__m512 x = Load2(first.X, second.X), y = Load2(first.Y, second.Y), z = Load2(first.Z, second.Z);
+			__m512 rx = _mm512_fmadd_ps(m00, x, _mm512_fmadd_ps(m10, y, _mm512_fmadd_ps(m20, z, m30)));
+			__m512 ry = _mm512_fmadd_ps(m01, x, _mm512_fmadd_ps(m11, y, _mm512_fmadd_ps(m21, z, m31)));
+			__m512 rz = _mm512_fmadd_ps(m02, x, _mm512_fmadd_ps(m12, y, _mm512_fmadd_ps(m22, z, m32)));
+			Store2(first.X, second.X, rx);
+			Store2(first.Y, second.Y, ry);
+			Store2(first.Z, second.Z, rz);
+		}
+	}
+
+	static void TranslateSubset(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+		const float* starts, const float* scales, size_t targetCount, const float* delta)
+	{
+		// 대상 16개 = float 48개 = 레지스터 3개 (16 = 3 * 5 + 1이라 위상이 x, y, z 순서로 밀림)
+		__m512 d0 = _mm512_setr_ps(delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1],
+			delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0]);
+		__m512 d1 = _mm512_setr_ps(delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2],
+			delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1]);
+		__m512 d2 = _mm512_setr_ps(delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2], delta[0],
+			delta[1], delta[2], delta[0], delta[1], delta[2], delta[0], delta[1], delta[2]);
+
+		alignas(64) float result[48];
+		size_t i = 0;
+		for (; i + 16 <= targetCount; i += 16)
+		{
+			const float* s = starts + i * 3;
+			const float* k = scales + i * 3;
+			_mm512_store_ps(result + 0, _mm512_fmadd_ps(_mm512_loadu_ps(k + 0), d0, _mm512_loadu_ps(s + 0)));
+			_mm512_store_ps(result + 16, _mm512_fmadd_ps(_mm512_loadu_ps(k + 16), d1, _mm512_loadu_ps(s + 16)));
+			_mm512_store_ps(result + 32, _mm512_fmadd_ps(_mm512_loadu_ps(k + 32), d2, _mm512_loadu_ps(s + 32)));
+
+			for (int lane = 0; lane < 16; lane++)
+			{
+				const float* p = result + lane * 3;
+				PositionKernelsCommon::WritePosition(blocks, count, aos, indices[i + lane], p[0], p[1], p[2]);
+			}
+		}
+		PositionKernelsCommon::TranslateRange(blocks, count, aos, indices, starts, scales, i, targetCount, delta);
+	}
+
+	static int NearestToRay(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+		const float* direction, float maxDistance, float* outDistance2)
+	{
+		__m512 ox = _mm512_set1_ps(origin[0]), oy = _mm512_set1_ps(origin[1]), oz = _mm512_set1_ps(origin[2]);
+		__m512 dx = _mm512_set1_ps(direction[0]), dy = _mm512_set1_ps(direction[1]), dz = _mm512_set1_ps(direction[2]);
+		__m512 best = _mm512_set1_ps(maxDistance * maxDistance);
+		__m512i bestIndex = _mm512_set1_epi32(-1);
+		__m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		__m512i step = _mm512_set1_epi32(16);
+
+		for (size_t b = 0; b < blockCount; b += 2)
+		{
+			bool paired = b + 1 < blockCount;
+			const PositionBlock& first = blocks[b];
+			const PositionBlock& second = blocks[paired ? b + 1 : b];
+			__m512 px = _mm512_sub_ps(Load2(first.X, second.X), ox);
+			__m512 py = _mm512_sub_ps(Load2(first.Y, second.Y), oy);
+			__m512 pz = _mm512_sub_ps(Load2(first.Z, second.Z), oz);
+
+			__m512 cx = _mm512_fmsub_ps(py, dz, _mm512_mul_ps(pz, dy));
+			__m512 cy = _mm512_fmsub_ps(pz, dx, _mm512_mul_ps(px, dz));
+			__m512 cz = _mm512_fmsub_ps(px, dy, _mm512_mul_ps(py, dx));
+			__m512 distance2 = _mm512_fmadd_ps(cx, cx, _mm512_fmadd_ps(cy, cy, _mm512_mul_ps(cz, cz)));
+
+			__mmask16 closer = _mm512_cmp_ps_mask(distance2, best, _CMP_LT_OQ) & (paired ? 0xFFFF : 0x00FF);
+			best = _mm512_mask_mov_ps(best, closer, distance2);
+			bestIndex = _mm512_mask_mov_epi32(bestIndex, closer, index);
+			index = _mm512_add_epi32(index, step);
+		}
+
+		alignas(64) float distances2[16];
+		alignas(64) int indices[16];
+		_mm512_store_ps(distances2, best);
+		_mm512_store_si512(indices, bestIndex);
+		return PositionKernelsCommon::ReduceNearest(distances2, indices, 16, count, outDistance2);
+	}
+
+	static bool BoundingBox(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax)
+	{
+		if (blockCount == 0)
+			return false;
+
+		__m512 minX = Load2(blocks[0].X, blocks[0].X), minY = Load2(blocks[0].Y, blocks[0].Y), minZ = Load2(blocks[0].Z, blocks[0].Z);
+		__m512 maxX = minX, maxY = minY, maxZ = minZ;
+		for (size_t b = 0; b < blockCount; b += 2)
+		{
+			// 짝 없는 마지막 블록은 같은 블록을 두 번 -> 최소/최대에 영향 없음
+			const PositionBlock& first = blocks[b];
+			const PositionBlock& second = blocks[b + 1 < blockCount ? b + 1 : b];
+			__m512 x = Load2(first.X, second.X), y = Load2(first.Y, second.Y), z = Load2(first.Z, second.Z);
+			minX = _mm512_min_ps(minX, x); maxX = _mm512_max_ps(maxX, x);
+			minY = _mm512_min_ps(minY, y); maxY = _mm512_max_ps(maxY, y);
+			minZ = _mm512_min_ps(minZ, z); maxZ = _mm512_max_ps(maxZ, z);
+		}
+
+		outMin[0] = _mm512_reduce_min_ps(minX); outMin[1] = _mm512_reduce_min_ps(minY); outMin[2] = _mm512_reduce_min_ps(minZ);
+		outMax[0] = _mm512_reduce_max_ps(maxX); outMax[1] = _mm512_reduce_max_ps(maxY); outMax[2] = _mm512_reduce_max_ps(maxZ);
+		return true;
+	}
+
+	static const PositionKernelTable s_Table = { "AVX-512", Transform, TranslateSubset, NearestToRay, BoundingBox };
+
+	const PositionKernelTable* GetAVX512PositionKernels()
+	{
+		return &s_Table;
+	}
+
+#else
+
+	const PositionKernelTable* GetAVX512PositionKernels()
+	{
+		return nullptr;
+	}
+
+#endif
+}
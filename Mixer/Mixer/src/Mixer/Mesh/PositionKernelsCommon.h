@@ -0,0 +1,80 @@
+#pragma once
+
+#include "PositionKernelTable.h"
+
+#include <cfloat>
+
+// 변형 파일끼리 공유하는 스칼라 도우미 (각 변형 파일에서만 포함)
+// static: 변형마다 다른 명령어로 컴파일된 사본이 링크 때 섞이지 않게 파일 내부 함수로 둠
+// 같은 이유로 glm, 표준 라이브러리 함수(std::sqrt 등), mxpch.h는 쓰지 않음 (float 연산과 내장 함수만)
+namespace Mixer {
+	namespace PositionKernelsCommon {
+
+		// 정점 하나를 aos와 블록에 씀 (PositionStore::Set과 같이 마지막 정점이면 뒤의 빈 칸도)
+		static inline void WritePosition(PositionBlock* blocks, size_t count, float* aos, uint32_t index,
+			float x, float y, float z)
+		{
+			aos[index * 3 + 0] = x;
+			aos[index * 3 + 1] = y;
+			aos[index * 3 + 2] = z;
+
+			PositionBlock& block = blocks[index >> 3];
+			uint32_t last = index + 1 == count ? 7 : (index & 7);
+			for (uint32_t lane = index & 7; lane <= last; lane++)
+			{
+				block.X[lane] = x;
+				block.Y[lane] = y;
+				block.Z[lane] = z;
+			}
+		}
+
+		// 남은 대상 처리
+		static inline void TranslateRange(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+			const float* starts, const float* scales, size_t begin, size_t end, const float* delta)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				const float* s = starts + i * 3;
+				const float* k = scales + i * 3;
+				WritePosition(blocks, count, aos, indices[i], s[0] + delta[0] * k[0], s[1] + delta[1] * k[1], s[2] + delta[2] * k[2]);
+			}
+		}
+
+		// 레인별 최소 -> 하나로 (거리가 같으면 번호가 작은 쪽, 빈 칸(번호 >= count)은 무시)
+		static inline int ReduceNearest(const float* distances2, const int* indices, int laneCount, size_t count, float* outDistance2)
+		{
+			int best = -1;
+			float bestDistance2 = FLT_MAX;
+			for (int lane = 0; lane < laneCount; lane++)
+			{
+				if (indices[lane] < 0 || (size_t)indices[lane] >= count)
+					continue;
+				if (distances2[lane] < bestDistance2 || (distances2[lane] == bestDistance2 && indices[lane] < best))
+				{
+					bestDistance2 = distances2[lane];
+					best = indices[lane];
+				}
+			}
+			if (best >= 0)
+				*outDistance2 = bestDistance2;
+			return best;
+		}
+
+		// 레인 최소/최대 -> 박스
+		static inline void ReduceBounds(const float* minX, const float* minY, const float* minZ,
+			const float* maxX, const float* maxY, const float* maxZ, int laneCount, float* outMin, float* outMax)
+		{
+			outMin[0] = outMin[1] = outMin[2] = FLT_MAX;
+			outMax[0] = outMax[1] = outMax[2] = -FLT_MAX;
+			for (int lane = 0; lane < laneCount; lane++)
+			{
+				outMin[0] = minX[lane] < outMin[0] ? minX[lane] : outMin[0];
+				outMin[1] = minY[lane] < outMin[1] ? minY[lane] : outMin[1];
+				outMin[2] = minZ[lane] < outMin[2] ? minZ[lane] : outMin[2];
+				outMax[0] = maxX[lane] > outMax[0] ? maxX[lane] : outMax[0];
+				outMax[1] = maxY[lane] > outMax[1] ? maxY[lane] : outMax[1];
+				outMax[2] = maxZ[lane] > outMax[2] ? maxZ[lane] : outMax[2];
+			}
+		}
+	}
+}
@@ -0,0 +1,137 @@
+// NEON 변형 (ARMv8에서는 항상 사용 가능). 블록 하나 = 레지스터 두 개
+// 다른 변형과 같이 mxpch.h, glm, PositionStore를 포함하지 않음 (PositionKernelTable.h 참고)
+#include "PositionKernelTable.h"
+#include "PositionKernelsCommon.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define MX_KERNELS_NEON
+#endif
+
+namespace Mixer {
+
+#ifdef MX_KERNELS_NEON
+
+	static void Transform(PositionBlock* blocks, size_t blockCount, const float* m)
+	{
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			// 블록 하나 = 4개씩 두 번
+			for (int half = 0; half < 8; half += 4)
+			{
+				float32x4_t x = vld1q_f32(blocks[b].X + half), y = vld1q_f32(blocks[b].Y + half), z = vld1q_f32(blocks[b].Z + half);
+				float32x4_t rx = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]), z, m[8]), y, m[4]), x, m[0]);
+				float32x4_t ry = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]), z, m[9]), y, m[5]), x, m[1]);
+				float32x4_t rz = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[14]), z, m[10]), y, m[6]), x, m[2]);
+				vst1q_f32(blocks[b].X + half, rx);
+				vst1q_f32(blocks[b].Y + half, ry);
+				vst1q_f32(blocks[b].Z + half, rz);
+			}
+		}
+	}
+
+	static void TranslateSubset(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+		const float* starts, const float* scales, size_t targetCount, const float* delta)
+	{
+		// 대상 4개 = float 12개 = 레지스터 3개
+		const float d0v[4] = { delta[0], delta[1], delta[2], delta[0] };
+		const float d1v[4] = { delta[1], delta[2], delta[0], delta[1] };
+		const float d2v[4] = { delta[2], delta[0], delta[1], delta[2] };
+		float32x4_t d0 = vld1q_f32(d0v), d1 = vld1q_f32(d1v), d2 = vld1q_f32(d2v);
+
+		float result[12];
+		size_t i = 0;
+		for (; i + 4 <= targetCount; i += 4)
+		{
+			const float* s = starts + i * 3;
+			const float* k = scales + i * 3;
+			vst1q_f32(result + 0, vmlaq_f32(vld1q_f32(s + 0), vld1q_f32(k + 0), d0));
+			vst1q_f32(result + 4, vmlaq_f32(vld1q_f32(s + 4), vld1q_f32(k + 4), d1));
+			vst1q_f32(result + 8, vmlaq_f32(vld1q_f32(s + 8), vld1q_f32(k + 8), d2));
+
+			for (int lane = 0; lane < 4; lane++)
+			{
+				const float* p = result + lane * 3;
+				PositionKernelsCommon::WritePosition(blocks, count, aos, indices[i + lane], p[0], p[1], p[2]);
+			}
+		}
+		PositionKernelsCommon::TranslateRange(blocks, count, aos, indices, starts, scales, i, targetCount, delta);
+	}
+
+	static int NearestToRay(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+		const float* direction, float maxDistance, float* outDistance2)
+	{
+		float32x4_t ox = vdupq_n_f32(origin[0]), oy = vdupq_n_f32(origin[1]), oz = vdupq_n_f32(origin[2]);
+		float32x4_t best[2] = { vdupq_n_f32(maxDistance * maxDistance), vdupq_n_f32(maxDistance * maxDistance) };
+		int32x4_t bestIndex[2] = { vdupq_n_s32(-1), vdupq_n_s32(-1) };
+		const int32_t laneOffsets[4] = { 0, 1, 2, 3 };
+		int32x4_t index = vld1q_s32(laneOffsets);
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int half = 0; half < 2; half++)
+			{
+				float32x4_t px = vsubq_f32(vld1q_f32(blocks[b].X + half * 4), ox);
+				float32x4_t py = vsubq_f32(vld1q_f32(blocks[b].Y + half * 4), oy);
+				float32x4_t pz = vsubq_f32(vld1q_f32(blocks[b].Z + half * 4), oz);
+
+				float32x4_t cx = vmlsq_n_f32(vmulq_n_f32(py, direction[2]), pz, direction[1]);
+				float32x4_t cy = vmlsq_n_f32(vmulq_n_f32(pz, direction[0]), px, direction[2]);
+				float32x4_t cz = vmlsq_n_f32(vmulq_n_f32(px, direction[1]), py, direction[0]);
+				float32x4_t distance2 = vmlaq_f32(vmlaq_f32(vmulq_f32(cz, cz), cy, cy), cx, cx);
+
+				uint32x4_t closer = vcltq_f32(distance2, best[half]);
+				best[half] = vbslq_f32(closer, distance2, best[half]);
+				bestIndex[half] = vbslq_s32(closer, index, bestIndex[half]);
+				index = vaddq_s32(index, vdupq_n_s32(4));
+			}
+		}
+
+		float distances2[8];
+		int indices[8];
+		vst1q_f32(distances2, best[0]);
+		vst1q_f32(distances2 + 4, best[1]);
+		vst1q_s32(indices, bestIndex[0]);
+		vst1q_s32(indices + 4, bestIndex[1]);
+		return PositionKernelsCommon::ReduceNearest(distances2, indices, 8, count, outDistance2);
+	}
+
+	static bool BoundingBox(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax)
+	{
+		if (blockCount == 0)
+			return false;
+
+		float32x4_t minX = vld1q_f32(blocks[0].X), minY = vld1q_f32(blocks[0].Y), minZ = vld1q_f32(blocks[0].Z);
+		float32x4_t maxX = minX, maxY = minY, maxZ = minZ;
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int half = 0; half < 8; half += 4)
+			{
+				float32x4_t x = vld1q_f32(blocks[b].X + half), y = vld1q_f32(blocks[b].Y + half), z = vld1q_f32(blocks[b].Z + half);
+				minX = vminq_f32(minX, x); maxX = vmaxq_f32(maxX, x);
+				minY = vminq_f32(minY, y); maxY = vmaxq_f32(maxY, y);
+				minZ = vminq_f32(minZ, z); maxZ = vmaxq_f32(maxZ, z);
+			}
+		}
+
+		outMin[0] = vminvq_f32(minX); outMin[1] = vminvq_f32(minY); outMin[2] = vminvq_f32(minZ);
+		outMax[0] = vmaxvq_f32(maxX); outMax[1] = vmaxvq_f32(maxY); outMax[2] = vmaxvq_f32(maxZ);
+		return true;
+	}
+
+	static const PositionKernelTable s_Table = { "NEON", Transform, TranslateSubset, NearestToRay, BoundingBox };
+
+	const PositionKernelTable* GetNEONPositionKernels()
+	{
+		return &s_Table;
+	}
+
+#else
+
+	const PositionKernelTable* GetNEONPositionKernels()
+	{
+		return nullptr;
+	}
+
+#endif
+}
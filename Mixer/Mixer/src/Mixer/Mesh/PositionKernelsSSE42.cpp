@@ -0,0 +1,143 @@
+// SSE4.2 변형 (이 파일만 -msse4.2로 빌드, MSVC x64는 옵션 없이 가능). 블록 하나 = 레지스터 두 개, FMA 없음
+// mxpch.h, glm, PositionStore를 포함하지 않음 (공유 인라인 함수의 SSE4 사본이 생기지 않게, PositionKernelTable.h 참고)
+#include "PositionKernelTable.h"
+#include "PositionKernelsCommon.h"
+
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+	#include <nmmintrin.h>
+	#define MX_KERNELS_SSE42
+#endif
+
+namespace Mixer {
+
+#ifdef MX_KERNELS_SSE42
+
+	static void Transform(PositionBlock* blocks, size_t blockCount, const float* m)
+	{
+		__m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[1]), m02 = _mm_set1_ps(m[2]);
+		__m128 m10 = _mm_set1_ps(m[4]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[6]);
+		__m128 m20 = _mm_set1_ps(m[8]), m21 = _mm_set1_ps(m[9]), m22 = _mm_set1_ps(m[10]);
+		__m128 m30 = _mm_set1_ps(m[12]), m31 = _mm_set1_ps(m[13]), m32 = _mm_set1_ps(m[14]);
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int half = 0; half < 8; half += 4)
+			{
+				__m128 x = _mm_load_ps(blocks[b].X + half), y = _mm_load_ps(blocks[b].Y + half), z = _mm_load_ps(blocks[b].Z + half);
+				__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)), _mm_add_ps(_mm_mul_ps(m20, z), m30));
+				__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m21, z), m31));
+				__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)), _mm_add_ps(_mm_mul_ps(m22, z), m32));
+				_mm_store_ps(blocks[b].X + half, rx);
+				_mm_store_ps(blocks[b].Y + half, ry);
+				_mm_store_ps(blocks[b].Z + half, rz);
+			}
+		}
+	}
+
+	static void TranslateSubset(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+		const float* starts, const float* scales, size_t targetCount, const float* delta)
+	{
+		// 대상 4개 = float 12개 = 레지스터 3개
+		__m128 d0 = _mm_setr_ps(delta[0], delta[1], delta[2], delta[0]);
+		__m128 d1 = _mm_setr_ps(delta[1], delta[2], delta[0], delta[1]);
+		__m128 d2 = _mm_setr_ps(delta[2], delta[0], delta[1], delta[2]);
+
+		alignas(16) float result[12];
+		size_t i = 0;
+		for (; i + 4 <= targetCount; i += 4)
+		{
+			const float* s = starts + i * 3;
+			const float* k = scales + i * 3;
+			_mm_store_ps(result + 0, _mm_add_ps(_mm_loadu_ps(s + 0), _mm_mul_ps(_mm_loadu_ps(k + 0), d0)));
+			_mm_store_ps(result + 4, _mm_add_ps(_mm_loadu_ps(s + 4), _mm_mul_ps(_mm_loadu_ps(k + 4), d1)));
+			_mm_store_ps(result + 8, _mm_add_ps(_mm_loadu_ps(s + 8), _mm_mul_ps(_mm_loadu_ps(k + 8), d2)));
+
+			for (int lane = 0; lane < 4; lane++)
+			{
+				const float* p = result + lane * 3;
+				PositionKernelsCommon::WritePosition(blocks, count, aos, indices[i + lane], p[0], p[1], p[2]);
+			}
+		}
+		PositionKernelsCommon::TranslateRange(blocks, count, aos, indices, starts, scales, i, targetCount, delta);
+	}
+
+	static int NearestToRay(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+		const float* direction, float maxDistance, float* outDistance2)
+	{
+		__m128 ox = _mm_set1_ps(origin[0]), oy = _mm_set1_ps(origin[1]), oz = _mm_set1_ps(origin[2]);
+		__m128 dx = _mm_set1_ps(direction[0]), dy = _mm_set1_ps(direction[1]), dz = _mm_set1_ps(direction[2]);
+		__m128 best[2] = { _mm_set1_ps(maxDistance * maxDistance), _mm_set1_ps(maxDistance * maxDistance) };
+		__m128i bestIndex[2] = { _mm_set1_epi32(-1), _mm_set1_epi32(-1) };
+		__m128i index = _mm_setr_epi32(0, 1, 2, 3);
+		__m128i step = _mm_set1_epi32(4);
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int half = 0; half < 2; half++)
+			{
+				__m128 px = _mm_sub_ps(_mm_load_ps(blocks[b].X + half * 4), ox);
+				__m128 py = _mm_sub_ps(_mm_load_ps(blocks[b].Y + half * 4), oy);
+				__m128 pz = _mm_sub_ps(_mm_load_ps(blocks[b].Z + half * 4), oz);
+
+				__m128 cx = _mm_sub_ps(_mm_mul_ps(py, dz), _mm_mul_ps(pz, dy));
+				__m128 cy = _mm_sub_ps(_mm_mul_ps(pz, dx), _mm_mul_ps(px, dz));
+				__m128 cz = _mm_sub_ps(_mm_mul_ps(px, dy), _mm_mul_ps(py, dx));
+				__m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)), _mm_mul_ps(cz, cz));
+
+				__m128 closer = _mm_cmplt_ps(distance2, best[half]);
+				best[half] = _mm_blendv_ps(best[half], distance2, closer);
+				bestIndex[half] = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(bestIndex[half]), _mm_castsi128_ps(index), closer));
+				index = _mm_add_epi32(index, step);
+			}
+		}
+
+		alignas(16) float distances2[8];
+		alignas(16) int indices[8];
+		_mm_store_ps(distances2, best[0]);
+		_mm_store_ps(distances2 + 4, best[1]);
+		_mm_store_si128((__m128i*)indices, bestIndex[0]);
+		_mm_store_si128((__m128i*)(indices + 4), bestIndex[1]);
+		return PositionKernelsCommon::ReduceNearest(distances2, indices, 8, count, outDistance2);
+	}
+
+	static bool BoundingBox(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax)
+	{
+		if (blockCount == 0)
+			return false;
+
+		__m128 minX = _mm_load_ps(blocks[0].X), minY = _mm_load_ps(blocks[0].Y), minZ = _mm_load_ps(blocks[0].Z);
+		__m128 maxX = minX, maxY = minY, maxZ = minZ;
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int half = 0; half < 8; half += 4)
+			{
+				__m128 x = _mm_load_ps(blocks[b].X + half), y = _mm_load_ps(blocks[b].Y + half), z = _mm_load_ps(blocks[b].Z + half);
+				minX = _mm_min_ps(minX, x); maxX = _mm_max_ps(maxX, x);
+				minY = _mm_min_ps(minY, y); maxY = _mm_max_ps(maxY, y);
+				minZ = _mm_min_ps(minZ, z); maxZ = _mm_max_ps(maxZ, z);
+			}
+		}
+
+		alignas(16) float lanes[6][4];
+		_mm_store_ps(lanes[0], minX); _mm_store_ps(lanes[1], minY); _mm_store_ps(lanes[2], minZ);
+		_mm_store_ps(lanes[3], maxX); _mm_store_ps(lanes[4], maxY); _mm_store_ps(lanes[5], maxZ);
+		PositionKernelsCommon::ReduceBounds(lanes[0], lanes[1], lanes[2], lanes[3], lanes[4], lanes[5], 4, outMin, outMax);
+		return true;
+	}
+
+	static const PositionKernelTable s_Table = { "SSE4.2", Transform, TranslateSubset, NearestToRay, BoundingBox };
+
+	const PositionKernelTable* GetSSE42PositionKernels()
+	{
+		return &s_Table;
+	}
+
+#else
+
+	const PositionKernelTable* GetSSE42PositionKernels()
+	{
+		return nullptr;
+	}
+
+#endif
+}
@@ -0,0 +1,88 @@
+#include "mxpch.h"
+#include "PositionKernelTable.h"
+#include "PositionKernelsCommon.h"
+
+// 기준 구현 (모든 CPU). SIMD 변형의 결과 비교 기준이기도 함
+namespace Mixer {
+
+	static void Transform(PositionBlock* blocks, size_t blockCount, const float* m)
+	{
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int lane = 0; lane < 8; lane++)
+			{
+				float x = blocks[b].X[lane], y = blocks[b].Y[lane], z = blocks[b].Z[lane];
+				blocks[b].X[lane] = m[0] * x + m[4] * y + m[8] * z + m[12];
+				blocks[b].Y[lane] = m[1] * x + m[5] * y + m[9] * z + m[13];
+				blocks[b].Z[lane] = m[2] * x + m[6] * y + m[10] * z + m[14];
+			}
+		}
+	}
+
+	static void TranslateSubset(PositionBlock* blocks, size_t count, float* aos, const uint32_t* indices,
+		const float* starts, const float* scales, size_t targetCount, const float* delta)
+	{
+		PositionKernelsCommon::TranslateRange(blocks, count, aos, indices, starts, scales, 0, targetCount, delta);
+	}
+
+	static int NearestToRay(const PositionBlock* blocks, size_t blockCount, size_t count, const float* origin,
+		const float* direction, float maxDistance, float* outDistance2)
+	{
+		// 레인별로 따로 최소를 구해서 SIMD 버전과 같은 순서로 비교
+		float best[8];
+		int bestIndex[8];
+		for (int lane = 0; lane < 8; lane++)
+		{
+			best[lane] = maxDistance * maxDistance;
+			bestIndex[lane] = -1;
+		}
+
+		for (size_t b = 0; b < blockCount; b++)
+		{
+			for (int lane = 0; lane < 8; lane++)
+			{
+				float px = blocks[b].X[lane] - origin[0], py = blocks[b].Y[lane] - origin[1], pz = blocks[b].Z[lane] - origin[2];
+				float cx = py * direction[2] - pz * direction[1];
+				float cy = pz * direction[0] - px * direction[2];
+				float cz = px * direction[1] - py * direction[0];
+				float distance2 = cx * cx + cy * cy + cz * cz;
+				if (distance2 < best[lane])
+				{
+					best[lane] = distance2;
+					bestIndex[lane] = (int)(b * 8 + lane);
+				}
+			}
+		}
+		return PositionKernelsCommon::ReduceNearest(best, bestIndex, 8, count, outDistance2);
+	}
+
+	static bool BoundingBox(const PositionBlock* blocks, size_t blockCount, float* outMin, float* outMax)
+	{
+		if (blockCount == 0)
+			return false;
+
+		// 블록 하나를 레인 8개로 보고 레인별 최소/최대 -> 마지막에 합침
+		PositionBlock minimum = blocks[0], maximum = blocks[0];
+		for (size_t b = 1; b < blockCount; b++)
+		{
+			for (int lane = 0; lane < 8; lane++)
+			{
+				minimum.X[lane] = blocks[b].X[lane] < minimum.X[lane] ? blocks[b].X[lane] : minimum.X[lane];
+				minimum.Y[lane] = blocks[b].Y[lane] < minimum.Y[lane] ? blocks[b].Y[lane] : minimum.Y[lane];
+				minimum.Z[lane] = blocks[b].Z[lane] < minimum.Z[lane] ? blocks[b].Z[lane] : minimum.Z[lane];
+				maximum.X[lane] = blocks[b].X[lane] > maximum.X[lane] ? blocks[b].X[lane] : maximum.X[lane];
+				maximum.Y[lane] = blocks[b].Y[lane] > maximum.Y[lane] ? blocks[b].Y[lane] : maximum.Y[lane];
+				maximum.Z[lane] = blocks[b].Z[lane] > maximum.Z[lane] ? blocks[b].Z[lane] : maximum.Z[lane];
+			}
+		}
+		PositionKernelsCommon::ReduceBounds(minimum.X, minimum.Y, minimum.Z, maximum.X, maximum.Y, maximum.Z, 8, outMin, outMax);
+		return true;
+	}
+
+	static const PositionKernelTable s_Table = { "Scalar", Transform, TranslateSubset, NearestToRay, BoundingBox };
+
+	const PositionKernelTable* GetScalarPositionKernels()
+	{
+		return &s_Table;
+	}
+}
@@ -0,0 +1,40 @@
+#include "mxpch.h"
+#include "PositionStore.h"
+
+namespace Mixer {
+
+	void PositionStore::Assign(const std::vector<glm::vec3>& positions)
+	{
+		m_Count = positions.size();
+		m_Blocks.resize((m_Count + BlockSize - 1) / BlockSize);
+		if (m_Count == 0)
+			return;
+
+		for (size_t b = 0; b < m_Blocks.size(); b++)
+		{
+			PositionBlock& block = m_Blocks[b];
+			size_t base = b * BlockSize;
+			for (uint32_t lane = 0; lane < BlockSize; lane++)
+			{
+				const glm::vec3& p = positions[std::min(base + lane, m_Count - 1)];
+				block.X[lane] = p.x;
+				block.Y[lane] = p.y;
+				block.Z[lane] = p.z;
+			}
+		}
+	}
+
+	void PositionStore::Interleave(glm::vec3* out) const
+	{
+		size_t fullBlocks = m_Count / BlockSize;
+		for (size_t b = 0; b < fullBlocks; b++)
+		{
+			const PositionBlock& block = m_Blocks[b];
+			glm::vec3* dst = out + b * BlockSize;
+			for (uint32_t lane = 0; lane < BlockSize; lane++)
+				dst[lane] = { block.X[lane], block.Y[lane], block.Z[lane] };
+		}
+		for (size_t i = fullBlocks * BlockSize; i < m_Count; i++)
+			out[i] = Get((uint32_t)i);
+	}
+}
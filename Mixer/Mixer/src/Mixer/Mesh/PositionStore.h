@@ -0,0 +1,49 @@
+#pragma once
+
+#include "PositionBlock.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 위치 전용 저장소 (hover 검사, 이동, 바운딩 박스처럼 모든 정점을 도는 루프용)
+	// 마지막 블록의 빈 칸은 마지막 정점으로 채움 (Set도 유지) -> 최소/최대, 거리 계산 결과에 영향 없음
+	class PositionStore
+	{
+	public:
+		static constexpr uint32_t BlockSize = 8;
+
+		void Assign(const std::vector<glm::vec3>& positions); // AoS -> AoSoA
+		void Interleave(glm::vec3* out) const;                  // AoSoA -> AoS (GPU 업로드용, GetCount()개)
+
+		size_t GetCount() const { return m_Count; }
+		size_t GetBlockCount() const { return m_Blocks.size(); }
+		PositionBlock* GetBlocks() { return m_Blocks.data(); }
+		const PositionBlock* GetBlocks() const { return m_Blocks.data(); }
+
+		glm::vec3 Get(uint32_t index) const
+		{
+			const PositionBlock& block = m_Blocks[index >> 3];
+			uint32_t lane = index & 7;
+			return { block.X[lane], block.Y[lane], block.Z[lane] };
+		}
+		void Set(uint32_t index, const glm::vec3& p)
+		{
+			PositionBlock& block = m_Blocks[index >> 3];
+			// 마지막 정점이면 뒤의 빈 칸도 같이 (빈 칸이 옛 위치로 남으면 박스가 넓어지고 광선 검사에서 레인을 뺏김)
+			uint32_t last = index + 1 == m_Count ? BlockSize - 1 : (index & 7);
+			for (uint32_t lane = index & 7; lane <= last; lane++)
+			{
+				block.X[lane] = p.x;
+				block.Y[lane] = p.y;
+				block.Z[lane] = p.z;
+			}
+		}
+
+	private:
+		std::vector<PositionBlock> m_Blocks;
+		size_t m_Count = 0;
+	};
+}
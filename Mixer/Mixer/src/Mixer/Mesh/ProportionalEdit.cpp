@@ -0,0 +1,117 @@
+#include "mxpch.h"
+#include "ProportionalEdit.h"
+
+#include <cfloat>
+
+namespace Mixer {
+
+	void ProportionalEdit::Begin(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& seeds, float radius)
+	{
+		m_StartPositions = vertices;
+		m_Seeds = seeds;
+		m_Candidates.clear();
+		m_CandidateDistances.clear();
+		m_CandidateSeeds.clear();
+		m_IsKnown.assign(vertices.size(), 0);
+		m_BestDistances.assign(vertices.size(), FLT_MAX);
+		m_BestSeeds.assign(vertices.size(), 0);
+		for (uint32_t seed : seeds)
+			m_IsKnown[seed] = 1;
+
+		// 셀 크기 = 시작 반경 (조회 박스가 축마다 셀 3개 정도)
+		m_Hash.Build(m_StartPositions, std::max(radius, 1e-4f));
+		m_QueriedRadius = 0.0f;
+		m_Radius = 0.0f;
+		SetRadius(radius);
+	}
+
+	void ProportionalEdit::End()
+	{
+		m_StartPositions.clear();
+		m_StartPositions.shrink_to_fit();
+		m_Seeds.clear();
+		m_Hash.Clear();
+		m_Candidates.clear();
+		m_CandidateDistances.clear();
+		m_CandidateSeeds.clear();
+		m_IsKnown.clear();
+		m_BestDistances.clear();
+		m_BestSeeds.clear();
+		m_Vertices.clear();
+		m_Weights.clear();
+		m_NearestSeeds.clear();
+	}
+
+	void ProportionalEdit::SetRadius(float radius)
+	{
+		m_Radius = radius;
+		if (radius > m_QueriedRadius)
+			Query(radius);
+		UpdateWeights();
+	}
+
+	void ProportionalEdit::Query(float radius)
+	{
+		// [수정] 반경이 셀의 2배를 넘으면 셀을 반경 크기로 다시 만듦 (씨앗마다 훑는 셀 수가 반경에 따라 세제곱으로 늘지 않게)
+		if (radius > m_Hash.GetCellSize() * 2.0f)
+			m_Hash.Build(m_StartPositions, radius);
+
+		// 이전 반경 안의 후보는 가장 가까운 씨앗도 그 안에 있으므로 거리가 이미 정확함 -> 새로 찾은 정점만 추가
+		// [수정] 이전 반경 안의 정점은 이미 전부 찾았으므로 이전 반경 ~ 새 반경 껍질과 겹치는 셀만 훑음
+		std::vector<uint32_t> found;
+		float radius2 = radius * radius;
+		for (uint32_t k = 0; k < (uint32_t)m_Seeds.size(); k++)
+		{
+			const glm::vec3& center = m_StartPositions[m_Seeds[k]];
+			m_Hash.ForEachInShell(center, m_QueriedRadius, radius, [&](uint32_t j)
+			{
+				if (m_IsKnown[j])
+					return;
+
+				glm::vec3 d = m_StartPositions[j] - center;
+				float distance2 = glm::dot(d, d);
+				if (distance2 > radius2)
+					return;
+
+				if (m_BestDistances[j] == FLT_MAX)
+					found.push_back(j);
+				if (distance2 < m_BestDistances[j])
+				{
+					m_BestDistances[j] = distance2;
+					m_BestSeeds[j] = k;
+				}
+			});
+		}
+
+		for (uint32_t j : found)
+		{
+			m_IsKnown[j] = 1;
+			m_Candidates.push_back(j);
+			m_CandidateDistances.push_back(std::sqrt(m_BestDistances[j]));
+			m_CandidateSeeds.push_back(m_BestSeeds[j]);
+		}
+		m_QueriedRadius = radius;
+	}
+
+	void ProportionalEdit::UpdateWeights()
+	{
+		// 부드러운 감쇠: f = 1 - d / r, w = f^2 (3 - 2f)
+		m_Vertices.clear();
+		m_Weights.clear();
+		m_NearestSeeds.clear();
+		if (m_Radius <= 0.0f)
+			return;
+
+		float inverseRadius = 1.0f / m_Radius;
+		for (size_t i = 0; i < m_Candidates.size(); i++)
+		{
+			float f = 1.0f - m_CandidateDistances[i] * inverseRadius;
+			if (f <= 0.0f)
+				continue;
+
+			m_Vertices.push_back(m_Candidates[i]);
+			m_Weights.push_back(f * f * (3.0f - 2.0f * f));
+			m_NearestSeeds.push_back(m_CandidateSeeds[i]);
+		}
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "SpatialHash.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 비례 편집: 이동 대상(씨앗) 주변 반경 이내 정점에 감쇠 가중치
+	// 드래그 시작 위치로 격자 해시를 한 번 만들고, 반경이 바뀌면 늘어난 껍질만 다시 조회
+	// (반경이 셀 크기의 2배를 넘으면 더 큰 셀로 해시를 다시 만듦)
+	class ProportionalEdit
+	{
+	public:
+		void Begin(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& seeds, float radius);
+		void End();
+
+		// 커지면 새 반경으로 해시 조회 (이미 찾은 정점은 건너뜀), 작아지면 찾아둔 목록만 거름
+		void SetRadius(float radius);
+		float GetRadius() const { return m_Radius; }
+
+		// 반경 안의 정점 (씨앗 제외). NearestSeeds는 Begin에 넘긴 seeds 안의 번호
+		const std::vector<uint32_t>& GetVertices() const { return m_Vertices; }
+		const std::vector<float>& GetWeights() const { return m_Weights; }
+		const std::vector<uint32_t>& GetNearestSeeds() const { return m_NearestSeeds; }
+
+	private:
+		void Query(float radius);
+		void UpdateWeights();
+
+	private:
+		std::vector<glm::vec3> m_StartPositions; // 드래그 중에는 정점이 움직이므로 시작 위치로 조회
+		std::vector<uint32_t> m_Seeds;
+		SpatialHash m_Hash;
+		float m_Radius = 0.0f;
+		float m_QueriedRadius = 0.0f;
+
+		// 지금까지 찾은 후보 (m_QueriedRadius 이내, 가장 가까운 씨앗까지 거리)
+		std::vector<uint32_t> m_Candidates;
+		std::vector<float> m_CandidateDistances;
+		std::vector<uint32_t> m_CandidateSeeds;
+		std::vector<uint8_t> m_IsKnown;        // 정점별: 씨앗이거나 이미 찾은 후보
+		std::vector<float> m_BestDistances;    // 조회 중 임시 (정점별)
+		std::vector<uint32_t> m_BestSeeds;
+
+		// 현재 반경 안
+		std::vector<uint32_t> m_Vertices;
+		std::vector<float> m_Weights;
+		std::vector<uint32_t> m_NearestSeeds;
+	};
+}
@@ -0,0 +1,49 @@
+#include "mxpch.h"
+#include "SpatialHash.h"
+
+namespace Mixer {
+
+	void SpatialHash::Build(const std::vector<glm::vec3>& points, float cellSize)
+	{
+		m_CellSize = cellSize > 0.0f ? cellSize : 1.0f;
+		m_InverseCellSize = 1.0f / m_CellSize;
+
+		// 버킷 수 = 점 수 이상의 2의 거듭제곱 (평균 버킷당 1개 이하)
+		uint32_t pointCount = (uint32_t)points.size();
+		uint32_t bucketCount = 1;
+		while (bucketCount < pointCount)
+			bucketCount <<= 1;
+		m_Mask = bucketCount - 1;
+
+		// 계수 정렬: 개수 -> 누적 -> 채우기
+		std::vector<uint64_t> cells(pointCount);
+		std::vector<uint32_t> buckets(pointCount);
+		m_BucketOffsets.assign(bucketCount + 1, 0);
+		for (uint32_t i = 0; i < pointCount; i++)
+		{
+			glm::ivec3 cell = CellOf(points[i]);
+			cells[i] = PackCell(cell.x, cell.y, cell.z);
+			buckets[i] = HashCell(cells[i]) & m_Mask;
+			m_BucketOffsets[buckets[i] + 1]++;
+		}
+		for (uint32_t b = 0; b < bucketCount; b++)
+			m_BucketOffsets[b + 1] += m_BucketOffsets[b];
+
+		m_Points.resize(pointCount);
+		m_PointCells.resize(pointCount);
+		std::vector<uint32_t> cursor(m_BucketOffsets.begin(), m_BucketOffsets.end() - 1);
+		for (uint32_t i = 0; i < pointCount; i++)
+		{
+			uint32_t slot = cursor[buckets[i]]++;
+			m_Points[slot] = i;
+			m_PointCells[slot] = cells[i];
+		}
+	}
+
+	void SpatialHash::Clear()
+	{
+		m_BucketOffsets.clear();
+		m_Points.clear();
+		m_PointCells.clear();
+	}
+}
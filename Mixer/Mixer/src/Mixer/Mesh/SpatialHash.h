@@ -0,0 +1,120 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace Mixer {
+
+	// 균일 격자 해시: 점 번호를 버킷별로 연속 저장 (CSR)
+	// 서로 다른 셀이 같은 버킷에 들어갈 수 있으므로 조회할 때 셀 번호를 다시 비교함
+	class SpatialHash
+	{
+	public:
+		void Build(const std::vector<glm::vec3>& points, float cellSize);
+		void Clear();
+
+		float GetCellSize() const { return m_CellSize; }
+		bool IsEmpty() const { return m_Points.empty(); }
+
+		// 박스 [min, max]와 겹치는 셀의 점마다 fn(point) (박스 밖 점도 올 수 있음 -> 거리 검사는 호출하는 쪽)
+		template<typename Fn>
+		void ForEachInBox(const glm::vec3& min, const glm::vec3& max, Fn&& fn) const
+		{
+			if (m_Points.empty())
+				return;
+
+			glm::ivec3 first = CellOf(min), last = CellOf(max);
+			for (int z = first.z; z <= last.z; z++)
+			{
+				for (int y = first.y; y <= last.y; y++)
+				{
+					for (int x = first.x; x <= last.x; x++)
+					{
+						uint64_t key = PackCell(x, y, z);
+						uint32_t bucket = HashCell(key) & m_Mask;
+						for (uint32_t i = m_BucketOffsets[bucket]; i < m_BucketOffsets[bucket + 1]; i++)
+						{
+							if (m_PointCells[i] == key)
+								fn(m_Points[i]);
+						}
+					}
+				}
+			}
+		}
+
+		// 중심에서 innerRadius 초과 outerRadius 이하인 껍질과 겹치는 셀의 점마다 fn(point)
+		// 통째로 innerRadius 안에 있는 셀과 outerRadius 밖에 있는 셀은 건너뜀 (점 거리 검사는 호출하는 쪽)
+		template<typename Fn>
+		void ForEachInShell(const glm::vec3& center, float innerRadius, float outerRadius, Fn&& fn) const
+		{
+			if (m_Points.empty())
+				return;
+
+			// 셀 경계 반올림 오차로 점이 옆 셀에 들어갈 수 있으므로 셀을 조금 넓게 봄
+			float slack = m_CellSize * 1e-3f;
+			float inner2 = innerRadius * innerRadius, outer2 = outerRadius * outerRadius;
+			glm::ivec3 first = CellOf(center - glm::vec3(outerRadius)), last = CellOf(center + glm::vec3(outerRadius));
+			for (int z = first.z; z <= last.z; z++)
+			{
+				glm::vec2 rz = CellDistance2(center.z, z, slack);
+				for (int y = first.y; y <= last.y; y++)
+				{
+					glm::vec2 ry = CellDistance2(center.y, y, slack);
+					if (rz.x + ry.x > outer2)
+						continue;
+					for (int x = first.x; x <= last.x; x++)
+					{
+						glm::vec2 rx = CellDistance2(center.x, x, slack);
+						if (rz.x + ry.x + rx.x > outer2 || rz.y + ry.y + rx.y <= inner2)
+							continue;
+
+						uint64_t key = PackCell(x, y, z);
+						uint32_t bucket = HashCell(key) & m_Mask;
+						for (uint32_t i = m_BucketOffsets[bucket]; i < m_BucketOffsets[bucket + 1]; i++)
+						{
+							if (m_PointCells[i] == key)
+								fn(m_Points[i]);
+						}
+					}
+				}
+			}
+		}
+
+	private:
+		// 한 축에서 좌표 c와 셀 cell 사이의 (가장 가까운 거리, 가장 먼 거리)의 제곱
+		glm::vec2 CellDistance2(float c, int cell, float slack) const
+		{
+			float low = cell * m_CellSize - slack, high = (cell + 1) * m_CellSize + slack;
+			float nearest = c < low ? low - c : (c > high ? c - high : 0.0f);
+			float farthest = std::max(std::abs(c - low), std::abs(high - c));
+			return { nearest * nearest, farthest * farthest };
+		}
+		glm::ivec3 CellOf(const glm::vec3& p) const
+		{
+			return glm::ivec3((int)std::floor(p.x * m_InverseCellSize), (int)std::floor(p.y * m_InverseCellSize), (int)std::floor(p.z * m_InverseCellSize));
+		}
+		static uint64_t PackCell(int x, int y, int z)
+		{
+			// 축마다 21비트 (셀 +-100만 개)
+			return ((uint64_t)(x & 0x1FFFFF) << 42) | ((uint64_t)(y & 0x1FFFFF) << 21) | (uint64_t)(z & 0x1FFFFF);
+		}
+		static uint32_t HashCell(uint64_t key)
+		{
+			key ^= key >> 33;
+			key *= 0xff51afd7ed558ccdULL;
+			key ^= key >> 33;
+			return (uint32_t)key;
+		}
+
+	private:
+		float m_CellSize = 1.0f;
+		float m_InverseCellSize = 1.0f;
+		uint32_t m_Mask = 0;
+		std::vector<uint32_t> m_BucketOffsets; // 버킷 수 + 1
+		std::vector<uint32_t> m_Points;        // 버킷 순서로 정렬한 점 번호
+		std::vector<uint64_t> m_PointCells;    // m_Points와 같은 순서의 셀 번호
+	};
+}
@@ -0,0 +1,395 @@
+#include "mxpch.h"
+#include "Subdivision.h"
+#include "Mixer/JobSystem.h"
+
+#include <cmath>
+
+namespace Mixer {
+
+	static constexpr uint32_t StencilJobGroupSize = 8192;
+
+	namespace {
+
+		// 한 정점의 Stencil을 모으는 작은 버퍼 (같은 원본 정점은 가중치 합산)
+		struct StencilBuilder
+		{
+			std::vector<std::pair<uint32_t, float>> Terms;
+
+			void Add(uint32_t source, float weight)
+			{
+				for (auto& term : Terms)
+				{
+					if (term.first == source)
+					{
+						term.second += weight;
+						return;
+					}
+				}
+				Terms.push_back({ source, weight });
+			}
+
+			void Flush(SubdivisionLevel& level)
+			{
+				for (const auto& term : Terms)
+				{
+					level.StencilSources.push_back(term.first);
+					level.StencilWeights.push_back(term.second);
+				}
+				level.StencilOffsets.push_back((uint32_t)level.StencilSources.size());
+				Terms.clear();
+			}
+		};
+
+		struct RefineEdge
+		{
+			uint32_t V0 = 0, V1 = 0;
+			uint32_t FaceCount = 0;
+			uint32_t Faces[2] = { 0, 0 };
+			uint32_t Opposite[2] = { 0, 0 }; // Loop: 각 삼각형에서 엣지 맞은편 정점
+		};
+
+		void BuildCSR(size_t count, const std::vector<std::pair<uint32_t, uint32_t>>& pairs,
+			std::vector<uint32_t>& offsets, std::vector<uint32_t>& values)
+		{
+			offsets.assign(count + 1, 0);
+			for (const auto& p : pairs)
+				offsets[p.first + 1]++;
+			for (size_t i = 0; i < count; i++)
+				offsets[i + 1] += offsets[i];
+
+			values.resize(pairs.size());
+			std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+			for (const auto& p : pairs)
+				values[fill[p.first]++] = p.second;
+		}
+	}
+
+	void SubdivisionSurface::SetCage(const std::vector<uint32_t>& indices, size_t vertexCount)
+	{
+		m_CageIndices = indices;
+		m_Levels.clear();
+		m_Positions.clear();
+
+		SubdivisionLevel cage;
+		cage.VertexCount = (uint32_t)vertexCount;
+		size_t faceCount = indices.size() / 3;
+		cage.FaceVertices.assign(indices.begin(), indices.begin() + faceCount * 3);
+		cage.FaceOffsets.resize(faceCount + 1);
+		for (size_t f = 0; f <= faceCount; f++)
+			cage.FaceOffsets[f] = (uint32_t)(f * 3);
+		cage.Triangles = cage.FaceVertices;
+
+		m_Levels.push_back(std::move(cage));
+		m_Positions.resize(1);
+		EnsureLevels();
+	}
+
+	void SubdivisionSurface::SetScheme(SubdivisionScheme scheme)
+	{
+		if (scheme == m_Scheme)
+			return;
+
+		// 규칙이 달라지면 1단계 이상의 표는 전부 무효 (케이지는 유지)
+		m_Scheme = scheme;
+		if (m_Levels.size() > 1)
+		{
+			m_Levels.resize(1);
+			m_Positions.resize(1);
+		}
+		EnsureLevels();
+	}
+
+	void SubdivisionSurface::SetLevel(uint32_t level)
+	{
+		m_Level = std::min(level, MaxLevel);
+		EnsureLevels();
+	}
+
+	void SubdivisionSurface::EnsureLevels()
+	{
+		if (m_Levels.empty())
+			return;
+
+		while (m_Levels.size() <= m_Level)
+		{
+			SubdivisionLevel fine;
+			Refine(m_Levels.back(), fine, m_Scheme);
+			m_Levels.push_back(std::move(fine));
+		}
+		m_Positions.resize(m_Levels.size());
+	}
+
+	void SubdivisionSurface::Evaluate(const std::vector<glm::vec3>& cage)
+	{
+		if (!IsValid(cage.size()))
+			return;
+
+		m_Positions[0] = cage;
+		for (uint32_t l = 1; l <= m_Level; l++)
+		{
+			const SubdivisionLevel& level = m_Levels[l];
+			const std::vector<glm::vec3>& src = m_Positions[l - 1];
+			std::vector<glm::vec3>& dst = m_Positions[l];
+			dst.resize(level.VertexCount);
+
+			JobContext context;
+			JobSystem::Dispatch(context, level.VertexCount, StencilJobGroupSize, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					glm::vec3 p(0.0f);
+					for (uint32_t k = level.StencilOffsets[i]; k < level.StencilOffsets[i + 1]; k++)
+						p += src[level.StencilSources[k]] * level.StencilWeights[k];
+					dst[i] = p;
+				}
+			});
+			JobSystem::Wait(context);
+		}
+	}
+
+	void SubdivisionSurface::Refine(const SubdivisionLevel& coarse, SubdivisionLevel& fine, SubdivisionScheme scheme)
+	{
+		uint32_t vertexCount = coarse.VertexCount;
+		uint32_t faceCount = (uint32_t)coarse.FaceOffsets.size() - 1;
+		uint32_t cornerCount = (uint32_t)coarse.FaceVertices.size();
+
+		// Loop는 삼각형 전용 -> 다각형이 섞이면 Catmull-Clark로 처리
+		if (scheme == SubdivisionScheme::Loop && cornerCount != faceCount * 3)
+			scheme = SubdivisionScheme::CatmullClark;
+
+		// 1. 코너 -> 면, 코너의 다음 코너
+		std::vector<uint32_t> cornerFace(cornerCount), cornerNext(cornerCount);
+		for (uint32_t f = 0; f < faceCount; f++)
+		{
+			uint32_t begin = coarse.FaceOffsets[f], end = coarse.FaceOffsets[f + 1];
+			for (uint32_t c = begin; c < end; c++)
+			{
+				cornerFace[c] = f;
+				cornerNext[c] = (c + 1 < end) ? c + 1 : begin;
+			}
+		}
+
+		// 2. 엣지 추출: (정렬 키, 코너) 쌍을 정렬해서 같은 엣지끼리 묶음
+		std::vector<std::pair<uint64_t, uint32_t>> cornerKeys(cornerCount);
+		for (uint32_t c = 0; c < cornerCount; c++)
+		{
+			uint32_t a = coarse.FaceVertices[c];
+			uint32_t b = coarse.FaceVertices[cornerNext[c]];
+			cornerKeys[c] = { ((uint64_t)std::min(a, b) << 32) | std::max(a, b), c };
+		}
+		std::sort(cornerKeys.begin(), cornerKeys.end());
+
+		std::vector<RefineEdge> edges;
+		std::vector<uint32_t> cornerEdge(cornerCount);
+		for (size_t i = 0; i < cornerKeys.size(); i++)
+		{
+			if (i == 0 || cornerKeys[i].first != cornerKeys[i - 1].first)
+			{
+				RefineEdge edge;
+				edge.V0 = (uint32_t)(cornerKeys[i].first >> 32);
+				edge.V1 = (uint32_t)(cornerKeys[i].first & 0xFFFFFFFF);
+				edges.push_back(edge);
+			}
+
+			uint32_t c = cornerKeys[i].second;
+			RefineEdge& edge = edges.back();
+			if (edge.FaceCount < 2)
+			{
+				edge.Faces[edge.FaceCount] = cornerFace[c];
+				edge.Opposite[edge.FaceCount] = coarse.FaceVertices[cornerNext[cornerNext[c]]];
+			}
+			edge.FaceCount++;
+			cornerEdge[c] = (uint32_t)edges.size() - 1;
+		}
+		uint32_t edgeCount = (uint32_t)edges.size();
+
+		// 3. 정점 -> 엣지, 정점 -> 면 인접
+		std::vector<std::pair<uint32_t, uint32_t>> pairs;
+		pairs.reserve(edgeCount * 2);
+		for (uint32_t e = 0; e < edgeCount; e++)
+		{
+			pairs.push_back({ edges[e].V0, e });
+			pairs.push_back({ edges[e].V1, e });
+		}
+		std::vector<uint32_t> vertexEdgeOffsets, vertexEdges;
+		BuildCSR(vertexCount, pairs, vertexEdgeOffsets, vertexEdges);
+
+		pairs.clear();
+		for (uint32_t c = 0; c < cornerCount; c++)
+			pairs.push_back({ coarse.FaceVertices[c], cornerFace[c] });
+		std::vector<uint32_t> vertexFaceOffsets, vertexFaces;
+		BuildCSR(vertexCount, pairs, vertexFaceOffsets, vertexFaces);
+
+		auto isSharp = [&](uint32_t e) { return edges[e].FaceCount != 2; }; // 경계 또는 비다양체
+		auto faceSize = [&](uint32_t f) { return coarse.FaceOffsets[f + 1] - coarse.FaceOffsets[f]; };
+
+		// 4. Stencil 표: [정점 점 V개][엣지 점 E개][면 점 F개 (Catmull-Clark만)]
+		bool catmullClark = scheme == SubdivisionScheme::CatmullClark;
+		fine.VertexCount = vertexCount + edgeCount + (catmullClark ? faceCount : 0);
+		fine.StencilOffsets.reserve(fine.VertexCount + 1);
+		fine.StencilOffsets.push_back(0);
+		StencilBuilder stencil;
+
+		// 4-1. 정점 점 (Vertex Point)
+		for (uint32_t v = 0; v < vertexCount; v++)
+		{
+			uint32_t edgeBegin = vertexEdgeOffsets[v], edgeEnd = vertexEdgeOffsets[v + 1];
+			uint32_t valence = edgeEnd - edgeBegin;
+
+			uint32_t sharpCount = 0;
+			uint32_t sharpNeighbors[2] = { 0, 0 };
+			for (uint32_t k = edgeBegin; k < edgeEnd; k++)
+			{
+				uint32_t e = vertexEdges[k];
+				if (!isSharp(e))
+					continue;
+				if (sharpCount < 2)
+					sharpNeighbors[sharpCount] = edges[e].V0 == v ? edges[e].V1 : edges[e].V0;
+				sharpCount++;
+			}
+
+			if (valence == 0 || (sharpCount > 0 && sharpCount != 2))
+			{
+				// 면에 속하지 않은 점, 모서리(Corner): 그대로 유지
+				stencil.Add(v, 1.0f);
+			}
+			else if (sharpCount == 2)
+			{
+				// 경계 곡선: B-spline 규칙
+				stencil.Add(v, 0.75f);
+				stencil.Add(sharpNeighbors[0], 0.125f);
+				stencil.Add(sharpNeighbors[1], 0.125f);
+			}
+			else if (catmullClark)
+			{
+				// (Q + 2R + (n - 3)P) / n
+				float n = (float)valence;
+				stencil.Add(v, (n - 3.0f) / n);
+				for (uint32_t k = edgeBegin; k < edgeEnd; k++)
+				{
+					const RefineEdge& edge = edges[vertexEdges[k]];
+					stencil.Add(edge.V0, 1.0f / (n * n));
+					stencil.Add(edge.V1, 1.0f / (n * n));
+				}
+
+				uint32_t faceBegin = vertexFaceOffsets[v], faceEnd = vertexFaceOffsets[v + 1];
+				float m = (float)(faceEnd - faceBegin);
+				for (uint32_t k = faceBegin; k < faceEnd; k++)
+				{
+					uint32_t f = vertexFaces[k];
+					float w = 1.0f / (n * m * (float)faceSize(f));
+					for (uint32_t c = coarse.FaceOffsets[f]; c < coarse.FaceOffsets[f + 1]; c++)
+						stencil.Add(coarse.FaceVertices[c], w);
+				}
+			}
+			else
+			{
+				// Loop: (1 - n*beta) P + beta * sum(이웃)
+				float n = (float)valence;
+				float c = 0.375f + 0.25f * std::cos(6.2831853f / n);
+				float beta = (0.625f - c * c) / n;
+				stencil.Add(v, 1.0f - n * beta);
+				for (uint32_t k = edgeBegin; k < edgeEnd; k++)
+				{
+					const RefineEdge& edge = edges[vertexEdges[k]];
+					stencil.Add(edge.V0 == v ? edge.V1 : edge.V0, beta);
+				}
+			}
+			stencil.Flush(fine);
+		}
+
+		// 4-2. 엣지 점 (Edge Point)
+		for (uint32_t e = 0; e < edgeCount; e++)
+		{
+			const RefineEdge& edge = edges[e];
+			if (isSharp(e))
+			{
+				stencil.Add(edge.V0, 0.5f);
+				stencil.Add(edge.V1, 0.5f);
+			}
+			else if (catmullClark)
+			{
+				stencil.Add(edge.V0, 0.25f);
+				stencil.Add(edge.V1, 0.25f);
+				for (int i = 0; i < 2; i++)
+				{
+					uint32_t f = edge.Faces[i];
+					float w = 0.25f / (float)faceSize(f);
+					for (uint32_t c = coarse.FaceOffsets[f]; c < coarse.FaceOffsets[f + 1]; c++)
+						stencil.Add(coarse.FaceVertices[c], w);
+				}
+			}
+			else
+			{
+				stencil.Add(edge.V0, 0.375f);
+				stencil.Add(edge.V1, 0.375f);
+				stencil.Add(edge.Opposite[0], 0.125f);
+				stencil.Add(edge.Opposite[1], 0.125f);
+			}
+			stencil.Flush(fine);
+		}
+
+		// 4-3. 면 점 (Face Point, Catmull-Clark)
+		if (catmullClark)
+		{
+			for (uint32_t f = 0; f < faceCount; f++)
+			{
+				float w = 1.0f / (float)faceSize(f);
+				for (uint32_t c = coarse.FaceOffsets[f]; c < coarse.FaceOffsets[f + 1]; c++)
+					stencil.Add(coarse.FaceVertices[c], w);
+				stencil.Flush(fine);
+			}
+		}
+
+		// 5. 세분화된 면 (감기 방향 유지)
+		fine.FaceOffsets.push_back(0);
+		auto pushFace = [&fine](std::initializer_list<uint32_t> face)
+		{
+			fine.FaceVertices.insert(fine.FaceVertices.end(), face);
+			fine.FaceOffsets.push_back((uint32_t)fine.FaceVertices.size());
+		};
+
+		for (uint32_t f = 0; f < faceCount; f++)
+		{
+			uint32_t begin = coarse.FaceOffsets[f], end = coarse.FaceOffsets[f + 1];
+			if (catmullClark)
+			{
+				// 코너마다 사각형 하나: (정점, 다음 엣지, 면 중심, 이전 엣지)
+				uint32_t facePoint = vertexCount + edgeCount + f;
+				for (uint32_t c = begin; c < end; c++)
+				{
+					uint32_t prevCorner = (c == begin) ? end - 1 : c - 1;
+					pushFace({ coarse.FaceVertices[c], vertexCount + cornerEdge[c], facePoint, vertexCount + cornerEdge[prevCorner] });
+				}
+			}
+			else
+			{
+				uint32_t v0 = coarse.FaceVertices[begin], v1 = coarse.FaceVertices[begin + 1], v2 = coarse.FaceVertices[begin + 2];
+				uint32_t e0 = vertexCount + cornerEdge[begin];
+				uint32_t e1 = vertexCount + cornerEdge[begin + 1];
+				uint32_t e2 = vertexCount + cornerEdge[begin + 2];
+				pushFace({ v0, e0, e2 });
+				pushFace({ v1, e1, e0 });
+				pushFace({ v2, e2, e1 });
+				pushFace({ e0, e1, e2 });
+			}
+		}
+
+		BuildTriangles(fine);
+	}
+
+	void SubdivisionSurface::BuildTriangles(SubdivisionLevel& level)
+	{
+		level.Triangles.clear();
+		for (size_t f = 0; f + 1 < level.FaceOffsets.size(); f++)
+		{
+			uint32_t begin = level.FaceOffsets[f], end = level.FaceOffsets[f + 1];
+			for (uint32_t c = begin + 1; c + 1 < end; c++)
+			{
+				level.Triangles.push_back(level.FaceVertices[begin]);
+				level.Triangles.push_back(level.FaceVertices[c]);
+				level.Triangles.push_back(level.FaceVertices[c + 1]);
+			}
+		}
+	}
+}
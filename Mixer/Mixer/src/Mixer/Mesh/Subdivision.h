@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	enum class SubdivisionScheme
+	{
+		CatmullClark, // 임의 다각형 -> 사각형
+		Loop          // 삼각형 -> 삼각형
+	};
+
+	// 세분화 한 단계의 토폴로지 + 이전 단계에서 이 단계로 가는 Stencil 표
+	// 새 정점 i = sum(StencilWeights[k] * 이전 정점[StencilSources[k]]), k in [StencilOffsets[i], StencilOffsets[i+1])
+	struct SubdivisionLevel
+	{
+		uint32_t VertexCount = 0;
+		std::vector<uint32_t> FaceOffsets;  // 다각형 CSR (면 개수 + 1)
+		std::vector<uint32_t> FaceVertices;
+		std::vector<uint32_t> Triangles;    // GPU 업로드용 (다각형 부채꼴 분할)
+
+		std::vector<uint32_t> StencilOffsets;
+		std::vector<uint32_t> StencilSources;
+		std::vector<float> StencilWeights;
+	};
+
+	// 세분화 곡면: 토폴로지가 바뀔 때만 Stencil 표를 만들고,
+	// 정점이 움직이면 표를 곱하기만 함 (단계별 희소 행렬-벡터 곱, 병렬)
+	class SubdivisionSurface
+	{
+	public:
+		static constexpr uint32_t MaxLevel = 4;
+
+		// 케이지(원본 삼각형 메쉬)의 토폴로지 지정 -> 기존 표 전부 폐기
+		void SetCage(const std::vector<uint32_t>& indices, size_t vertexCount);
+		void SetScheme(SubdivisionScheme scheme);
+		// 단계를 바꿔도 이미 만든 단계의 표는 재사용 (필요한 단계만 추가 생성)
+		void SetLevel(uint32_t level);
+
+		// 케이지 정점 위치로 현재 단계까지 계산
+		void Evaluate(const std::vector<glm::vec3>& cage);
+
+		bool IsValid(size_t cageVertexCount) const { return !m_Levels.empty() && m_Levels[0].VertexCount == cageVertexCount; }
+		uint32_t GetLevel() const { return m_Level; }
+		SubdivisionScheme GetScheme() const { return m_Scheme; }
+
+		const std::vector<glm::vec3>& GetPositions() const { return m_Positions[m_Level]; }
+		const std::vector<uint32_t>& GetTriangles() const { return m_Levels[m_Level].Triangles; }
+
+	private:
+		void EnsureLevels();
+		static void Refine(const SubdivisionLevel& coarse, SubdivisionLevel& fine, SubdivisionScheme scheme);
+		static void BuildTriangles(SubdivisionLevel& level);
+
+	private:
+		SubdivisionScheme m_Scheme = SubdivisionScheme::CatmullClark;
+		uint32_t m_Level = 0;
+		std::vector<uint32_t> m_CageIndices;
+		std::vector<SubdivisionLevel> m_Levels;           // [0] = 케이지
+		std::vector<std::vector<glm::vec3>> m_Positions;  // 단계별 정점 위치
+	};
+}
@@ -0,0 +1,95 @@
+#include "mxpch.h"
+#include "SymmetryMap.h"
+#include "SpatialHash.h"
+#include "Mixer/JobSystem.h"
+
+namespace Mixer {
+
+	static constexpr uint32_t SymmetryJobGroupSize = 4096;
+
+	void SymmetryMap::Build(const std::vector<glm::vec3>& vertices, int axis, float tolerance)
+	{
+		uint32_t vertexCount = (uint32_t)vertices.size();
+		float maxDistance2 = tolerance * tolerance;
+		auto mirrorDistance2 = [&](uint32_t i, uint32_t j)
+		{
+			glm::vec3 q = vertices[i];
+			q[axis] = -q[axis];
+			glm::vec3 d = vertices[j] - q;
+			return glm::dot(d, d);
+		};
+
+		// 0. 같은 축이면 아직 대칭 위치에 있는 기존 짝 유지 (Extrude 직후 겹친 복사본이 원본의 짝을 가져가지 않게)
+		std::vector<uint32_t> kept(vertexCount, None);
+		if (axis == m_Axis)
+		{
+			uint32_t oldCount = std::min((uint32_t)m_Mirrors.size(), vertexCount);
+			for (uint32_t i = 0; i < oldCount; i++)
+			{
+				uint32_t j = m_Mirrors[i];
+				if (j < oldCount && m_Mirrors[j] == i && mirrorDistance2(i, j) <= maxDistance2)
+					kept[i] = j;
+			}
+		}
+		m_Axis = axis;
+		m_PairedCount = 0;
+
+		// 셀 크기 = 조회 박스 폭 (허용 오차 x 2) -> 축마다 셀 2개 이내, 최대 8셀만 확인
+		SpatialHash hash;
+		hash.Build(vertices, tolerance * 2.0f);
+
+		// 1. 짝이 없는 정점끼리 반사 위치에서 가장 가까운 정점 (읽기만 하므로 병렬)
+		std::vector<uint32_t> nearest(vertexCount, None);
+		JobContext context;
+		JobSystem::Dispatch(context, vertexCount, SymmetryJobGroupSize, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				if (kept[i] != None)
+					continue;
+
+				glm::vec3 q = vertices[i];
+				q[axis] = -q[axis];
+
+				float best = maxDistance2;
+				hash.ForEachInBox(q - glm::vec3(tolerance), q + glm::vec3(tolerance), [&](uint32_t j)
+				{
+					if (kept[j] != None)
+						return;
+					glm::vec3 d = vertices[j] - q;
+					float distance2 = glm::dot(d, d);
+					// 같은 거리면 번호가 작은 쪽 (해시 순회 순서와 무관)
+					if (distance2 < best || (distance2 == best && j < nearest[i]))
+					{
+						best = distance2;
+						nearest[i] = j;
+					}
+				});
+			}
+		});
+		JobSystem::Wait(context);
+
+		// 2. 서로 가장 가까운 경우만 짝 (한 정점이 두 정점의 짝이 되지 않게)
+		m_Mirrors.assign(vertexCount, None);
+		for (uint32_t i = 0; i < vertexCount; i++)
+		{
+			uint32_t j = kept[i] != None ? kept[i] : nearest[i];
+			if (j != None && (kept[i] != None || nearest[j] == i))
+			{
+				m_Mirrors[i] = j;
+				m_PairedCount++;
+			}
+		}
+	}
+
+	void SymmetryMap::AddPair(uint32_t a, uint32_t b)
+	{
+		uint32_t size = std::max(a, b) + 1;
+		if (m_Mirrors.size() < size)
+			m_Mirrors.resize(size, None);
+
+		m_PairedCount += (m_Mirrors[a] == None) + (a != b && m_Mirrors[b] == None);
+		m_Mirrors[a] = b;
+		m_Mirrors[b] = a;
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 정점 -> 축 평면(원점 기준) 반대편 정점 표
+	// 드래그 시작 전에 한 번 만들어 두고, 드래그 중에는 표만 읽음
+	class SymmetryMap
+	{
+	public:
+		static constexpr uint32_t None = ~0u;
+
+		// 반사한 위치에서 tolerance 이내의 가장 가까운 정점과 짝 (서로 짝인 경우만 인정)
+		// 평면 위 정점은 자기 자신이 짝. 같은 축으로 다시 만들면 아직 맞는 기존 짝은 그대로 두고 나머지만 찾음
+		// (같은 자리에 겹친 정점이 있어도 짝이 바뀌지 않게). 거리가 같으면 번호가 작은 정점
+		void Build(const std::vector<glm::vec3>& vertices, int axis, float tolerance);
+
+		// 위치로는 못 가리는 짝을 직접 등록 (대칭 Extrude: 원본과 같은 자리에 생긴 복사본끼리)
+		void AddPair(uint32_t a, uint32_t b);
+
+		uint32_t GetMirror(uint32_t vertex) const { return vertex < m_Mirrors.size() ? m_Mirrors[vertex] : None; }
+		int GetAxis() const { return m_Axis; }
+		size_t GetPairedCount() const { return m_PairedCount; }
+
+	private:
+		std::vector<uint32_t> m_Mirrors;
+		int m_Axis = 0;
+		size_t m_PairedCount = 0;
+	};
+}
@@ -0,0 +1,681 @@
+#include "mxpch.h"
+#include "Triangulator.h"
+#include "Mixer/JobSystem.h"
+
+#include <set>
+#include <numeric>
+#include <cmath>
+#include <cfloat>
+
+namespace Mixer {
+
+	namespace {
+
+		// > 0 : a -> b -> c 가 반시계(CCW)
+		float Orient(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c)
+		{
+			return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+		}
+
+		// 스윕 순서: y가 크면 위, 같으면 x가 작은 쪽이 위
+		bool Above(const glm::vec2& a, const glm::vec2& b)
+		{
+			return a.y > b.y || (a.y == b.y && a.x < b.x);
+		}
+
+		bool PointInTriangle(const glm::vec2& p, const glm::vec2& a, const glm::vec2& b, const glm::vec2& c)
+		{
+			return Orient(a, b, p) >= 0.0f && Orient(b, c, p) >= 0.0f && Orient(c, a, p) >= 0.0f;
+		}
+
+		enum class SweepVertexType : uint8_t { Start, End, Split, Merge, Regular };
+
+		// 스윕 라인 상태(Status): 현재 스윕 높이에서 엣지의 x 좌표로 정렬
+		// 키 -1은 검색용 가상 엣지 (x = QueryX)
+		struct SweepState
+		{
+			const std::vector<glm::vec2>* Points = nullptr;
+			float SweepY = 0.0f;
+			float QueryX = 0.0f;
+
+			float EdgeX(int32_t edge) const
+			{
+				if (edge < 0)
+					return QueryX;
+
+				const std::vector<glm::vec2>& points = *Points;
+				const glm::vec2& a = points[edge];
+				const glm::vec2& b = points[(edge + 1) % points.size()];
+				if (a.y == b.y)
+					return std::min(a.x, b.x);
+
+				float t = (SweepY - a.y) / (b.y - a.y);
+				return a.x + t * (b.x - a.x);
+			}
+
+			float EdgeMidX(int32_t edge) const
+			{
+				const std::vector<glm::vec2>& points = *Points;
+				return 0.5f * (points[edge].x + points[(edge + 1) % points.size()].x);
+			}
+		};
+
+		struct EdgeCompare
+		{
+			const SweepState* State;
+
+			bool operator()(int32_t a, int32_t b) const
+			{
+				float xa = State->EdgeX(a);
+				float xb = State->EdgeX(b);
+				if (xa != xb)
+					return xa < xb;
+
+				// 같은 x: 검색 키는 항상 오른쪽 (같은 위치의 엣지를 "왼쪽 엣지"로 취급)
+				if (a < 0 || b < 0)
+					return b < 0 && a >= 0;
+
+				float ma = State->EdgeMidX(a);
+				float mb = State->EdgeMidX(b);
+				if (ma != mb)
+					return ma < mb;
+				return a < b;
+			}
+		};
+
+		void EmitTriangle(const std::vector<glm::vec2>& points, uint32_t a, uint32_t b, uint32_t c, std::vector<uint32_t>& out)
+		{
+			// 입력 다각형이 CCW이므로 삼각형도 CCW로 맞춤
+			if (Orient(points[a], points[b], points[c]) < 0.0f)
+				std::swap(b, c);
+
+			out.push_back(a);
+			out.push_back(b);
+			out.push_back(c);
+		}
+
+		// y-monotone 다각형(CCW 순서) 삼각분할 - 스택 알고리즘 O(n log n)
+		void TriangulateMonotonePiece(const std::vector<glm::vec2>& points, const std::vector<uint32_t>& face, std::vector<uint32_t>& out)
+		{
+			size_t m = face.size();
+			if (m < 3)
+				return;
+			if (m == 3)
+			{
+				EmitTriangle(points, face[0], face[1], face[2], out);
+				return;
+			}
+
+			size_t top = 0, bottom = 0;
+			for (size_t i = 1; i < m; i++)
+			{
+				if (Above(points[face[i]], points[face[top]])) top = i;
+				if (Above(points[face[bottom]], points[face[i]])) bottom = i;
+			}
+
+			// CCW 순서로 위 -> 아래로 내려가는 쪽이 왼쪽 체인
+			std::unordered_map<uint32_t, bool> isLeft;
+			for (size_t i = top; i != bottom; i = (i + 1) % m)
+				isLeft[face[i]] = true;
+			for (size_t i = bottom; i != top; i = (i + 1) % m)
+				isLeft[face[i]] = false;
+
+			std::vector<uint32_t> sorted(face);
+			std::sort(sorted.begin(), sorted.end(), [&](uint32_t a, uint32_t b) { return Above(points[a], points[b]); });
+
+			std::vector<uint32_t> stack;
+			stack.push_back(sorted[0]);
+			stack.push_back(sorted[1]);
+
+			for (size_t j = 2; j < m - 1; j++)
+			{
+				uint32_t u = sorted[j];
+				if (isLeft[u] != isLeft[stack.back()])
+				{
+					// 반대쪽 체인: 스택의 모든 점과 연결
+					while (stack.size() > 1)
+					{
+						uint32_t v = stack.back();
+						stack.pop_back();
+						EmitTriangle(points, u, v, stack.back(), out);
+					}
+					stack.clear();
+					stack.push_back(sorted[j - 1]);
+					stack.push_back(u);
+				}
+				else
+				{
+					// 같은 체인: 대각선이 다각형 내부에 있는 동안 계속 자름
+					uint32_t last = stack.back();
+					stack.pop_back();
+					while (!stack.empty())
+					{
+						uint32_t candidate = stack.back();
+						bool inside = isLeft[u]
+							? Orient(points[candidate], points[last], points[u]) > 0.0f
+							: Orient(points[u], points[last], points[candidate]) > 0.0f;
+						if (!inside)
+							break;
+
+						EmitTriangle(points, candidate, last, u, out);
+						last = candidate;
+						stack.pop_back();
+					}
+					stack.push_back(last);
+					stack.push_back(u);
+				}
+			}
+
+			uint32_t lowest = sorted[m - 1];
+			while (stack.size() > 1)
+			{
+				uint32_t v = stack.back();
+				stack.pop_back();
+				EmitTriangle(points, lowest, v, stack.back(), out);
+			}
+		}
+	}
+
+	bool Triangulator::Triangulate(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& polygon, std::vector<uint32_t>& outIndices)
+	{
+		size_t n = polygon.size();
+		if (n < 3)
+			return false;
+
+		if (n == 3)
+		{
+			outIndices.insert(outIndices.end(), polygon.begin(), polygon.end());
+			return true;
+		}
+
+		// 1. 최적 평면 (Newell 법선): 비평면 다각형에서도 안정적
+		glm::vec3 normal(0.0f);
+		glm::vec3 centroid(0.0f);
+		for (size_t i = 0; i < n; i++)
+		{
+			const glm::vec3& a = vertices[polygon[i]];
+			const glm::vec3& b = vertices[polygon[(i + 1) % n]];
+			normal.x += (a.y - b.y) * (a.z + b.z);
+			normal.y += (a.z - b.z) * (a.x + b.x);
+			normal.z += (a.x - b.x) * (a.y + b.y);
+			centroid += a;
+		}
+		centroid /= (float)n;
+
+		// 선택 순서가 꼬여서 Newell 법선이 0에 가까우면, 중심에서 본 가장 큰 외적을 사용
+		if (glm::length(normal) < 1e-12f)
+		{
+			glm::vec3 first = vertices[polygon[0]] - centroid;
+			for (size_t i = 1; i < n; i++)
+			{
+				glm::vec3 c = glm::cross(first, vertices[polygon[i]] - centroid);
+				if (glm::length(c) > glm::length(normal))
+					normal = c;
+			}
+			if (glm::length(normal) < 1e-12f)
+				return false; // 모든 점이 한 직선 위
+		}
+		normal = glm::normalize(normal);
+
+		// 2. 평면 좌표계 (u, v, normal 오른손 좌표계 -> 입력 순서가 2D에서 CCW가 됨)
+		glm::vec3 axis = std::fabs(normal.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+		glm::vec3 u = glm::normalize(glm::cross(axis, normal));
+		glm::vec3 v = glm::cross(normal, u);
+
+		std::vector<glm::vec2> points(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			glm::vec3 d = vertices[polygon[i]] - centroid;
+			points[i] = { glm::dot(d, u), glm::dot(d, v) };
+		}
+
+		// 3. 삼각분할 (로컬 인덱스)
+		std::vector<uint32_t> local;
+		local.reserve((n - 2) * 3);
+		if (n <= MonotoneThreshold || !MonotoneTriangulate(points, local))
+		{
+			local.clear();
+			EarClip(points, local);
+		}
+
+		for (uint32_t index : local)
+			outIndices.push_back(polygon[index]);
+		return true;
+	}
+
+	void Triangulator::EarClip(const std::vector<glm::vec2>& points, std::vector<uint32_t>& outTriangles)
+	{
+		uint32_t n = (uint32_t)points.size();
+		std::vector<uint32_t> prev(n), next(n);
+		for (uint32_t i = 0; i < n; i++)
+		{
+			prev[i] = (i + n - 1) % n;
+			next[i] = (i + 1) % n;
+		}
+
+		auto isEar = [&](uint32_t i)
+		{
+			const glm::vec2& a = points[prev[i]];
+			const glm::vec2& b = points[i];
+			const glm::vec2& c = points[next[i]];
+			if (Orient(a, b, c) <= 0.0f)
+				return false;
+
+			// 귀 안에 들어올 수 있는 건 오목(Reflex) 정점뿐
+			for (uint32_t j = next[next[i]]; j != prev[i]; j = next[j])
+			{
+				if (Orient(points[prev[j]], points[j], points[next[j]]) > 0.0f)
+					continue;
+				if (PointInTriangle(points[j], a, b, c))
+					return false;
+			}
+			return true;
+		};
+
+		auto clip = [&](uint32_t i)
+		{
+			outTriangles.push_back(prev[i]);
+			outTriangles.push_back(i);
+			outTriangles.push_back(next[i]);
+			next[prev[i]] = next[i];
+			prev[next[i]] = prev[i];
+		};
+
+		uint32_t remaining = n;
+		uint32_t current = 0;
+		uint32_t misses = 0;
+		while (remaining > 3)
+		{
+			if (isEar(current))
+			{
+				uint32_t following = next[current];
+				clip(current);
+				current = following;
+				remaining--;
+				misses = 0;
+				continue;
+			}
+
+			current = next[current];
+			if (++misses < remaining)
+				continue;
+
+			// 귀를 못 찾음 (자기 교차/퇴화 입력): 가장 볼록한 정점을 강제로 자름
+			uint32_t best = current;
+			float bestArea = -FLT_MAX;
+			uint32_t i = current;
+			do
+			{
+				float area = Orient(points[prev[i]], points[i], points[next[i]]);
+				if (area > bestArea)
+				{
+					bestArea = area;
+					best = i;
+				}
+				i = next[i];
+			} while (i != current);
+
+			current = next[best];
+			clip(best);
+			remaining--;
+			misses = 0;
+		}
+
+		outTriangles.push_back(prev[current]);
+		outTriangles.push_back(current);
+		outTriangles.push_back(next[current]);
+	}
+
+	bool Triangulator::MonotoneTriangulate(const std::vector<glm::vec2>& points, std::vector<uint32_t>& outTriangles)
+	{
+		uint32_t n = (uint32_t)points.size();
+		auto prevOf = [n](uint32_t i) { return (i + n - 1) % n; };
+		auto nextOf = [n](uint32_t i) { return (i + 1) % n; };
+
+		// 1. 정점 분류 (Start / End / Split / Merge / Regular)
+		std::vector<SweepVertexType> type(n);
+		for (uint32_t i = 0; i < n; i++)
+		{
+			const glm::vec2& p = points[prevOf(i)];
+			const glm::vec2& c = points[i];
+			const glm::vec2& q = points[nextOf(i)];
+			bool convex = Orient(p, c, q) > 0.0f;
+
+			if (Above(c, p) && Above(c, q))
+				type[i] = convex ? SweepVertexType::Start : SweepVertexType::Split;
+			else if (Above(p, c) && Above(q, c))
+				type[i] = convex ? SweepVertexType::End : SweepVertexType::Merge;
+			else
+				type[i] = SweepVertexType::Regular;
+		}
+
+		std::vector<uint32_t> order(n);
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return Above(points[a], points[b]); });
+
+		// 2. 스윕: Monotone 조각으로 나누는 대각선 수집 (엣지 i = i -> i+1)
+		SweepState state;
+		state.Points = &points;
+		std::set<int32_t, EdgeCompare> status(EdgeCompare{ &state });
+		std::vector<std::set<int32_t, EdgeCompare>::iterator> statusIter(n);
+		std::vector<bool> inStatus(n, false);
+		std::vector<uint32_t> helper(n, 0);
+		std::vector<std::pair<uint32_t, uint32_t>> diagonals;
+
+		auto insertEdge = [&](uint32_t edge, uint32_t helperVertex)
+		{
+			statusIter[edge] = status.insert((int32_t)edge).first;
+			inStatus[edge] = true;
+			helper[edge] = helperVertex;
+		};
+		auto removeEdge = [&](uint32_t edge)
+		{
+			status.erase(statusIter[edge]);
+			inStatus[edge] = false;
+		};
+		auto findLeftEdge = [&](uint32_t v) -> int32_t
+		{
+			state.QueryX = points[v].x;
+			auto it = status.upper_bound(-1);
+			if (it == status.begin())
+				return -1;
+			return *(--it);
+		};
+		auto connectIfMerge = [&](uint32_t v, uint32_t edge)
+		{
+			if (type[helper[edge]] == SweepVertexType::Merge)
+				diagonals.push_back({ v, helper[edge] });
+		};
+
+		for (uint32_t v : order)
+		{
+			state.SweepY = points[v].y;
+			uint32_t prevEdge = prevOf(v);
+
+			switch (type[v])
+			{
+			case SweepVertexType::Start:
+				insertEdge(v, v);
+				break;
+
+			case SweepVertexType::End:
+				if (!inStatus[prevEdge]) return false;
+				connectIfMerge(v, prevEdge);
+				removeEdge(prevEdge);
+				break;
+
+			case SweepVertexType::Split:
+			{
+				int32_t left = findLeftEdge(v);
+				if (left < 0) return false;
+				diagonals.push_back({ v, helper[left] });
+				helper[left] = v;
+				insertEdge(v, v);
+				break;
+			}
+
+			case SweepVertexType::Merge:
+			{
+				if (!inStatus[prevEdge]) return false;
+				connectIfMerge(v, prevEdge);
+				removeEdge(prevEdge);
+
+				int32_t left = findLeftEdge(v);
+				if (left < 0) return false;
+				connectIfMerge(v, left);
+				helper[left] = v;
+				break;
+			}
+
+			case SweepVertexType::Regular:
+				// 위에서 내려오는 정점이면 다각형 내부가 오른쪽 (왼쪽 체인)
+				if (Above(points[prevOf(v)], points[v]))
+				{
+					if (!inStatus[prevEdge]) return false;
+					connectIfMerge(v, prevEdge);
+					removeEdge(prevEdge);
+					insertEdge(v, v);
+				}
+				else
+				{
+					int32_t left = findLeftEdge(v);
+					if (left < 0) return false;
+					connectIfMerge(v, left);
+					helper[left] = v;
+				}
+				break;
+			}
+		}
+
+		// 3. 대각선으로 나뉜 면(Face) 추적
+		// 각 정점의 이웃을 각도순으로 정렬하고, 들어온 엣지의 바로 시계방향 엣지로 나가면 왼쪽 면을 한 바퀴 돈다
+		std::vector<std::vector<uint32_t>> neighbors(n);
+		for (uint32_t i = 0; i < n; i++)
+		{
+			neighbors[i].push_back(prevOf(i));
+			neighbors[i].push_back(nextOf(i));
+		}
+		for (const auto& d : diagonals)
+		{
+			neighbors[d.first].push_back(d.second);
+			neighbors[d.second].push_back(d.first);
+		}
+
+		std::vector<std::vector<bool>> visited(n);
+		for (uint32_t i = 0; i < n; i++)
+		{
+			const glm::vec2 center = points[i];
+			std::sort(neighbors[i].begin(), neighbors[i].end(), [&](uint32_t a, uint32_t b)
+			{
+				return std::atan2(points[a].y - center.y, points[a].x - center.x) < std::atan2(points[b].y - center.y, points[b].x - center.x);
+			});
+			visited[i].assign(neighbors[i].size(), false);
+
+			// 바깥쪽 반엣지(i -> prev)는 다각형 외부를 도므로 미리 제외
+			for (size_t k = 0; k < neighbors[i].size(); k++)
+			{
+				if (neighbors[i][k] == prevOf(i) && n > 2)
+				{
+					visited[i][k] = true;
+					break;
+				}
+			}
+		}
+
+		auto slotOf = [&](uint32_t from, uint32_t to) -> size_t
+		{
+			const std::vector<uint32_t>& list = neighbors[from];
+			return (size_t)(std::find(list.begin(), list.end(), to) - list.begin());
+		};
+
+		size_t maxSteps = n + diagonals.size() * 2 + 1;
+		std::vector<uint32_t> face;
+		for (uint32_t start = 0; start < n; start++)
+		{
+			for (size_t k = 0; k < neighbors[start].size(); k++)
+			{
+				if (visited[start][k])
+					continue;
+
+				face.clear();
+				uint32_t from = start;
+				size_t slot = k;
+				while (!visited[from][slot])
+				{
+					if (face.size() > maxSteps)
+						return false;
+
+					visited[from][slot] = true;
+					face.push_back(from);
+
+					uint32_t to = neighbors[from][slot];
+					const std::vector<uint32_t>& around = neighbors[to];
+					size_t back = slotOf(to, from);
+					if (back == around.size())
+						return false;
+
+					from = to;
+					slot = (back + around.size() - 1) % around.size();
+				}
+
+				TriangulateMonotonePiece(points, face, outTriangles);
+			}
+		}
+
+		// 삼각형 수가 n - 2가 아니면 퇴화 입력 -> 호출 측에서 Ear Clipping으로 대체
+		return outTriangles.size() == (size_t)(n - 2) * 3;
+	}
+
+	std::vector<std::vector<uint32_t>> Triangulator::BuildLoops(const std::vector<int>& selection,
+		const std::vector<uint32_t>& indices,
+		const std::vector<uint32_t>& edgeIndices,
+		size_t vertexCount)
+	{
+		std::vector<std::vector<uint32_t>> loops;
+
+		std::vector<int32_t> localIndex(vertexCount, -1);
+		std::vector<uint32_t> selected;
+		for (int index : selection)
+		{
+			if (localIndex[index] != -1)
+				continue;
+			localIndex[index] = (int32_t)selected.size();
+			selected.push_back((uint32_t)index);
+		}
+		size_t m = selected.size();
+
+		// 1. 선택된 두 점을 잇는 경계 엣지 수집 (삼각형 하나에만 속한 엣지 + 고립된 선)
+		struct BoundaryEdge
+		{
+			uint32_t From = 0, To = 0; // 삼각형 안에서의 방향
+			int TriangleCount = 0;
+			bool IsLine = false;
+		};
+		std::unordered_map<uint64_t, BoundaryEdge> edges;
+		auto key = [](uint32_t a, uint32_t b) { return ((uint64_t)std::min(a, b) << 32) | std::max(a, b); };
+
+		for (size_t t = 0; t + 2 < indices.size(); t += 3)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				uint32_t a = indices[t + j];
+				uint32_t b = indices[t + (j + 1) % 3];
+				if (localIndex[a] == -1 || localIndex[b] == -1)
+					continue;
+
+				BoundaryEdge& edge = edges[key(a, b)];
+				if (edge.TriangleCount++ == 0)
+				{
+					edge.From = a;
+					edge.To = b;
+				}
+			}
+		}
+		for (size_t i = 0; i + 1 < edgeIndices.size(); i += 2)
+		{
+			uint32_t a = edgeIndices[i];
+			uint32_t b = edgeIndices[i + 1];
+			if (localIndex[a] == -1 || localIndex[b] == -1 || a == b)
+				continue;
+			edges[key(a, b)].IsLine = true;
+		}
+
+		std::vector<std::vector<uint32_t>> adjacency(m);
+		for (const auto& pair : edges)
+		{
+			const BoundaryEdge& edge = pair.second;
+			if (edge.TriangleCount == 1 || (edge.TriangleCount == 0 && edge.IsLine))
+			{
+				uint32_t a = (uint32_t)(pair.first >> 32);
+				uint32_t b = (uint32_t)(pair.first & 0xFFFFFFFF);
+				adjacency[localIndex[a]].push_back(localIndex[b]);
+				adjacency[localIndex[b]].push_back(localIndex[a]);
+			}
+		}
+
+		// 2. 연결 요소마다: 닫힌 고리(모든 차수 2)면 경계를 따라 정렬, 아니면 선택 순서 유지
+		std::vector<bool> visited(m, false);
+		std::vector<bool> leftover(m, false);
+		std::vector<uint32_t> component;
+		for (uint32_t start = 0; start < m; start++)
+		{
+			if (visited[start])
+				continue;
+
+			component.clear();
+			component.push_back(start);
+			visited[start] = true;
+			bool isCycle = true;
+			for (size_t i = 0; i < component.size(); i++)
+			{
+				uint32_t v = component[i];
+				if (adjacency[v].size() != 2)
+					isCycle = false;
+				for (uint32_t w : adjacency[v])
+				{
+					if (!visited[w])
+					{
+						visited[w] = true;
+						component.push_back(w);
+					}
+				}
+			}
+
+			if (!isCycle || component.size() < 3)
+			{
+				for (uint32_t v : component)
+					leftover[v] = true;
+				continue;
+			}
+
+			// 기존 삼각형과 같은 방향으로 엣지를 지나면 뚜껑 면이 뒤집히므로 반대 방향으로 돈다
+			uint32_t first = adjacency[start][0];
+			auto it = edges.find(key(selected[start], selected[first]));
+			if (it != edges.end() && it->second.TriangleCount == 1 && it->second.From == selected[start])
+				first = adjacency[start][1];
+
+			std::vector<uint32_t> loop;
+			loop.reserve(component.size());
+			uint32_t previous = start;
+			uint32_t current = first;
+			loop.push_back(selected[start]);
+			while (current != start)
+			{
+				loop.push_back(selected[current]);
+				uint32_t following = adjacency[current][0] == previous ? adjacency[current][1] : adjacency[current][0];
+				previous = current;
+				current = following;
+			}
+			loops.push_back(std::move(loop));
+		}
+
+		std::vector<uint32_t> ordered;
+		for (uint32_t i = 0; i < m; i++)
+		{
+			if (leftover[i])
+				ordered.push_back(selected[i]);
+		}
+		if (ordered.size() >= 3)
+			loops.push_back(std::move(ordered));
+
+		return loops;
+	}
+
+	void Triangulator::TriangulateLoops(const std::vector<glm::vec3>& vertices,
+		const std::vector<std::vector<uint32_t>>& loops,
+		std::vector<uint32_t>& outIndices)
+	{
+		std::vector<std::vector<uint32_t>> results(loops.size());
+
+		JobContext context;
+		JobSystem::Dispatch(context, (uint32_t)loops.size(), 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				Triangulate(vertices, loops[i], results[i]);
+		});
+		JobSystem::Wait(context);
+
+		for (const std::vector<uint32_t>& triangles : results)
+			outIndices.insert(outIndices.end(), triangles.begin(), triangles.end());
+	}
+}
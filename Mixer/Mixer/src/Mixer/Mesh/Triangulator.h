@@ -0,0 +1,35 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	class Triangulator
+	{
+	public:
+		// 이보다 큰 다각형은 Ear Clipping(O(n^2)) 대신 Monotone 분할(O(n log n)) 사용
+		static constexpr size_t MonotoneThreshold = 64;
+
+		// 다각형(정점 인덱스 루프)을 최적 평면에 투영해서 삼각형으로 분할
+		// 결과 삼각형은 입력 순서와 같은 감기 방향(Winding)으로 outIndices에 추가됨
+		static bool Triangulate(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& polygon, std::vector<uint32_t>& outIndices);
+
+		// 선택된 점들을 루프 단위로 분리
+		// 경계선(Boundary Edge)으로 닫힌 고리를 이루면 인접 순서로, 아니면 선택 순서 그대로 사용
+		static std::vector<std::vector<uint32_t>> BuildLoops(const std::vector<int>& selection,
+			const std::vector<uint32_t>& indices,
+			const std::vector<uint32_t>& edgeIndices,
+			size_t vertexCount);
+
+		// 여러 루프를 JobSystem으로 병렬 처리 (결과는 루프 순서대로 이어붙임)
+		static void TriangulateLoops(const std::vector<glm::vec3>& vertices,
+			const std::vector<std::vector<uint32_t>>& loops,
+			std::vector<uint32_t>& outIndices);
+
+	private:
+		static void EarClip(const std::vector<glm::vec2>& points, std::vector<uint32_t>& outTriangles);
+		static bool MonotoneTriangulate(const std::vector<glm::vec2>& points, std::vector<uint32_t>& outTriangles);
+	};
+}
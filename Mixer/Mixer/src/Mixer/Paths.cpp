@@ -0,0 +1,70 @@
+#include "mxpch.h"
+#include "Paths.h"
+
+#include <filesystem>
+
+namespace Mixer {
+
+	// 환경 변수 값 (없으면 작업 디렉터리)
+	static std::filesystem::path GetEnvironmentPath(const wchar_t* name)
+	{
+		wchar_t value[MAX_PATH];
+		DWORD length = GetEnvironmentVariableW(name, value, MAX_PATH);
+		if (length == 0 || length >= MAX_PATH)
+			return std::filesystem::current_path();
+		return std::filesystem::path(value);
+	}
+
+	static std::string EnsureDirectory(const std::filesystem::path& directory)
+	{
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		if (error)
+			MX_CORE_WARN("Can't create directory: {0} ({1})", directory.string(), error.message());
+		return directory.string();
+	}
+
+	std::string Paths::GetCacheDirectory()
+	{
+		return EnsureDirectory(GetEnvironmentPath(L"LOCALAPPDATA") / "Mixer" / "cache");
+	}
+
+	std::string Paths::GetDocumentsDirectory()
+	{
+		return EnsureDirectory(GetEnvironmentPath(L"USERPROFILE") / "Documents" / "Mixer");
+	}
+
+	std::string Paths::MakeUniquePath(const std::string& directory, const std::string& stem, const std::string& extension)
+	{
+		std::filesystem::path path = std::filesystem::path(directory) / (stem + extension);
+		std::error_code error;
+		for (int version = 2; std::filesystem::exists(path, error); version++)
+			path = std::filesystem::path(directory) / (stem + "-" + std::to_string(version) + extension);
+		return path.string();
+	}
+
+	void Paths::RemoveStaleEntries(const std::string& directory, const std::string& name, const std::string& extension,
+		const std::string& keepPath)
+	{
+		const size_t KeyDigits = 16;
+		std::string prefix = name + "-";
+		std::filesystem::path keep(keepPath);
+
+		std::error_code error;
+		for (const auto& file : std::filesystem::directory_iterator(directory, error))
+		{
+			std::string fileName = file.path().filename().string();
+			if (fileName.size() != prefix.size() + KeyDigits + extension.size() || fileName.compare(0, prefix.size(), prefix) != 0 ||
+				fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0)
+				continue;
+			// 정확히 키만 있어야 함 ("grid"가 "grid-overlay-..."와 맞으면 안 됨)
+			std::string key = fileName.substr(prefix.size(), KeyDigits);
+			if (key.find_first_not_of("0123456789abcdef") != std::string::npos || file.path().filename() == keep.filename())
+				continue;
+
+			std::error_code removeError;
+			std::filesystem::remove(file.path(), removeError);
+		}
+	}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <string>
+
+namespace Mixer {
+
+	// 에디터가 파일을 쓰는 위치 (작업 디렉터리와 무관, IDE에서 실행하면 작업 디렉터리가 프로젝트 폴더)
+	// 디렉터리는 처음 쓸 때 만듦
+	class MIXER_API Paths
+	{
+	public:
+		// %LOCALAPPDATA%/Mixer/cache: 다시 만들 수 있는 데이터 (프로그램 바이너리, 압축 텍스처)
+		static std::string GetCacheDirectory();
+		// %USERPROFILE%/Documents/Mixer: 사용자가 요청한 파일 (내보내기)
+		static std::string GetDocumentsDirectory();
+
+		// <directory>/<stem><extension>이 없으면 그대로, 있으면 <stem>-2<extension>, <stem>-3<extension>, ...
+		// 중 처음 비어 있는 이름 (기존 파일은 절대 돌려주지 않음)
+		static std::string MakeUniquePath(const std::string& directory, const std::string& stem, const std::string& extension);
+
+		// 캐시 항목 이름은 <name>-<16자리 16진수 키><extension>. name의 항목 중 keepPath 외에는 전부 삭제
+		// (키가 다른 항목 = 원본, 드라이버, 형식 버전 중 하나가 바뀐 옛 항목)
+		static void RemoveStaleEntries(const std::string& directory, const std::string& name, const std::string& extension,
+			const std::string& keepPath);
+	};
+
+}
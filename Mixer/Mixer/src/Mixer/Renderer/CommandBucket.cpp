@@ -0,0 +1,211 @@
+#include "mxpch.h"
+#include "CommandBucket.h"
+#include "Mixer/Renderer/RenderThread.h"
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <type_traits>
+
+namespace Mixer {
+
+	static_assert(std::is_trivially_copyable<DrawPacket>::value, "packets are copied into command data");
+	static_assert(std::is_trivially_copyable<UniformValue>::value, "uniforms are copied into command data");
+
+	struct CommandBucketData
+	{
+		std::mutex Mutex;
+		std::vector<uint64_t> Keys;
+		std::vector<DrawPacket> Packets;
+		std::vector<UniformValue> Uniforms;
+		std::vector<uint32_t> Order; // 용량을 재사용하려고 프레임 사이에도 유지
+	};
+
+	static CommandBucketData s_Data;
+
+	void CommandBucket::Add(uint64_t key, const DrawPacket& packet, const UniformValue* uniforms, size_t uniformCount)
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		s_Data.Keys.push_back(key);
+		s_Data.Packets.push_back(packet);
+		DrawPacket& added = s_Data.Packets.back();
+		added.FirstUniform = (uint32_t)s_Data.Uniforms.size();
+		added.UniformCount = (uint32_t)uniformCount;
+		s_Data.Uniforms.insert(s_Data.Uniforms.end(), uniforms, uniforms + uniformCount);
+	}
+
+	// ---- 렌더 스레드 ----
+
+	static void ApplyState(uint32_t state, uint32_t changed)
+	{
+		if (changed & RenderStateDepthTest)
+			(state & RenderStateDepthTest) ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+		if (changed & RenderStateDepthLessEqual)
+			glDepthFunc((state & RenderStateDepthLessEqual) ? GL_LEQUAL : GL_LESS);
+		if (changed & RenderStateBlend)
+		{
+			if (state & RenderStateBlend)
+			{
+				glEnable(GL_BLEND);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			}
+			else
+			{
+				glDisable(GL_BLEND);
+			}
+		}
+		if (changed & RenderStateCullBack)
+		{
+			if (state & RenderStateCullBack)
+			{
+				glEnable(GL_CULL_FACE);
+				glCullFace(GL_BACK);
+			}
+			else
+			{
+				glDisable(GL_CULL_FACE);
+			}
+		}
+		if (changed & RenderStatePolygonOffset)
+		{
+			if (state & RenderStatePolygonOffset)
+			{
+				glEnable(GL_POLYGON_OFFSET_FILL);
+				glPolygonOffset(1.0f, 1.0f);
+			}
+			else
+			{
+				glDisable(GL_POLYGON_OFFSET_FILL);
+			}
+		}
+		if (changed & RenderStateWireframe)
+			glPolygonMode(GL_FRONT_AND_BACK, (state & RenderStateWireframe) ? GL_LINE : GL_FILL);
+		if (changed & RenderStateProgramPointSize)
+			(state & RenderStateProgramPointSize) ? glEnable(GL_PROGRAM_POINT_SIZE) : glDisable(GL_PROGRAM_POINT_SIZE);
+		if (changed & RenderStateWideLines)
+			glLineWidth((state & RenderStateWideLines) ? 2.0f : 1.0f);
+		if (changed & RenderStateNoDepthWrite)
+			glDepthMask((state & RenderStateNoDepthWrite) ? GL_FALSE : GL_TRUE);
+	}
+
+	static void ApplyUniforms(GLuint program, const UniformValue* uniforms, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const UniformValue& u = uniforms[i];
+			GLint location = glGetUniformLocation(program, u.Name);
+			if (location < 0)
+				continue;
+
+			switch (u.ValueType)
+			{
+			case UniformValue::Type::Int:   glUniform1i(location, u.Int); break;
+			case UniformValue::Type::Float: glUniform1f(location, u.Float[0]); break;
+			case UniformValue::Type::Vec3:  glUniform3fv(location, 1, u.Float); break;
+			case UniformValue::Type::Vec4:  glUniform4fv(location, 1, u.Float); break;
+			case UniformValue::Type::Mat4:  glUniformMatrix4fv(location, 1, GL_FALSE, u.Float); break;
+			}
+		}
+	}
+
+	static void ExecutePackets(const DrawPacket* packets, uint32_t count, const UniformValue* uniforms)
+	{
+		GLuint program = 0, vertexArray = 0, indexBuffer = 0, texture = 0;
+		uint32_t state = RenderStateNone;
+		ApplyState(state, ~0u); // 앞서 실행된 명령 (클리어, 업로드)이 남긴 상태는 알 수 없음
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const DrawPacket& p = packets[i];
+
+			if (p.Program != program)
+			{
+				glUseProgram(p.Program);
+				program = p.Program;
+			}
+			if (p.State != state)
+			{
+				ApplyState(p.State, p.State ^ state);
+				state = p.State;
+			}
+			if (p.VertexArray != vertexArray)
+			{
+				glBindVertexArray(p.VertexArray);
+				vertexArray = p.VertexArray;
+				indexBuffer = 0; // 인덱스 버퍼 바인딩은 VAO에 속함
+			}
+			if (p.IndexBuffer && p.IndexBuffer != indexBuffer)
+			{
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, p.IndexBuffer);
+				indexBuffer = p.IndexBuffer;
+			}
+			if (p.Texture && p.Texture != texture)
+			{
+				glActiveTexture(GL_TEXTURE0);
+				glBindTexture(GL_TEXTURE_2D, p.Texture);
+				texture = p.Texture;
+			}
+
+			ApplyUniforms(program, uniforms + p.FirstUniform, p.UniformCount);
+
+			switch (p.Mode)
+			{
+			case DrawMode::Arrays:
+				glDrawArrays(p.Primitive, p.First, p.Count);
+				break;
+			case DrawMode::Elements:
+				if (p.InstanceCount > 1)
+					glDrawElementsInstanced(p.Primitive, p.Count, p.IndexType, nullptr, p.InstanceCount);
+				else
+					glDrawElements(p.Primitive, p.Count, p.IndexType, nullptr);
+				break;
+			case DrawMode::MultiArrays:
+				glMultiDrawArrays(p.Primitive, p.MultiFirst, p.MultiCount, p.MultiDrawCount);
+				break;
+			case DrawMode::MultiElements:
+				glMultiDrawElements(p.Primitive, p.MultiCount, p.IndexType, p.MultiOffsets, p.MultiDrawCount);
+				break;
+			case DrawMode::ElementsIndirect:
+				glBindBuffer(GL_DRAW_INDIRECT_BUFFER, p.IndirectBuffer);
+				glMultiDrawElementsIndirect(p.Primitive, p.IndexType, nullptr, p.MultiDrawCount, 0);
+				glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+				break;
+			}
+		}
+
+		ApplyState(RenderStateNone, state);
+		glBindVertexArray(0);
+		glUseProgram(0);
+	}
+
+	// ---- 메인 스레드 ----
+
+	void CommandBucket::Flush()
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		uint32_t count = (uint32_t)s_Data.Packets.size();
+		if (count == 0)
+			return;
+
+		// 키가 같으면 제출 순서 유지 (예: 선택된 점을 Hover 점 위에)
+		s_Data.Order.resize(count);
+		std::iota(s_Data.Order.begin(), s_Data.Order.end(), 0u);
+		const std::vector<uint64_t>& keys = s_Data.Keys;
+		std::sort(s_Data.Order.begin(), s_Data.Order.end(), [&keys](uint32_t a, uint32_t b)
+		{
+			return keys[a] != keys[b] ? keys[a] < keys[b] : a < b;
+		});
+
+		DrawPacket* packets = static_cast<DrawPacket*>(RenderThread::AllocateCommandData(count * sizeof(DrawPacket), alignof(DrawPacket)));
+		for (uint32_t i = 0; i < count; i++)
+			packets[i] = s_Data.Packets[s_Data.Order[i]];
+		UniformValue* uniforms = RenderThread::CopyCommandData(s_Data.Uniforms.data(), s_Data.Uniforms.size());
+
+		RenderThread::Submit([packets, count, uniforms] { ExecutePackets(packets, count, uniforms); });
+
+		s_Data.Keys.clear();
+		s_Data.Packets.clear();
+		s_Data.Uniforms.clear();
+	}
+
+}
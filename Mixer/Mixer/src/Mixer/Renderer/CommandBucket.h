@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+namespace Mixer {
+
+	// 정렬 키의 최상위: 어느 레이어가 넣었든 한 패스의 패킷을 전부 그린 뒤에 다음 패스
+	enum class RenderPass : uint8_t
+	{
+		Opaque = 0, // 씬 오브젝트, 메쉬 면
+		Grid,       // 절차적 바닥 격자 (불투명 물체 위에 블렌딩, 깊이는 안 씀)
+		Wireframe,  // 메쉬 선
+		Points,     // 정점
+		Highlight,  // Hover / 선택된 점 (같은 깊이에서 Points 위에)
+		UI          // 화면 공간 오버레이
+	};
+
+	// 패킷에 필요한 고정 기능 상태. 앞 패킷에서 물려받는 것은 없음 (꺼진 비트 = GL 기본값)
+	enum RenderStateFlags : uint32_t
+	{
+		RenderStateNone             = 0,
+		RenderStateDepthTest        = BIT(0),
+		RenderStateDepthLessEqual   = BIT(1), // 없으면 GL_LESS
+		RenderStateBlend            = BIT(2), // src alpha, 1 - src alpha
+		RenderStateCullBack         = BIT(3),
+		RenderStatePolygonOffset    = BIT(4), // 채우기 오프셋 (1, 1): 면을 와이어프레임 뒤로 밀어줌
+		RenderStateWireframe        = BIT(5), // glPolygonMode GL_LINE
+		RenderStateProgramPointSize = BIT(6),
+		RenderStateWideLines        = BIT(7), // 선 두께 2
+		RenderStateNoDepthWrite     = BIT(8)
+	};
+
+	// [63..56] pass  [55..44] program  [43..32] state  [31..0] depth
+	namespace SortKey {
+
+		inline uint64_t Make(RenderPass pass, GLuint program, uint32_t state, uint32_t depth = 0)
+		{
+			return ((uint64_t)pass << 56) | ((uint64_t)(program & 0xFFF) << 44) | ((uint64_t)(state & 0xFFF) << 32) | depth;
+		}
+
+		// 시점 거리를 정렬 가능한 비트로: 가까운 것부터, 블렌딩하는 물체는 먼 것부터
+		inline uint32_t Depth(float distance, bool backToFront = false)
+		{
+			if (!(distance > 0.0f))
+				distance = 0.0f;
+			uint32_t bits;
+			std::memcpy(&bits, &distance, sizeof(bits)); // 음수가 아닌 float은 비트 순서와 크기 순서가 같음
+			return backToFront ? ~bits : bits;
+		}
+
+	}
+
+	enum class DrawMode : uint8_t
+	{
+		Arrays,          // First, Count
+		Elements,        // IndexBuffer, IndexType, Count (InstanceCount > 1이면 인스턴싱)
+		MultiArrays,     // MultiFirst, MultiCount, MultiDrawCount
+		MultiElements,   // IndexBuffer, IndexType, MultiCount, MultiOffsets, MultiDrawCount
+		ElementsIndirect // IndexBuffer, IndexType, IndirectBuffer, MultiDrawCount
+	};
+
+	// 그리기 호출 하나에 필요한 전부. 단순 데이터 (버킷이 복사, 정렬해서 넘김)
+	struct DrawPacket
+	{
+		GLuint Program = 0;
+		GLuint VertexArray = 0;
+		GLuint IndexBuffer = 0;
+		GLuint IndirectBuffer = 0;
+		GLuint Texture = 0; // 0번 유닛
+		uint32_t State = RenderStateNone;
+		DrawMode Mode = DrawMode::Arrays;
+		GLenum Primitive = GL_TRIANGLES;
+		GLenum IndexType = GL_UNSIGNED_INT;
+		GLint First = 0;
+		GLsizei Count = 0;
+		GLsizei InstanceCount = 1;
+		GLsizei MultiDrawCount = 0;
+		// 멀티 드로우 배열은 프레임이 실행될 때까지 살아 있어야 함 (RenderThread::CopyCommandData)
+		const GLint* MultiFirst = nullptr;
+		const GLsizei* MultiCount = nullptr;
+		const void* const* MultiOffsets = nullptr;
+
+		// CommandBucket::Add가 채움
+		uint32_t FirstUniform = 0;
+		uint32_t UniformCount = 0;
+	};
+
+	struct UniformValue
+	{
+		enum class Type : uint8_t { Int, Float, Vec3, Vec4, Mat4 };
+
+		UniformValue(const char* name, int value) : Name(name), ValueType(Type::Int) { Int = value; }
+		UniformValue(const char* name, float value) : Name(name), ValueType(Type::Float) { Float[0] = value; }
+		UniformValue(const char* name, const glm::vec3& value) : Name(name), ValueType(Type::Vec3) { std::memcpy(Float, glm::value_ptr(value), sizeof(value)); }
+		UniformValue(const char* name, const glm::vec4& value) : Name(name), ValueType(Type::Vec4) { std::memcpy(Float, glm::value_ptr(value), sizeof(value)); }
+		UniformValue(const char* name, const glm::mat4& value) : Name(name), ValueType(Type::Mat4) { std::memcpy(Float, glm::value_ptr(value), sizeof(value)); }
+
+		const char* Name; // 문자열 리터럴
+		Type ValueType;
+		union
+		{
+			int Int;
+			float Float[16];
+		};
+	};
+
+	// 모든 레이어의 이번 프레임 그리기 패킷을 모아서 키로 한 번 정렬하고, 렌더 스레드에 명령 하나로 제출
+	// (패킷 사이에 바뀌는 GL 상태만 건드림). 그리기가 아닌 일 (업로드, 클리어)은 그대로 RenderThread::Submit으로,
+	// 그리기보다 먼저 실행됨
+	class MIXER_API CommandBucket
+	{
+	public:
+		// 스레드 안전 (작업에서 패킷을 만들어도 됨). 셰이더가 읽는 유니폼은 전부 넘겨야 함
+		static void Add(uint64_t key, const DrawPacket& packet, const UniformValue* uniforms, size_t uniformCount);
+		static void Add(uint64_t key, const DrawPacket& packet, std::initializer_list<UniformValue> uniforms)
+		{
+			Add(key, packet, uniforms.begin(), uniforms.size());
+		}
+
+		// 메인 스레드, 프레임마다 RenderThread::EndFrame 전에 한 번
+		static void Flush();
+	};
+
+}
@@ -0,0 +1,50 @@
+#include "mxpch.h"
+#include "RenderCommandQueue.h"
+
+namespace Mixer {
+
+	static constexpr size_t DefaultQueueCapacity = 1024 * 1024;
+
+	RenderCommandQueue::RenderCommandQueue()
+		: m_Arena(DefaultQueueCapacity)
+	{
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		// 명령이 캡처한 상태 (vector, 스마트 포인터)를 가지므로 새지 않게 실행함
+		Execute();
+	}
+
+	void* RenderCommandQueue::Allocate(CommandFn fn, size_t size, size_t alignment)
+	{
+		CommandHeader* header = static_cast<CommandHeader*>(m_Arena.Allocate(sizeof(CommandHeader), alignof(CommandHeader)));
+		header->Fn = fn;
+		header->Command = m_Arena.Allocate(size, alignment);
+		header->Next = nullptr;
+
+		if (m_Tail)
+			m_Tail->Next = header;
+		else
+			m_Head = header;
+		m_Tail = header;
+		m_CommandCount++;
+		return header->Command;
+	}
+
+	void* RenderCommandQueue::AllocateData(size_t size, size_t alignment)
+	{
+		return m_Arena.Allocate(size, alignment);
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		for (CommandHeader* header = m_Head; header; header = header->Next)
+			header->Fn(header->Command);
+
+		m_Head = m_Tail = nullptr;
+		m_CommandCount = 0;
+		m_Arena.Reset();
+	}
+
+}
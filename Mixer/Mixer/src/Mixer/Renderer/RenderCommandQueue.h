@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Mixer/Core.h"
+#include "Mixer/FrameAllocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 한 스레드가 기록하고 다른 스레드가 (순서대로) 실행하는 타입 지운 명령 목록
+	// 명령과 명령이 가리키는 데이터는 아레나 하나에 있으므로, 아레나가 프레임 크기만큼 커진 뒤에는 기록에 힙 할당이 없음
+	// 스레드 안전하지 않음: RenderThread가 자기 잠금 아래에서 메인 스레드와 렌더 스레드 사이로 큐를 넘김
+	class MIXER_API RenderCommandQueue
+	{
+	public:
+		using CommandFn = void(*)(void* command);
+
+		RenderCommandQueue();
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		// 명령 객체를 둘 공간을 돌려줌. Execute 때 fn이 실행 (+ 소멸)
+		void* Allocate(CommandFn fn, size_t size, size_t alignment);
+		// Execute가 끝날 때까지 유효한 메모리 (업로드 데이터, 그리기 목록)
+		void* AllocateData(size_t size, size_t alignment);
+
+		// 모든 명령을 제출 순서대로 실행하고 비움
+		void Execute();
+
+		uint32_t GetCommandCount() const { return m_CommandCount; }
+		size_t GetUsed() const { return m_Arena.GetUsed(); }
+
+	private:
+		struct CommandHeader
+		{
+			CommandFn Fn;
+			void* Command;
+			CommandHeader* Next;
+		};
+
+		LinearArena m_Arena;
+		CommandHeader* m_Head = nullptr;
+		CommandHeader* m_Tail = nullptr;
+		uint32_t m_CommandCount = 0;
+	};
+
+}
@@ -0,0 +1,146 @@
+#include "mxpch.h"
+#include "RenderThread.h"
+#include "Mixer/Window.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Mixer {
+
+	struct RenderThreadData
+	{
+		Window* TargetWindow = nullptr;
+		std::thread Thread;
+		std::mutex Mutex;
+		std::condition_variable WakeCondition; // 렌더 스레드: 할 일이 생김
+		std::condition_variable IdleCondition; // 메인 스레드: 일이 끝남
+
+		RenderCommandQueue Queues[2];
+		uint32_t SubmitIndex = 0;                       // 메인 스레드가 기록하는 큐
+		bool FramePending = false;                      // 다른 큐를 넘겼지만 아직 실행 전
+		const std::function<void()>* Immediate = nullptr;
+		bool Running = false;
+	};
+
+	static RenderThreadData s_Data;
+
+	static void RenderLoop()
+	{
+		s_Data.TargetWindow->MakeContextCurrent();
+
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		while (true)
+		{
+			s_Data.WakeCondition.wait(lock, [] { return s_Data.Immediate || s_Data.FramePending || !s_Data.Running; });
+
+			if (s_Data.Immediate)
+			{
+				const std::function<void()>* fn = s_Data.Immediate;
+				lock.unlock();
+				(*fn)();
+				lock.lock();
+				s_Data.Immediate = nullptr;
+				s_Data.IdleCondition.notify_all();
+			}
+			else if (s_Data.FramePending)
+			{
+				RenderCommandQueue& queue = s_Data.Queues[1 - s_Data.SubmitIndex];
+				lock.unlock();
+				queue.Execute();
+				s_Data.TargetWindow->SwapBuffers();
+				lock.lock();
+				s_Data.FramePending = false;
+				s_Data.IdleCondition.notify_all();
+			}
+			else
+			{
+				break;
+			}
+		}
+		lock.unlock();
+
+		s_Data.TargetWindow->DetachContext();
+	}
+
+	// 호출하는 쪽이 잠금을 가지고 있어야 함
+	static void WaitIdle(std::unique_lock<std::mutex>& lock)
+	{
+		s_Data.IdleCondition.wait(lock, [] { return !s_Data.FramePending && !s_Data.Immediate; });
+	}
+
+	void RenderThread::Init(Window& window)
+	{
+		if (s_Data.Running)
+			return;
+
+		window.DetachContext();
+		s_Data.TargetWindow = &window;
+		s_Data.Running = true;
+		s_Data.Thread = std::thread(RenderLoop);
+	}
+
+	void RenderThread::Shutdown()
+	{
+		if (!s_Data.Running)
+			return;
+
+		{
+			std::unique_lock<std::mutex> lock(s_Data.Mutex);
+			WaitIdle(lock);
+			s_Data.Running = false;
+		}
+		s_Data.WakeCondition.notify_one();
+		s_Data.Thread.join();
+
+		// 컨텍스트가 이 스레드로 돌아옴: 마지막 프레임 뒤에 기록한 명령을 실행
+		s_Data.TargetWindow->MakeContextCurrent();
+		s_Data.Queues[s_Data.SubmitIndex].Execute();
+	}
+
+	bool RenderThread::IsRunning()
+	{
+		// 메인 스레드만 쓰고, 호출하는 것도 메인 스레드뿐
+		return s_Data.Running;
+	}
+
+	RenderCommandQueue& RenderThread::GetSubmitQueue()
+	{
+		return s_Data.Queues[s_Data.SubmitIndex];
+	}
+
+	void* RenderThread::AllocateCommandData(size_t size, size_t alignment)
+	{
+		return GetSubmitQueue().AllocateData(size, alignment);
+	}
+
+	void RenderThread::ExecuteNow(const std::function<void()>& fn)
+	{
+		if (!s_Data.Running)
+		{
+			fn();
+			return;
+		}
+
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		WaitIdle(lock);
+		s_Data.Immediate = &fn;
+		s_Data.WakeCondition.notify_one();
+		WaitIdle(lock);
+	}
+
+	void RenderThread::EndFrame()
+	{
+		if (!s_Data.Running)
+			return;
+
+		{
+			std::unique_lock<std::mutex> lock(s_Data.Mutex);
+			WaitIdle(lock);
+			s_Data.SubmitIndex = 1 - s_Data.SubmitIndex;
+			s_Data.FramePending = true;
+		}
+		s_Data.WakeCondition.notify_one();
+	}
+
+}
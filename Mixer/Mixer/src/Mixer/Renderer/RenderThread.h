@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Mixer/Core.h"
+#include "Mixer/Renderer/RenderCommandQueue.h"
+
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+
+namespace Mixer {
+
+	class Window;
+
+	// 전용 스레드에서 GL 컨텍스트를 가짐. 메인 스레드가 명령 큐 두 개 중 하나에 Submit으로 GL 작업을 기록하는 동안
+	// 렌더 스레드는 다른 하나 (이전 프레임)를 실행하고 버퍼를 스왑 -> 레이어 갱신과 GPU 제출이 겹침
+	// 동시에 진행 중인 프레임은 최대 하나
+	//
+	// 명령은 나중에 다른 스레드에서 실행됨: 값을 캡처하고, 메인 스레드가 계속 바꾸는 상태의 참조는 캡처 금지
+	// 큰 데이터는 AllocateCommandData/CopyCommandData로. Submit, ExecuteNow, EndFrame은 메인 스레드에서만
+	// Init 전과 Shutdown 후에는 전부 호출한 스레드에서 바로 실행 (그때는 그 스레드가 컨텍스트를 가짐)
+	class MIXER_API RenderThread
+	{
+	public:
+		// 창의 컨텍스트를 호출한 스레드에서 가져감
+		static void Init(Window& window);
+		// 남은 명령 (OnDetach의 삭제 등)을 실행하고 컨텍스트를 돌려줌
+		static void Shutdown();
+
+		static bool IsRunning();
+
+		template<typename Fn>
+		static void Submit(Fn&& fn)
+		{
+			using Command = std::decay_t<Fn>;
+			if (!IsRunning())
+			{
+				fn();
+				return;
+			}
+
+			void* storage = GetSubmitQueue().Allocate([](void* command)
+			{
+				Command& c = *static_cast<Command*>(command);
+				c();
+				c.~Command();
+			}, sizeof(Command), alignof(Command));
+			new (storage) Command(std::forward<Fn>(fn));
+		}
+
+		// 이번 프레임에 제출한 명령이 실행될 때까지 유효
+		static void* AllocateCommandData(size_t size, size_t alignment = 16);
+
+		template<typename T>
+		static T* CopyCommandData(const T* data, size_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "command data is copied with memcpy");
+			if (count == 0)
+				return nullptr;
+			T* copy = static_cast<T*>(AllocateCommandData(count * sizeof(T), alignof(T)));
+			std::memcpy(copy, data, count * sizeof(T));
+			return copy;
+		}
+
+		// 렌더 스레드가 쉴 때까지 기다렸다가 거기서 fn을 실행하고 끝날 때까지 기다림
+		// 메인 스레드가 결과를 바로 써야 하는 드문 호출용 (glGen*, 셰이더 컴파일)
+		// 메인 스레드가 기다리고 있으므로 fn은 레이어 상태를 마음대로 건드려도 됨. 이번 프레임에 제출한 명령보다 먼저 실행됨
+		static void ExecuteNow(const std::function<void()>& fn);
+
+		// 이번 프레임 명령을 렌더 스레드로 넘김 (이전 프레임이 끝나기를 먼저 기다림)
+		static void EndFrame();
+
+	private:
+		static RenderCommandQueue& GetSubmitQueue();
+	};
+
+}
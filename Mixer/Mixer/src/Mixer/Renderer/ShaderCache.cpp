@@ -0,0 +1,292 @@
+#include "mxpch.h"
+#include "ShaderCache.h"
+#include "Mixer/Paths.h"
+#include "Mixer/StartupTimeline.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Mixer {
+
+	static constexpr uint32_t CacheMagic = 0x4250584D; // "MXPB"
+	static constexpr uint32_t CacheVersion = 1;
+
+	struct CacheFileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t Key;
+		uint32_t Format; // 드라이버가 고른 바이너리 형식
+		uint32_t Length;
+		// 뒤에 프로그램 바이너리 Length바이트
+	};
+
+	// 렌더 스레드에서만
+	struct ShaderCacheData
+	{
+		std::string Directory; // 비어 있으면 <캐시 디렉터리>/shaders (처음 쓸 때 결정)
+		std::string Driver;    // 제조사 / 렌더러 / 버전, 모든 키에 포함
+		bool Queried = false;
+		bool BinarySupported = false;
+		bool ParallelCompile = false; // KHR_parallel_shader_compile
+	};
+
+	static ShaderCacheData s_Data;
+
+	static void QueryDriver()
+	{
+		if (s_Data.Queried)
+			return;
+		s_Data.Queried = true;
+
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+		{
+			const char* value = (const char*)glGetString(name);
+			s_Data.Driver += value ? value : "?";
+			s_Data.Driver += '\n';
+		}
+
+		GLint formatCount = 0;
+		if (glProgramBinary && glGetProgramBinary)
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		s_Data.BinarySupported = formatCount > 0;
+		if (!s_Data.BinarySupported)
+			MX_CORE_WARN("Program binaries are not supported by this driver: every shader is compiled at startup");
+
+		GLint extensionCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+		for (GLint i = 0; i < extensionCount && !s_Data.ParallelCompile; i++)
+		{
+			const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+			s_Data.ParallelCompile = extension && (std::strcmp(extension, "GL_KHR_parallel_shader_compile") == 0 ||
+				std::strcmp(extension, "GL_ARB_parallel_shader_compile") == 0);
+		}
+	}
+
+	static std::string GetCachePath(const std::string& name, uint64_t key)
+	{
+		char file[32];
+		std::snprintf(file, sizeof(file), "-%016llx.mxprog", (unsigned long long)key);
+		return ShaderCache::GetDirectory() + "/" + name + file;
+	}
+
+	static uint64_t HashKey(const char* vertexSource, const char* fragmentSource)
+	{
+		uint64_t hash = 14695981039346656037ull; // FNV-1a
+		auto add = [&hash](const char* text, size_t length)
+		{
+			for (size_t i = 0; i < length; i++)
+			{
+				hash ^= (uint8_t)text[i];
+				hash *= 1099511628211ull;
+			}
+		};
+		add(s_Data.Driver.c_str(), s_Data.Driver.size() + 1);
+		add(vertexSource, std::strlen(vertexSource) + 1);
+		add(fragmentSource, std::strlen(fragmentSource) + 1);
+		return hash ^ CacheVersion;
+	}
+
+	static bool IsLinked(GLuint program)
+	{
+		GLint success = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		return success != 0;
+	}
+
+	static GLuint LoadBinary(const std::string& path, uint64_t key)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+			return 0;
+
+		CacheFileHeader header;
+		std::vector<char> binary;
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.Magic != CacheMagic ||
+			header.Version != CacheVersion || header.Key != key)
+			return 0;
+		binary.resize(header.Length);
+		if (!file.read(binary.data(), header.Length))
+			return 0;
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, header.Format, binary.data(), (GLsizei)header.Length);
+		if (!IsLinked(program))
+		{
+			glDeleteProgram(program);
+			return 0;
+		}
+		return program;
+	}
+
+	// 이 프로그램의 옛 키 바이너리 (소스 수정, 다른 드라이버)도 삭제
+	static void StoreBinary(GLuint program, const std::string& name, const std::string& path, uint64_t key)
+	{
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		std::vector<char> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+		CacheFileHeader header = { CacheMagic, CacheVersion, key, format, (uint32_t)length };
+
+		std::error_code error;
+		std::filesystem::create_directories(ShaderCache::GetDirectory(), error);
+		std::string temporaryPath = path + ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			if (!file || !file.write(reinterpret_cast<const char*>(&header), sizeof(header)) || !file.write(binary.data(), length))
+			{
+				MX_CORE_WARN("Can't write program binary: {0}", temporaryPath);
+				return;
+			}
+		}
+		std::filesystem::rename(temporaryPath, path, error);
+		if (error)
+		{
+			std::filesystem::remove(temporaryPath, error);
+			return;
+		}
+		Paths::RemoveStaleEntries(ShaderCache::GetDirectory(), name, ".mxprog", path);
+	}
+
+	static bool CheckShader(const std::string& name, GLuint shader, const char* type)
+	{
+		GLint success = 0;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			char infoLog[1024];
+			glGetShaderInfoLog(shader, 1024, NULL, infoLog);
+			MX_CORE_ERROR("{0} SHADER_ERROR ( {1} ): {2}", name, type, infoLog);
+		}
+		return success != 0;
+	}
+
+	static void DeleteShaders(PendingProgram& pending)
+	{
+		// glDelete*는 0을 무시
+		if (pending.VertexShader)
+			glDetachShader(pending.Program, pending.VertexShader);
+		if (pending.FragmentShader)
+			glDetachShader(pending.Program, pending.FragmentShader);
+		glDeleteShader(pending.VertexShader);
+		glDeleteShader(pending.FragmentShader);
+		pending.VertexShader = pending.FragmentShader = 0;
+	}
+
+	void ShaderCache::SetDirectory(const std::string& directory)
+	{
+		s_Data.Directory = directory;
+	}
+
+	const std::string& ShaderCache::GetDirectory()
+	{
+		if (s_Data.Directory.empty())
+			s_Data.Directory = Paths::GetCacheDirectory() + "/shaders";
+		return s_Data.Directory;
+	}
+
+	GLuint ShaderCache::CreateProgram(const char* name, const char* vertexSource, const char* fragmentSource)
+	{
+		auto start = std::chrono::steady_clock::now();
+		PendingProgram pending = BeginProgram(name, vertexSource, fragmentSource);
+		const char* source = pending.FromBinary ? "binary cache" : "compiled";
+		GLuint program = FinishProgram(pending);
+
+		float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		char step[128];
+		std::snprintf(step, sizeof(step), "program %s (%s, %.1f ms)", name, program ? source : "failed", ms);
+		StartupTimeline::Mark(step);
+		return program;
+	}
+
+	PendingProgram ShaderCache::BeginProgram(const char* name, const char* vertexSource, const char* fragmentSource)
+	{
+		QueryDriver();
+
+		PendingProgram pending;
+		pending.Name = name;
+		if (s_Data.BinarySupported)
+		{
+			pending.Key = HashKey(vertexSource, fragmentSource);
+			pending.Program = LoadBinary(GetCachePath(pending.Name, pending.Key), pending.Key);
+			pending.FromBinary = pending.Program != 0;
+			if (pending.FromBinary)
+				return pending;
+		}
+
+		// Finish 전까지 상태 조회 금지 (드라이버의 컴파일 스레드를 기다리게 됨)
+		pending.VertexShader = glCreateShader(GL_VERTEX_SHADER);
+		glShaderSource(pending.VertexShader, 1, &vertexSource, nullptr);
+		glCompileShader(pending.VertexShader);
+		pending.FragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+		glShaderSource(pending.FragmentShader, 1, &fragmentSource, nullptr);
+		glCompileShader(pending.FragmentShader);
+
+		pending.Program = glCreateProgram();
+		if (s_Data.BinarySupported)
+			glProgramParameteri(pending.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		glAttachShader(pending.Program, pending.VertexShader);
+		glAttachShader(pending.Program, pending.FragmentShader);
+		glLinkProgram(pending.Program);
+		return pending;
+	}
+
+	bool ShaderCache::IsProgramReady(const PendingProgram& pending)
+	{
+		if (!pending.IsValid() || pending.FromBinary || !s_Data.ParallelCompile)
+			return true;
+		GLint complete = 0;
+		glGetProgramiv(pending.Program, GL_COMPLETION_STATUS_KHR, &complete);
+		return complete != 0;
+	}
+
+	GLuint ShaderCache::FinishProgram(PendingProgram& pending)
+	{
+		GLuint program = pending.Program;
+		if (!pending.FromBinary && program)
+		{
+			// 컴파일에 실패한 셰이더는 링크도 실패시킴 -> 첫 원인만 출력
+			bool compiled = CheckShader(pending.Name, pending.VertexShader, "VERTEX");
+			compiled = CheckShader(pending.Name, pending.FragmentShader, "FRAGMENT") && compiled;
+			DeleteShaders(pending);
+
+			if (!IsLinked(program))
+			{
+				if (compiled)
+				{
+					char infoLog[1024];
+					glGetProgramInfoLog(program, 1024, NULL, infoLog);
+					MX_CORE_ERROR("{0} PROGRAM_ERROR: {1}", pending.Name, infoLog);
+				}
+				glDeleteProgram(program);
+				program = 0;
+			}
+			else if (s_Data.BinarySupported)
+			{
+				StoreBinary(program, pending.Name, GetCachePath(pending.Name, pending.Key), pending.Key);
+			}
+		}
+		pending = PendingProgram();
+		return program;
+	}
+
+	void ShaderCache::CancelProgram(PendingProgram& pending)
+	{
+		DeleteShaders(pending);
+		glDeleteProgram(pending.Program);
+		pending = PendingProgram();
+	}
+
+	bool ShaderCache::IsParallelCompileSupported()
+	{
+		return s_Data.ParallelCompile;
+	}
+
+}
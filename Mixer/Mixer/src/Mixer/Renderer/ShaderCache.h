@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+// KHR_parallel_shader_compile (생성된 로더에 없음)
+#ifndef GL_COMPLETION_STATUS_KHR
+	#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace Mixer {
+
+	// 렌더 스레드에서 만드는 중인 프로그램. KHR_parallel_shader_compile이 있으면 IsProgramReady가 될 때까지
+	// 드라이버가 백그라운드에서 컴파일/링크, 없으면 FinishProgram에서 기다림
+	struct PendingProgram
+	{
+		std::string Name;
+		GLuint Program = 0;
+		GLuint VertexShader = 0;   // 바이너리에서 복원했으면 0
+		GLuint FragmentShader = 0;
+		uint64_t Key = 0;
+		bool FromBinary = false;
+
+		bool IsValid() const { return Program != 0; }
+	};
+
+	// GLSL 프로그램 링크. 링크한 프로그램의 바이너리 (glGetProgramBinary)를 드라이버 (제조사, 렌더러, 버전)와
+	// 소스 해시를 키로 디스크에 저장 -> 같은 드라이버로 다음에 실행하면 glProgramBinary로 복원 (컴파일/링크 생략)
+	// 드라이버가 거부한 바이너리는 소스에서 다시 만들고, 바이너리 형식을 지원하지 않으면 매번 컴파일
+	// 전부 렌더 스레드에서 실행
+	class MIXER_API ShaderCache
+	{
+	public:
+		// 기본값: <Paths::GetCacheDirectory()>/shaders, 프로그램 이름마다 파일 하나 (옛 키는 삭제)
+		static void SetDirectory(const std::string& directory); // 첫 프로그램 전에
+		static const std::string& GetDirectory();
+
+		// name: 로그와 캐시 파일 이름용
+		// 셰이더 컴파일이나 프로그램 링크가 실패하면 0 (로그 출력)
+		static GLuint CreateProgram(const char* name, const char* vertexSource, const char* fragmentSource);
+
+		// 같은 일을 단계별로 (프레임이 계속 도는 동안 만드는 프로그램용, 핫 리로드)
+		// Begin은 아무것도 조회하지 않고 컴파일/링크만 요청, Finish가 확인, 로그, 저장
+		static PendingProgram BeginProgram(const char* name, const char* vertexSource, const char* fragmentSource);
+		static bool IsProgramReady(const PendingProgram& pending);
+		static GLuint FinishProgram(PendingProgram& pending);
+		// 필요 없어진 프로그램을 버림 (예: 컴파일 중에 주인이 사라짐)
+		static void CancelProgram(PendingProgram& pending);
+
+		static bool IsParallelCompileSupported();
+	};
+
+}
@@ -0,0 +1,251 @@
+#include "mxpch.h"
+#include "ShaderLibrary.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/ShaderCache.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace Mixer {
+
+	static constexpr std::chrono::milliseconds CheckInterval(250);
+
+	enum class ReloadState : uint8_t
+	{
+		Idle,
+		Compiling,
+		Succeeded,
+		Failed
+	};
+
+	struct ShaderEntry
+	{
+		std::string Name;
+		uint32_t RefCount = 0;
+		GLuint Program = 0; // 메인 스레드: 패킷이 쓰는 프로그램
+		std::filesystem::file_time_type VertexTime;
+		std::filesystem::file_time_type FragmentTime;
+
+		// 진행 중인 다시 불러오기: Pending은 렌더 스레드 소유, 결과는 State로 알림
+		// (ReloadedProgram을 쓴 뒤에 State가 Succeeded가 됨)
+		PendingProgram Pending;
+		GLuint ReloadedProgram = 0;
+		std::atomic<ReloadState> State{ ReloadState::Idle };
+		std::chrono::steady_clock::time_point ReloadStart;
+	};
+
+	struct ShaderLibraryData
+	{
+		std::string Directory = "assets/shaders";
+		std::vector<ShaderEntry*> Entries; // ShaderHandle::Slot 번호로
+		std::vector<uint32_t> FreeSlots;
+		std::unordered_map<std::string, uint32_t> Slots;
+		std::chrono::steady_clock::time_point LastCheck;
+	};
+
+	static ShaderLibraryData s_Data;
+
+	static std::filesystem::file_time_type GetWriteTime(const std::string& path)
+	{
+		std::error_code error;
+		auto time = std::filesystem::last_write_time(path, error);
+		return error ? std::filesystem::file_time_type::min() : time;
+	}
+
+	static bool ReadFile(const std::string& path, std::string& text)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+			return false;
+		std::ostringstream stream;
+		stream << file.rdbuf();
+		text = stream.str();
+		return true;
+	}
+
+	static std::string GetPath(const ShaderEntry& entry, const char* extension)
+	{
+		return s_Data.Directory + "/" + entry.Name + extension;
+	}
+
+	static ShaderEntry* GetEntry(ShaderHandle handle)
+	{
+		if (!handle.IsValid() || handle.Slot >= s_Data.Entries.size())
+			return nullptr;
+		return s_Data.Entries[handle.Slot];
+	}
+
+	// 이 항목을 아직 쓸 수 있는 명령 (확인, 이 프로그램을 쓰는 패킷)이 전부 끝난 뒤에
+	static void DestroyEntry(ShaderEntry* entry)
+	{
+		GLuint program = entry->Program;
+		RenderThread::Submit([entry, program]
+		{
+			if (entry->Pending.IsValid())
+				ShaderCache::CancelProgram(entry->Pending);
+			if (entry->State.load() == ReloadState::Succeeded)
+				glDeleteProgram(entry->ReloadedProgram); // 교체되지 못한 프로그램
+			glDeleteProgram(program);
+			delete entry;
+		});
+	}
+
+	// 렌더 스레드
+	static void PollReload(ShaderEntry* entry)
+	{
+		// 결과를 가져가기 전에 쌓인 확인 명령은 진행 중인 것이 없음을 보게 됨
+		if (!entry->Pending.IsValid() || !ShaderCache::IsProgramReady(entry->Pending))
+			return;
+		GLuint program = ShaderCache::FinishProgram(entry->Pending);
+		entry->ReloadedProgram = program;
+		entry->State.store(program ? ReloadState::Succeeded : ReloadState::Failed);
+	}
+
+	void ShaderLibrary::SetDirectory(const std::string& directory)
+	{
+		s_Data.Directory = directory;
+	}
+
+	void ShaderLibrary::Shutdown()
+	{
+		for (ShaderEntry* entry : s_Data.Entries)
+		{
+			if (entry)
+				DestroyEntry(entry);
+		}
+		s_Data.Entries.clear();
+		s_Data.FreeSlots.clear();
+		s_Data.Slots.clear();
+	}
+
+	void ShaderLibrary::Update()
+	{
+		// 1. 결과: 링크에 성공했으면 교체, 아니면 이전 프로그램 유지
+		for (ShaderEntry* entry : s_Data.Entries)
+		{
+			if (!entry)
+				continue;
+
+			switch (entry->State.load())
+			{
+			case ReloadState::Compiling:
+				RenderThread::Submit([entry] { PollReload(entry); });
+				break;
+			case ReloadState::Succeeded:
+			{
+				// 이번 프레임 패킷은 Update 뒤에 기록되므로 이전 프로그램을 쓰는 패킷은 없음
+				GLuint old = entry->Program;
+				entry->Program = entry->ReloadedProgram;
+				RenderThread::Submit([old] { glDeleteProgram(old); });
+				float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - entry->ReloadStart).count();
+				MX_CORE_INFO("Shader reloaded: {0} ({1:.1f} ms)", entry->Name, ms);
+				entry->State.store(ReloadState::Idle);
+				break;
+			}
+			case ReloadState::Failed:
+				MX_CORE_WARN("Shader reload failed, keeping the previous program: {0}", entry->Name);
+				entry->State.store(ReloadState::Idle);
+				break;
+			case ReloadState::Idle:
+				break;
+			}
+		}
+
+		// 2. 바뀐 파일 (컴파일 중에 고친 것은 그 컴파일이 끝난 뒤에 반영)
+		auto now = std::chrono::steady_clock::now();
+		if (now - s_Data.LastCheck < CheckInterval)
+			return;
+		s_Data.LastCheck = now;
+
+		for (ShaderEntry* entry : s_Data.Entries)
+		{
+			if (!entry || entry->State.load() != ReloadState::Idle)
+				continue;
+
+			std::string vertexPath = GetPath(*entry, ".vert"), fragmentPath = GetPath(*entry, ".frag");
+			auto vertexTime = GetWriteTime(vertexPath), fragmentTime = GetWriteTime(fragmentPath);
+			if (vertexTime == entry->VertexTime && fragmentTime == entry->FragmentTime)
+				continue;
+
+			std::string vertexSource, fragmentSource;
+			if (!ReadFile(vertexPath, vertexSource) || !ReadFile(fragmentPath, fragmentSource))
+				continue; // 예: 저장 중 -> 다음 확인 때 다시
+			entry->VertexTime = vertexTime;
+			entry->FragmentTime = fragmentTime;
+
+			MX_CORE_INFO("Shader changed, recompiling: {0}", entry->Name);
+			entry->ReloadStart = now;
+			entry->State.store(ReloadState::Compiling);
+			RenderThread::Submit([entry, vertexSource = std::move(vertexSource), fragmentSource = std::move(fragmentSource)]
+			{
+				entry->Pending = ShaderCache::BeginProgram(entry->Name.c_str(), vertexSource.c_str(), fragmentSource.c_str());
+			});
+		}
+	}
+
+	ShaderHandle ShaderLibrary::Load(const std::string& name)
+	{
+		auto it = s_Data.Slots.find(name);
+		if (it != s_Data.Slots.end())
+		{
+			s_Data.Entries[it->second]->RefCount++;
+			return { it->second };
+		}
+
+		uint32_t slot;
+		if (!s_Data.FreeSlots.empty())
+		{
+			slot = s_Data.FreeSlots.back();
+			s_Data.FreeSlots.pop_back();
+		}
+		else
+		{
+			slot = (uint32_t)s_Data.Entries.size();
+			s_Data.Entries.push_back(nullptr);
+		}
+
+		ShaderEntry* entry = new ShaderEntry();
+		entry->Name = name;
+		entry->RefCount = 1;
+		s_Data.Entries[slot] = entry;
+		s_Data.Slots[name] = slot;
+
+		// 없는 파일도 계속 감시: 생기면 그때 프로그램을 만듦
+		std::string vertexPath = GetPath(*entry, ".vert"), fragmentPath = GetPath(*entry, ".frag");
+		std::string vertexSource, fragmentSource;
+		if (!ReadFile(vertexPath, vertexSource) || !ReadFile(fragmentPath, fragmentSource))
+		{
+			MX_CORE_ERROR("Can't read shader: {0} ({1}, {2})", name, vertexPath, fragmentPath);
+			return { slot };
+		}
+		entry->VertexTime = GetWriteTime(vertexPath);
+		entry->FragmentTime = GetWriteTime(fragmentPath);
+
+		RenderThread::ExecuteNow([&]
+		{
+			entry->Program = ShaderCache::CreateProgram(name.c_str(), vertexSource.c_str(), fragmentSource.c_str());
+		});
+		return { slot };
+	}
+
+	void ShaderLibrary::Release(ShaderHandle handle)
+	{
+		ShaderEntry* entry = GetEntry(handle);
+		if (!entry || --entry->RefCount > 0)
+			return;
+
+		s_Data.Slots.erase(entry->Name);
+		s_Data.Entries[handle.Slot] = nullptr;
+		s_Data.FreeSlots.push_back(handle.Slot);
+		DestroyEntry(entry);
+	}
+
+	GLuint ShaderLibrary::GetProgram(ShaderHandle handle)
+	{
+		ShaderEntry* entry = GetEntry(handle);
+		return entry ? entry->Program : 0;
+	}
+
+}
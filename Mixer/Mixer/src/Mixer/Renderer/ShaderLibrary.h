@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+namespace Mixer {
+
+	struct ShaderHandle
+	{
+		uint32_t Slot = ~0u;
+
+		bool IsValid() const { return Slot != ~0u; }
+	};
+
+	// <directory>/<name>.vert + <name>.frag로 만든 프로그램. 에디터가 도는 동안 파일을 감시:
+	// 바뀌면 프레임을 멈추지 않고 렌더 스레드에서 다시 컴파일 (KHR_parallel_shader_compile이 있으면 백그라운드)
+	// 링크에 성공한 경우만 프레임 시작에 새 프로그램으로 교체, 잘못 고친 경우는 오류를 출력하고 이전 프로그램 유지
+	// 메인 스레드에서만
+	class MIXER_API ShaderLibrary
+	{
+	public:
+		static void SetDirectory(const std::string& directory); // 첫 Load 전에
+		// 레이어가 모두 사라진 뒤, RenderThread::Shutdown 전에
+		static void Shutdown();
+
+		// 프레임마다 한 번, 레이어보다 먼저: 파일 확인 (초당 몇 번) + 링크가 끝난 프로그램 교체
+		static void Update();
+
+		// 첫 프레임부터 그리므로 지금 바로 만듦 (가능하면 바이너리 캐시에서 복원)
+		// 같은 이름은 프로그램 하나를 공유, Load마다 Release 필요
+		static ShaderHandle Load(const std::string& name);
+		static void Release(ShaderHandle handle);
+
+		// 다시 불러오기에 성공하면 바뀜: 매 프레임 읽고 보관하지 말 것. 한 번도 링크되지 않았으면 0
+		static GLuint GetProgram(ShaderHandle handle);
+	};
+
+}
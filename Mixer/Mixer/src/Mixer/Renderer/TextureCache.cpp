@@ -0,0 +1,478 @@
+#include "mxpch.h"
+#include "TextureCache.h"
+#include "Mixer/JobSystem.h"
+#include "Mixer/Paths.h"
+#include "stb_image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+#ifdef _WIN32
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Mixer {
+
+	static constexpr uint32_t CacheMagic = 0x4354584D; // "MXTC"
+	static constexpr uint32_t CacheVersion = 1;        // 인코더가 바뀌면 올림
+	static constexpr uint32_t EncodeJobGroupSize = 16; // 작업 하나당 블록 행 수 (축소할 때는 픽셀 행 수)
+
+	struct CacheFileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceHash;
+		uint32_t Format;
+		uint32_t LevelCount;
+		// 뒤에 CompressedImage::Level이 LevelCount개, 그 다음 단계별 데이터 (오프셋은 파일 시작 기준)
+	};
+
+	static std::string s_Directory; // 비어 있으면 <캐시 디렉터리>/textures (첫 GetDirectory에서 결정)
+	static std::once_flag s_DirectoryResolved;
+	static std::mutex s_WriteMutex; // 내용이 같은 두 파일의 텍스처는 캐시 항목 하나를 공유
+
+	// ---- 파일 매핑 ----
+
+	struct CompressedImage::Mapping
+	{
+		const uint8_t* View = nullptr;
+		size_t Size = 0;
+#ifdef _WIN32
+		HANDLE File = INVALID_HANDLE_VALUE;
+		HANDLE MapHandle = nullptr;
+#endif
+
+		~Mapping()
+		{
+#ifdef _WIN32
+			if (View)
+				UnmapViewOfFile(View);
+			if (MapHandle)
+				CloseHandle(MapHandle);
+			if (File != INVALID_HANDLE_VALUE)
+				CloseHandle(File);
+#else
+			if (View)
+				munmap((void*)View, Size);
+#endif
+		}
+	};
+
+	static std::unique_ptr<CompressedImage::Mapping> MapFile(const std::string& path)
+	{
+		auto mapping = std::make_unique<CompressedImage::Mapping>();
+#ifdef _WIN32
+		mapping->File = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (mapping->File == INVALID_HANDLE_VALUE)
+			return nullptr;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(mapping->File, &size) || size.QuadPart == 0)
+			return nullptr;
+		mapping->Size = (size_t)size.QuadPart;
+		mapping->MapHandle = CreateFileMappingA(mapping->File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping->MapHandle)
+			return nullptr;
+		mapping->View = static_cast<const uint8_t*>(MapViewOfFile(mapping->MapHandle, FILE_MAP_READ, 0, 0, 0));
+		if (!mapping->View)
+			return nullptr;
+#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return nullptr;
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return nullptr;
+		}
+		mapping->Size = (size_t)info.st_size;
+		void* view = mmap(nullptr, mapping->Size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (view == MAP_FAILED)
+			return nullptr;
+		mapping->View = static_cast<const uint8_t*>(view);
+#endif
+		return mapping;
+	}
+
+	// ---- 블록 인코딩 ----
+
+	struct Color565
+	{
+		uint16_t Packed;
+		int R, G, B; // 다시 8비트로 늘린 값
+	};
+
+	static Color565 ToColor565(int r, int g, int b)
+	{
+		Color565 c;
+		int r5 = (r * 31 + 127) / 255, g6 = (g * 63 + 127) / 255, b5 = (b * 31 + 127) / 255;
+		c.Packed = (uint16_t)((r5 << 11) | (g6 << 5) | b5);
+		c.R = (r5 << 3) | (r5 >> 2);
+		c.G = (g6 << 2) | (g6 >> 4);
+		c.B = (b5 << 3) | (b5 >> 2);
+		return c;
+	}
+
+	// block: RGBA 픽셀 16개. 끝점은 안쪽으로 줄인 바운딩 박스에서, 4색 모드
+	static void EncodeColorBlock(const uint8_t* block, uint8_t* out)
+	{
+		int minC[3] = { 255, 255, 255 }, maxC[3] = { 0, 0, 0 };
+		for (int i = 0; i < 16; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				minC[c] = std::min(minC[c], (int)block[i * 4 + c]);
+				maxC[c] = std::max(maxC[c], (int)block[i * 4 + c]);
+			}
+		}
+		for (int c = 0; c < 3; c++)
+		{
+			int inset = (maxC[c] - minC[c]) >> 4;
+			minC[c] += inset;
+			maxC[c] -= inset;
+		}
+
+		Color565 c0 = ToColor565(maxC[0], maxC[1], maxC[2]);
+		Color565 c1 = ToColor565(minC[0], minC[1], minC[2]);
+		if (c0.Packed < c1.Packed)
+			std::swap(c0, c1);
+
+		uint32_t indices = 0;
+		if (c0.Packed != c1.Packed)
+		{
+			const int palette[4][3] = {
+				{ c0.R, c0.G, c0.B },
+				{ c1.R, c1.G, c1.B },
+				{ (2 * c0.R + c1.R) / 3, (2 * c0.G + c1.G) / 3, (2 * c0.B + c1.B) / 3 },
+				{ (c0.R + 2 * c1.R) / 3, (c0.G + 2 * c1.G) / 3, (c0.B + 2 * c1.B) / 3 }
+			};
+			for (int i = 0; i < 16; i++)
+			{
+				int best = 0, bestDistance = INT32_MAX;
+				for (int p = 0; p < 4; p++)
+				{
+					int dr = block[i * 4 + 0] - palette[p][0];
+					int dg = block[i * 4 + 1] - palette[p][1];
+					int db = block[i * 4 + 2] - palette[p][2];
+					int distance = dr * dr + dg * dg + db * db;
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= (uint32_t)best << (i * 2);
+			}
+		}
+
+		std::memcpy(out, &c0.Packed, 2);
+		std::memcpy(out + 2, &c1.Packed, 2);
+		std::memcpy(out + 4, &indices, 4);
+	}
+
+	// 8값 모드 (a0 > a1), 3비트 인덱스
+	static void EncodeAlphaBlock(const uint8_t* block, uint8_t* out)
+	{
+		int a0 = 0, a1 = 255;
+		for (int i = 0; i < 16; i++)
+		{
+			a0 = std::max(a0, (int)block[i * 4 + 3]);
+			a1 = std::min(a1, (int)block[i * 4 + 3]);
+		}
+
+		uint64_t indices = 0;
+		if (a0 != a1)
+		{
+			int palette[8] = { a0, a1 };
+			for (int p = 1; p < 7; p++)
+				palette[p + 1] = ((7 - p) * a0 + p * a1) / 7;
+			for (int i = 0; i < 16; i++)
+			{
+				int alpha = block[i * 4 + 3];
+				int best = 0, bestDistance = INT32_MAX;
+				for (int p = 0; p < 8; p++)
+				{
+					int distance = std::abs(alpha - palette[p]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= (uint64_t)best << (i * 3);
+			}
+		}
+
+		out[0] = (uint8_t)a0;
+		out[1] = (uint8_t)a1;
+		for (int i = 0; i < 6; i++)
+			out[2 + i] = (uint8_t)(indices >> (i * 8));
+	}
+
+	// 한 단계의 블록 행 [firstBlockRow, endBlockRow). out은 그 단계의 시작
+	static void EncodeLevel(const uint8_t* pixels, uint32_t width, uint32_t height, bool alpha,
+		uint32_t firstBlockRow, uint32_t endBlockRow, uint8_t* out)
+	{
+		size_t blockBytes = alpha ? 16 : 8;
+		out += (size_t)firstBlockRow * ((width + 3) / 4) * blockBytes;
+
+		uint8_t block[16 * 4];
+		for (uint32_t by = firstBlockRow * 4; by < endBlockRow * 4; by += 4)
+		{
+			for (uint32_t bx = 0; bx < width; bx += 4)
+			{
+				// 가장자리 블록은 마지막 행/열을 반복
+				for (uint32_t y = 0; y < 4; y++)
+				{
+					uint32_t sy = std::min(by + y, height - 1);
+					for (uint32_t x = 0; x < 4; x++)
+					{
+						uint32_t sx = std::min(bx + x, width - 1);
+						std::memcpy(block + (y * 4 + x) * 4, pixels + ((size_t)sy * width + sx) * 4, 4);
+					}
+				}
+
+				if (alpha)
+				{
+					EncodeAlphaBlock(block, out);
+					out += 8;
+				}
+				EncodeColorBlock(block, out);
+				out += 8;
+			}
+		}
+	}
+
+	// 2x2 박스 필터 (홀수 가장자리는 반복), 출력 행 [firstRow, endRow)
+	static void Downsample(const uint8_t* source, uint32_t width, uint32_t height, uint8_t* out, uint32_t outWidth,
+		uint32_t firstRow, uint32_t endRow)
+	{
+		for (uint32_t y = firstRow; y < endRow; y++)
+		{
+			uint32_t y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+			for (uint32_t x = 0; x < outWidth; x++)
+			{
+				uint32_t x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+				for (int c = 0; c < 4; c++)
+				{
+					int sum = source[((size_t)y0 * width + x0) * 4 + c] + source[((size_t)y0 * width + x1) * 4 + c]
+						+ source[((size_t)y1 * width + x0) * 4 + c] + source[((size_t)y1 * width + x1) * 4 + c];
+					out[((size_t)y * outWidth + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+				}
+			}
+		}
+	}
+
+	// ---- 캐시 ----
+
+	static uint64_t HashBytes(const uint8_t* bytes, size_t size)
+	{
+		uint64_t hash = 14695981039346656037ull ^ CacheVersion; // FNV-1a
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	// 원본 파일마다 항목 이름 하나: <stem>-<경로 해시> -> 원본이 바뀌면 옛 항목을 대체
+	static std::string GetEntryName(const std::string& path)
+	{
+		char pathHash[16];
+		std::snprintf(pathHash, sizeof(pathHash), "%08x", (uint32_t)HashBytes((const uint8_t*)path.data(), path.size()));
+		return std::filesystem::path(path).stem().string() + "-" + pathHash;
+	}
+
+	static bool ReadFile(const std::string& path, std::vector<uint8_t>& bytes)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+			return false;
+		bytes.resize((size_t)file.tellg());
+		file.seekg(0);
+		return (bool)file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+	}
+
+	// 헤더와 단계 표를 파일 크기와 대조해서 검사
+	static bool ParseLevels(const uint8_t* data, size_t size, uint64_t sourceHash, GLenum& format, std::vector<CompressedImage::Level>& levels)
+	{
+		if (size < sizeof(CacheFileHeader))
+			return false;
+		CacheFileHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if (header.Magic != CacheMagic || header.Version != CacheVersion || header.SourceHash != sourceHash || header.LevelCount == 0 || header.LevelCount > 32)
+			return false;
+		if (header.Format != GL_COMPRESSED_RGB_S3TC_DXT1_EXT && header.Format != GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+			return false;
+
+		size_t tableEnd = sizeof(CacheFileHeader) + header.LevelCount * sizeof(CompressedImage::Level);
+		if (size < tableEnd)
+			return false;
+		levels.resize(header.LevelCount);
+		std::memcpy(levels.data(), data + sizeof(CacheFileHeader), header.LevelCount * sizeof(CompressedImage::Level));
+		for (const auto& level : levels)
+		{
+			if (level.Offset < tableEnd || level.Offset > size || level.Size > size - level.Offset)
+				return false;
+		}
+		format = header.Format;
+		return true;
+	}
+
+	// storage는 캐시 파일과 바이트 단위로 같음: 헤더, 단계 표, 단계별 데이터
+	static void Encode(const uint8_t* pixels, uint32_t width, uint32_t height, uint64_t sourceHash,
+		GLenum& format, std::vector<CompressedImage::Level>& levels, std::vector<uint8_t>& storageBytes)
+	{
+		bool alpha = false;
+		for (size_t i = 0; i < (size_t)width * height && !alpha; i++)
+			alpha = pixels[i * 4 + 3] != 255;
+		size_t blockBytes = alpha ? 16 : 8;
+
+		levels.clear();
+		for (uint32_t w = width, h = height;; w = std::max(w / 2, 1u), h = std::max(h / 2, 1u))
+		{
+			levels.push_back({ w, h, 0, (uint64_t)((w + 3) / 4) * ((h + 3) / 4) * blockBytes });
+			if (w == 1 && h == 1)
+				break;
+		}
+		uint64_t offset = sizeof(CacheFileHeader) + levels.size() * sizeof(CompressedImage::Level);
+		for (auto& level : levels)
+		{
+			level.Offset = offset;
+			offset += level.Size;
+		}
+
+		format = alpha ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		storageBytes.resize((size_t)offset);
+		uint8_t* storage = storageBytes.data();
+
+		CacheFileHeader header = { CacheMagic, CacheVersion, sourceHash, format, (uint32_t)levels.size() };
+		std::memcpy(storage, &header, sizeof(header));
+		std::memcpy(storage + sizeof(header), levels.data(), levels.size() * sizeof(CompressedImage::Level));
+
+		// 밉 체인: 각 단계는 이전 단계에서. 큰 이미지가 긴 작업 하나가 아니라 짧은 작업 여러 개가 되게 행을 나눔
+		// (디코딩 작업 안에서 실행됨, Wait는 이 작업들만 도움)
+		std::vector<uint8_t> current(pixels, pixels + (size_t)width * height * 4), next;
+		for (size_t i = 0; i < levels.size(); i++)
+		{
+			const CompressedImage::Level& level = levels[i];
+			if (i > 0)
+			{
+				const CompressedImage::Level& previous = levels[i - 1];
+				next.resize((size_t)level.Width * level.Height * 4);
+				JobContext context;
+				JobSystem::Dispatch(context, level.Height, EncodeJobGroupSize * 4, [&](uint32_t begin, uint32_t end)
+				{
+					Downsample(current.data(), previous.Width, previous.Height, next.data(), level.Width, begin, end);
+				});
+				JobSystem::Wait(context);
+				current.swap(next);
+			}
+
+			JobContext context;
+			JobSystem::Dispatch(context, (level.Height + 3) / 4, EncodeJobGroupSize, [&](uint32_t begin, uint32_t end)
+			{
+				EncodeLevel(current.data(), level.Width, level.Height, alpha, begin, end, storage + level.Offset);
+			});
+			JobSystem::Wait(context);
+		}
+	}
+
+	CompressedImage::~CompressedImage() = default;
+
+	void TextureCache::SetDirectory(const std::string& directory)
+	{
+		s_Directory = directory;
+	}
+
+	const std::string& TextureCache::GetDirectory()
+	{
+		std::call_once(s_DirectoryResolved, []
+		{
+			if (s_Directory.empty())
+				s_Directory = Paths::GetCacheDirectory() + "/textures";
+		});
+		return s_Directory;
+	}
+
+	TextureCacheResult TextureCache::Load(const std::string& path)
+	{
+		TextureCacheResult result;
+
+		std::vector<uint8_t> source;
+		if (!ReadFile(path, source))
+		{
+			result.FailureReason = "can't open file";
+			return result;
+		}
+		uint64_t hash = HashBytes(source.data(), source.size());
+		const std::string& directory = GetDirectory();
+		std::string entryName = GetEntryName(path);
+		char key[32];
+		std::snprintf(key, sizeof(key), "-%016llx.mxtex", (unsigned long long)hash);
+		std::string cachePath = directory + "/" + entryName + key;
+
+		// 1. 있음: 파일을 매핑, 단계별 데이터는 그 안을 바로 가리킴
+		if (auto mapping = MapFile(cachePath))
+		{
+			auto image = std::make_unique<CompressedImage>();
+			if (ParseLevels(mapping->View, mapping->Size, hash, image->m_Format, image->m_Levels))
+			{
+				image->m_Data = mapping->View;
+				image->m_Mapping = std::move(mapping);
+				result.Image = std::move(image);
+				result.FromCache = true;
+				return result;
+			}
+			MX_CORE_WARN("Texture cache entry is stale or corrupt, rebuilding: {0}", cachePath);
+		}
+
+		// 2. 없음: 디코딩, 단계마다 인코딩, 저장
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load_thread(1); // OpenGL: 첫 행이 맨 아래
+		unsigned char* pixels = stbi_load_from_memory(source.data(), (int)source.size(), &width, &height, &channels, 4); // RGBA
+		if (!pixels)
+		{
+			result.FailureReason = stbi_failure_reason();
+			return result;
+		}
+		auto image = std::make_unique<CompressedImage>();
+		Encode(pixels, (uint32_t)width, (uint32_t)height, hash, image->m_Format, image->m_Levels, image->m_Storage);
+		image->m_Data = image->m_Storage.data();
+		result.Image = std::move(image);
+		stbi_image_free(pixels);
+
+		std::lock_guard<std::mutex> lock(s_WriteMutex);
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		std::string temporaryPath = cachePath + ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			const std::vector<uint8_t>& bytes = result.Image->m_Storage;
+			if (!file || !file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()))
+			{
+				MX_CORE_WARN("Can't write texture cache: {0}", temporaryPath);
+				return result;
+			}
+		}
+		std::filesystem::rename(temporaryPath, cachePath, error); // 읽는 쪽은 덜 쓴 파일을 보지 않음
+		if (error)
+		{
+			std::filesystem::remove(temporaryPath, error);
+			return result;
+		}
+		Paths::RemoveStaleEntries(directory, entryName, ".mxtex", cachePath); // 원본의 이전 내용
+		return result;
+	}
+
+}
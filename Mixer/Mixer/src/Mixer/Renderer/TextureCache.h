@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// GL_EXT_texture_compression_s3tc (생성된 로더에 없음)
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+	#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+	#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace Mixer {
+
+	// 밉 체인 전체를 가진 블록 압축 이미지 (캐시 파일을 메모리 매핑했거나 방금 인코딩한 것)
+	// 단계별 데이터는 객체가 살아 있는 동안 유효
+	class MIXER_API CompressedImage
+	{
+	public:
+		struct Mapping; // 캐시 파일의 읽기 전용 매핑
+
+		struct Level
+		{
+			uint32_t Width;
+			uint32_t Height;
+			uint64_t Offset; // GetData() 기준
+			uint64_t Size;
+		};
+
+		~CompressedImage();
+
+		GLenum GetFormat() const { return m_Format; }
+		uint32_t GetWidth() const { return m_Levels.empty() ? 0 : m_Levels[0].Width; }
+		uint32_t GetHeight() const { return m_Levels.empty() ? 0 : m_Levels[0].Height; }
+		const std::vector<Level>& GetLevels() const { return m_Levels; }
+		const uint8_t* GetData() const { return m_Data; }
+		const char* GetFormatName() const { return m_Format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ? "BC1" : "BC3"; }
+
+	private:
+		friend class TextureCache;
+
+		GLenum m_Format = 0;
+		std::vector<Level> m_Levels;
+		const uint8_t* m_Data = nullptr;
+		std::vector<uint8_t> m_Storage;      // 방금 인코딩한 경우
+		std::unique_ptr<Mapping> m_Mapping;  // 또는 캐시에서 매핑한 경우
+	};
+
+	struct TextureCacheResult
+	{
+		std::unique_ptr<CompressedImage> Image; // null: 원본을 읽거나 디코딩하지 못함
+		bool FromCache = false;
+		const char* FailureReason = nullptr;
+	};
+
+	// 원본 파일 내용의 해시를 키로 하는 블록 압축 텍스처 디스크 캐시
+	// 없으면: 원본 디코딩 -> 밉 체인 생성 -> 단계마다 인코딩 (완전 불투명이면 BC1, 아니면 BC3. 행을 작업으로 나눔)
+	// -> <directory>/<stem>-<경로 해시>-<해시>.mxtex로 저장하고 같은 파일의 옛 해시 항목은 삭제
+	// 있으면: 그 파일을 매핑해서 단계별 데이터를 바로 업로드로 넘김. Load는 스레드 안전 (디코딩 작업에서 호출)
+	class MIXER_API TextureCache
+	{
+	public:
+		// 기본값: <Paths::GetCacheDirectory()>/textures
+		static void SetDirectory(const std::string& directory); // 첫 Load 전에
+		static const std::string& GetDirectory();
+
+		// 압축하지 않는 경로와 같이 위아래를 뒤집음 (첫 행 = 맨 아래)
+		static TextureCacheResult Load(const std::string& path);
+	};
+
+}
@@ -0,0 +1,467 @@
+#include "mxpch.h"
+#include "TextureManager.h"
+#include "Mixer/JobSystem.h"
+#include "Mixer/MemoryTracker.h"
+#include "Mixer/StartupTimeline.h"
+#include "Mixer/Renderer/RenderThread.h"
+#include "Mixer/Renderer/TextureCache.h"
+#include "stb_image.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+
+namespace Mixer {
+
+	static constexpr size_t DefaultUploadBudget = 4 * 1024 * 1024;
+
+	enum class TextureState : uint8_t
+	{
+		Decoding,
+		Uploading,
+		Ready,
+		Failed
+	};
+
+	struct TextureEntry
+	{
+		std::string Path;
+		uint32_t RefCount = 0;
+		TextureState State = TextureState::Decoding;
+		std::chrono::steady_clock::time_point RequestTime;
+
+		// 디코딩 작업이 쓰고, 작업이 끝나면 메인 스레드가 읽음
+		// 업로드가 시작되면 Pixels나 Compressed는 렌더 스레드 소유
+		JobContext Decode;
+		unsigned char* Pixels = nullptr;              // RGBA8, 맨 아래 행부터
+		std::unique_ptr<CompressedImage> Compressed;  // 블록 압축을 지원하면 Pixels 대신
+		bool FromCache = false;
+		const char* FormatName = "RGBA8";
+		float DecodeMs = 0.0f;
+		const char* FailureReason = nullptr;
+		int Width = 0;
+		int Height = 0;
+
+		int UploadedRows = 0;           // RGBA8
+		size_t UploadedLevels = 0;      // 압축: 다 올린 단계 수
+		uint32_t UploadedBlockRows = 0; // + 다음 단계에서 올린 블록 행 수
+		std::atomic<GLuint> RendererID{ 0 }; // 렌더 스레드가 첫 행을 올릴 때 생성
+	};
+
+	struct TextureManagerData
+	{
+		std::vector<TextureEntry*> Entries; // TextureHandle::Slot 번호로
+		std::vector<uint32_t> FreeSlots;
+		std::unordered_map<std::string, uint32_t> Slots;
+		std::vector<uint32_t> Decoding;
+		std::deque<uint32_t> UploadQueue;
+		size_t UploadBudget = DefaultUploadBudget;
+
+		GLuint Placeholder = 0;
+		GLuint PixelBuffer = 0; // 조각마다 새로 할당 (orphan)
+		bool CompressionSupported = false; // GL_EXT_texture_compression_s3tc
+		bool Initialized = false;
+
+		// 한가할 때 요청된 불러오기들, 마지막 것이 준비되면 한꺼번에 로그 (캐시 없는 시작과 있는 시작 비교)
+		std::chrono::steady_clock::time_point BatchStart;
+		uint32_t BatchCount = 0;
+		uint32_t BatchCacheHits = 0;
+	};
+
+	static TextureManagerData s_Data;
+
+	static void SetTextureParameters()
+	{
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+
+	// 렌더 스레드
+	static void UploadRows(TextureEntry* entry, GLuint pixelBuffer, int firstRow, int rowCount)
+	{
+		size_t rowBytes = (size_t)entry->Width * 4;
+		size_t bytes = rowBytes * rowCount;
+
+		if (firstRow == 0)
+		{
+			GLuint id;
+			glGenTextures(1, &id);
+			glBindTexture(GL_TEXTURE_2D, id);
+			SetTextureParameters();
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, entry->Width, entry->Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			entry->RendererID.store(id);
+		}
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_DRAW); // orphan: 이전 조각을 기다리지 않음
+		MemoryTracker::SetGPUBufferSize(pixelBuffer, bytes);
+		void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if (mapped)
+		{
+			std::memcpy(mapped, entry->Pixels + rowBytes * firstRow, bytes);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+			glBindTexture(GL_TEXTURE_2D, entry->RendererID.load());
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, entry->Width, rowCount, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+		if (firstRow + rowCount == entry->Height)
+		{
+			glGenerateMipmap(GL_TEXTURE_2D);
+			stbi_image_free(entry->Pixels);
+			entry->Pixels = nullptr;
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	// 렌더 스레드. 한 단계의 조각 하나 = 4x4 블록 blockRowCount행. 단계는 첫 조각에서 할당하므로 가장 큰 단계라도
+	// 프레임마다 예산 이상은 올리지 않음. 이미지는 마지막 단계의 마지막 조각 뒤에 해제 (또는 매핑 해제)
+	static void UploadBlockRows(TextureEntry* entry, GLuint pixelBuffer, size_t level, uint32_t firstBlockRow, uint32_t blockRowCount)
+	{
+		const CompressedImage& image = *entry->Compressed;
+		const auto& levels = image.GetLevels();
+		const CompressedImage::Level& info = levels[level];
+		uint32_t blockRows = (info.Height + 3) / 4;
+		size_t blockRowBytes = (size_t)(info.Size / blockRows);
+
+		if (level == 0 && firstBlockRow == 0)
+		{
+			GLuint id;
+			glGenTextures(1, &id);
+			glBindTexture(GL_TEXTURE_2D, id);
+			SetTextureParameters();
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)levels.size() - 1);
+			entry->RendererID.store(id);
+		}
+		glBindTexture(GL_TEXTURE_2D, entry->RendererID.load());
+		if (firstBlockRow == 0) // 언팩 버퍼 없이 데이터도 없이: 단계 할당만
+			glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)level, image.GetFormat(), info.Width, info.Height, 0, (GLsizei)info.Size, nullptr);
+
+		size_t bytes = blockRowBytes * blockRowCount;
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_DRAW);
+		MemoryTracker::SetGPUBufferSize(pixelBuffer, bytes);
+		void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if (mapped)
+		{
+			std::memcpy(mapped, image.GetData() + info.Offset + blockRowBytes * firstBlockRow, bytes);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+			// 높이는 단계 가장자리에서 끝나는 조각 말고는 4의 배수
+			uint32_t y = firstBlockRow * 4;
+			uint32_t height = std::min(blockRowCount * 4, info.Height - y);
+			glCompressedTexSubImage2D(GL_TEXTURE_2D, (GLint)level, 0, (GLint)y, info.Width, height, image.GetFormat(), (GLsizei)bytes, nullptr);
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		if (level + 1 == levels.size() && firstBlockRow + blockRowCount == blockRows)
+			entry->Compressed.reset();
+	}
+
+	static TextureEntry* GetEntry(TextureHandle handle)
+	{
+		if (!handle.IsValid() || handle.Slot >= s_Data.Entries.size())
+			return nullptr;
+		return s_Data.Entries[handle.Slot];
+	}
+
+	void TextureManager::Init()
+	{
+		if (s_Data.Initialized)
+			return;
+
+		RenderThread::ExecuteNow([]
+		{
+			// 어두운 회색 체커: 이미지 뒤에서는 보이고, 오버레이 뒤에서는 눈에 띄지 않게
+			const uint32_t light = 0x40999999, dark = 0x40666666; // ABGR
+			const uint32_t pixels[4] = { light, dark, dark, light };
+			glGenTextures(1, &s_Data.Placeholder);
+			glBindTexture(GL_TEXTURE_2D, s_Data.Placeholder);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+			glBindTexture(GL_TEXTURE_2D, 0);
+
+			glGenBuffers(1, &s_Data.PixelBuffer);
+
+			GLint extensionCount = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+			for (GLint i = 0; i < extensionCount; i++)
+			{
+				const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+				if (extension && std::strcmp(extension, "GL_EXT_texture_compression_s3tc") == 0)
+					s_Data.CompressionSupported = true;
+			}
+		});
+		if (!s_Data.CompressionSupported)
+			MX_CORE_WARN("S3TC not supported: textures are uploaded uncompressed and not cached");
+		s_Data.Initialized = true;
+	}
+
+	void TextureManager::Shutdown()
+	{
+		if (!s_Data.Initialized)
+			return;
+
+		for (size_t slot = 0; slot < s_Data.Entries.size(); slot++)
+		{
+			TextureEntry* entry = s_Data.Entries[slot];
+			if (!entry)
+				continue;
+			if (entry->RefCount > 0)
+				MX_CORE_WARN("Texture still referenced at shutdown: {0}", entry->Path);
+			JobSystem::Wait(entry->Decode);
+		}
+
+		// 이미 제출한 업로드 뒤에
+		RenderThread::Submit([entries = std::move(s_Data.Entries), placeholder = s_Data.Placeholder, pixelBuffer = s_Data.PixelBuffer]
+		{
+			for (TextureEntry* entry : entries)
+			{
+				if (!entry)
+					continue;
+				GLuint id = entry->RendererID.load();
+				if (id)
+					glDeleteTextures(1, &id);
+				if (entry->Pixels)
+					stbi_image_free(entry->Pixels);
+				delete entry;
+			}
+			glDeleteTextures(1, &placeholder);
+			MemoryTracker::ReleaseGPUBuffer(pixelBuffer);
+			glDeleteBuffers(1, &pixelBuffer);
+		});
+
+		s_Data.Entries.clear();
+		s_Data.FreeSlots.clear();
+		s_Data.Slots.clear();
+		s_Data.Decoding.clear();
+		s_Data.UploadQueue.clear();
+		s_Data.Initialized = false;
+	}
+
+	void TextureManager::Update()
+	{
+		// 1. 디코딩이 끝난 것은 업로드 대기열로 (그사이 Release됐으면 해제)
+		for (size_t i = 0; i < s_Data.Decoding.size();)
+		{
+			uint32_t slot = s_Data.Decoding[i];
+			TextureEntry* entry = s_Data.Entries[slot];
+			if (JobSystem::IsBusy(entry->Decode))
+			{
+				i++;
+				continue;
+			}
+			s_Data.Decoding[i] = s_Data.Decoding.back();
+			s_Data.Decoding.pop_back();
+
+			if (entry->RefCount == 0)
+			{
+				if (entry->Pixels)
+					stbi_image_free(entry->Pixels);
+				delete entry;
+				s_Data.Entries[slot] = nullptr;
+				s_Data.FreeSlots.push_back(slot);
+				continue;
+			}
+
+			if (!entry->Pixels && !entry->Compressed)
+			{
+				entry->State = TextureState::Failed;
+				MX_CORE_ERROR("Failed to load texture: {0} ({1})", entry->Path, entry->FailureReason ? entry->FailureReason : "unknown");
+				continue;
+			}
+			entry->State = TextureState::Uploading;
+			s_Data.UploadQueue.push_back(slot);
+			if (entry->FromCache)
+				s_Data.BatchCacheHits++;
+		}
+
+		// 2. 이번 프레임 예산이 다 될 때까지 순서대로 업로드 (프레임마다 적어도 한 행 또는 블록 한 행)
+		size_t budget = s_Data.UploadBudget;
+		while (!s_Data.UploadQueue.empty() && budget > 0)
+		{
+			TextureEntry* entry = s_Data.Entries[s_Data.UploadQueue.front()];
+			GLuint pixelBuffer = s_Data.PixelBuffer;
+			bool done;
+			if (entry->Compressed)
+			{
+				// 마지막 조각과 함께 렌더 스레드가 이미지를 해제 -> 그 Submit 뒤에는 건드리지 말 것
+				const CompressedImage::Level& info = entry->Compressed->GetLevels()[entry->UploadedLevels];
+				size_t totalLevels = entry->Compressed->GetLevels().size();
+				uint32_t blockRows = (info.Height + 3) / 4;
+				size_t blockRowBytes = (size_t)(info.Size / blockRows);
+				uint32_t count = (uint32_t)std::min<size_t>(std::max<size_t>(budget / blockRowBytes, 1), blockRows - entry->UploadedBlockRows);
+
+				size_t level = entry->UploadedLevels;
+				uint32_t firstBlockRow = entry->UploadedBlockRows;
+				RenderThread::Submit([entry, pixelBuffer, level, firstBlockRow, count] { UploadBlockRows(entry, pixelBuffer, level, firstBlockRow, count); });
+				entry->UploadedBlockRows += count;
+				if (entry->UploadedBlockRows == blockRows)
+				{
+					entry->UploadedLevels++;
+					entry->UploadedBlockRows = 0;
+				}
+				budget -= std::min(budget, blockRowBytes * count);
+				done = entry->UploadedLevels == totalLevels;
+			}
+			else
+			{
+				size_t rowBytes = (size_t)entry->Width * 4;
+				int rows = (int)std::max<size_t>(budget / rowBytes, 1);
+				rows = std::min(rows, entry->Height - entry->UploadedRows);
+
+				int firstRow = entry->UploadedRows;
+				RenderThread::Submit([entry, pixelBuffer, firstRow, rows] { UploadRows(entry, pixelBuffer, firstRow, rows); });
+				entry->UploadedRows += rows;
+				budget -= std::min(budget, rowBytes * rows);
+				done = entry->UploadedRows == entry->Height;
+			}
+
+			if (done)
+			{
+				entry->State = TextureState::Ready;
+				s_Data.UploadQueue.pop_front();
+				float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - entry->RequestTime).count();
+				const char* format = entry->FormatName;
+				const char* source = !s_Data.CompressionSupported ? "uncompressed" : entry->FromCache ? "cache hit" : "transcoded";
+				MX_CORE_INFO("Texture loaded: {0} ({1}x{2} {3}, {4}, decode {5:.1f} ms, total {6:.1f} ms)",
+					entry->Path, entry->Width, entry->Height, format, source, entry->DecodeMs, ms);
+			}
+		}
+
+		// 3. 시작 / 묶음 시간: 캐시 없는 실행 (변환)과 캐시 있는 실행 (매핑)을 비교
+		if (s_Data.BatchCount > 0 && s_Data.Decoding.empty() && s_Data.UploadQueue.empty())
+		{
+			float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - s_Data.BatchStart).count();
+			MX_CORE_INFO("Textures ready: {0} in {1:.1f} ms ({2} from disk cache)", s_Data.BatchCount, ms, s_Data.BatchCacheHits);
+			StartupTimeline::Mark("textures ready"); // 첫 프레임 뒤에는 무시됨
+			s_Data.BatchCount = 0;
+			s_Data.BatchCacheHits = 0;
+		}
+	}
+
+	void TextureManager::SetUploadBudget(size_t bytesPerFrame)
+	{
+		s_Data.UploadBudget = bytesPerFrame;
+	}
+
+	TextureHandle TextureManager::Load(const std::string& path)
+	{
+		auto it = s_Data.Slots.find(path);
+		if (it != s_Data.Slots.end())
+		{
+			s_Data.Entries[it->second]->RefCount++;
+			return { it->second };
+		}
+
+		uint32_t slot;
+		if (!s_Data.FreeSlots.empty())
+		{
+			slot = s_Data.FreeSlots.back();
+			s_Data.FreeSlots.pop_back();
+		}
+		else
+		{
+			slot = (uint32_t)s_Data.Entries.size();
+			s_Data.Entries.push_back(nullptr);
+		}
+
+		TextureEntry* entry = new TextureEntry();
+		entry->Path = path;
+		entry->RefCount = 1;
+		entry->RequestTime = std::chrono::steady_clock::now();
+		if (s_Data.BatchCount++ == 0)
+			s_Data.BatchStart = entry->RequestTime;
+		s_Data.Entries[slot] = entry;
+		s_Data.Slots[path] = slot;
+		s_Data.Decoding.push_back(slot);
+
+		bool compress = s_Data.CompressionSupported;
+		JobSystem::Execute(entry->Decode, [entry, compress]
+		{
+			auto start = std::chrono::steady_clock::now();
+			if (compress)
+			{
+				TextureCacheResult result = TextureCache::Load(entry->Path);
+				entry->Compressed = std::move(result.Image);
+				entry->FromCache = result.FromCache;
+				entry->FailureReason = result.FailureReason;
+				if (entry->Compressed)
+				{
+					entry->Width = (int)entry->Compressed->GetWidth();
+					entry->Height = (int)entry->Compressed->GetHeight();
+					entry->FormatName = entry->Compressed->GetFormatName();
+				}
+			}
+			else
+			{
+				stbi_set_flip_vertically_on_load_thread(1); // OpenGL: 첫 행이 맨 아래
+				int channels;
+				entry->Pixels = stbi_load(entry->Path.c_str(), &entry->Width, &entry->Height, &channels, 4); // RGBA
+				if (!entry->Pixels)
+					entry->FailureReason = stbi_failure_reason();
+			}
+			entry->DecodeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		});
+		return { slot };
+	}
+
+	void TextureManager::Release(TextureHandle handle)
+	{
+		TextureEntry* entry = GetEntry(handle);
+		if (!entry || entry->RefCount == 0 || --entry->RefCount > 0)
+			return;
+
+		s_Data.Slots.erase(entry->Path);
+		if (entry->State == TextureState::Decoding)
+			return; // 작업이 끝나면 Update가 해제
+
+		if (entry->State == TextureState::Uploading)
+			s_Data.UploadQueue.erase(std::find(s_Data.UploadQueue.begin(), s_Data.UploadQueue.end(), handle.Slot));
+
+		// 이미 제출한 업로드와 그리기 뒤에
+		RenderThread::Submit([entry]
+		{
+			GLuint id = entry->RendererID.load();
+			if (id)
+				glDeleteTextures(1, &id);
+			if (entry->Pixels)
+				stbi_image_free(entry->Pixels);
+			delete entry;
+		});
+		s_Data.Entries[handle.Slot] = nullptr;
+		s_Data.FreeSlots.push_back(handle.Slot);
+	}
+
+	bool TextureManager::IsReady(TextureHandle handle)
+	{
+		TextureEntry* entry = GetEntry(handle);
+		return entry && entry->State == TextureState::Ready && entry->RendererID.load() != 0;
+	}
+
+	int TextureManager::GetWidth(TextureHandle handle)
+	{
+		TextureEntry* entry = GetEntry(handle);
+		return entry && entry->State != TextureState::Decoding ? entry->Width : 0;
+	}
+
+	int TextureManager::GetHeight(TextureHandle handle)
+	{
+		TextureEntry* entry = GetEntry(handle);
+		return entry && entry->State != TextureState::Decoding ? entry->Height : 0;
+	}
+
+	GLuint TextureManager::GetRendererID(TextureHandle handle)
+	{
+		// 이름은 렌더 스레드가 첫 행을 실행한 뒤에 생김. 나머지 행은 이 텍스처를 쓰는 그리기보다 먼저 이미 대기 중
+		return IsReady(handle) ? s_Data.Entries[handle.Slot]->RendererID.load() : s_Data.Placeholder;
+	}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Mixer {
+
+	struct TextureHandle
+	{
+		uint32_t Slot = ~0u;
+
+		bool IsValid() const { return Slot != ~0u; }
+	};
+
+	// 경로를 키로 하는 텍스처 캐시. Load는 바로 돌아옴: 파일은 작업에서 디코딩하고, 픽셀은 프레임당 바이트 예산 안에서
+	// 몇 행씩 (밉 단계의 블록 행씩) 픽셀 언팩 버퍼로 GL에 올림 -> 큰 참고 이미지를 열어도 프레임이 멈추지 않음
+	// 업로드가 끝날 때까지 GetRendererID는 대체 텍스처를 돌려주므로 패킷은 바로 텍스처를 쓸 수 있음
+	// S3TC를 지원하면 작업은 TextureCache를 거침 (디스크에서 매핑한 블록 압축 밉)
+	// 업로드 자체를 빼고는 전부 메인 스레드에서만
+	class MIXER_API TextureManager
+	{
+	public:
+		// RenderThread::Init 뒤에 (대체 텍스처와 언팩 버퍼 생성)
+		static void Init();
+		// 레이어가 모두 사라진 뒤, RenderThread::Shutdown 전에
+		static void Shutdown();
+
+		// 프레임마다 한 번, 레이어보다 먼저: 끝난 디코딩을 받아서 이번 프레임 업로드를 제출
+		static void Update();
+		static void SetUploadBudget(size_t bytesPerFrame);
+
+		// 같은 경로는 텍스처 하나를 공유, Load마다 Release 필요
+		static TextureHandle Load(const std::string& path);
+		static void Release(TextureHandle handle);
+
+		static bool IsReady(TextureHandle handle);
+		// 디코딩 전에는 0
+		static int GetWidth(TextureHandle handle);
+		static int GetHeight(TextureHandle handle);
+		// 준비될 때까지 (그리고 불러오기에 실패한 파일은 계속) 대체 텍스처
+		static GLuint GetRendererID(TextureHandle handle);
+	};
+
+}
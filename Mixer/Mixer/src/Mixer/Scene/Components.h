@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Mixer/ECS/Registry.h"
+
+#include <glm/glm.hpp>
+
+namespace Mixer {
+
+	// 씬 오브젝트 컴포넌트 (ID는 Registry의 비트 번호, 겹치면 안 됨)
+
+	// 부모 기준 트랜스폼 + 계산된 월드 행렬. Depth 순서로 갱신 (부모가 먼저)
+	struct TransformComponent
+	{
+		static constexpr uint32_t ID = 0;
+
+		glm::mat4 Local = glm::mat4(1.0f);
+		glm::mat4 World = glm::mat4(1.0f);
+		Entity Parent = NullEntity;
+		uint32_t Depth = 0;     // 루트 = 0
+		uint8_t Dirty = 1;      // 이번 Update에서 다시 계산 (자식에게 전파)
+	};
+
+	// 그릴 메쉬 (Scene 메쉬 목록의 번호). 없으면 그룹 오브젝트
+	struct MeshComponent
+	{
+		static constexpr uint32_t ID = 1;
+
+		uint32_t Mesh = 0;
+	};
+
+	// 월드 AABB. Slot은 메쉬 있는 오브젝트끼리 0..n-1 (TLAS 항목 번호, 렌더러 컬링 배열 번호)
+	struct BoundsComponent
+	{
+		static constexpr uint32_t ID = 2;
+
+		glm::vec3 Min = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 Max = { 0.0f, 0.0f, 0.0f };
+		uint32_t Slot = 0;
+	};
+
+	// 선택 표시 (태그)
+	struct SelectedComponent
+	{
+		static constexpr uint32_t ID = 3;
+
+		uint8_t Unused = 0;
+	};
+}
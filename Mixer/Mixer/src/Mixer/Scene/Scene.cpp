@@ -0,0 +1,226 @@
+#include "mxpch.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Mixer {
+
+	uint32_t Scene::AddMesh(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices)
+	{
+		SceneMesh mesh;
+		mesh.Vertices = vertices;
+		mesh.Indices = indices;
+		if (!vertices.empty())
+		{
+			mesh.BoundsMin = glm::vec3(FLT_MAX);
+			mesh.BoundsMax = glm::vec3(-FLT_MAX);
+			for (const auto& p : vertices)
+			{
+				mesh.BoundsMin = glm::min(mesh.BoundsMin, p);
+				mesh.BoundsMax = glm::max(mesh.BoundsMax, p);
+			}
+		}
+
+		m_Meshes.push_back(std::move(mesh));
+		return (uint32_t)m_Meshes.size() - 1;
+	}
+
+	Entity Scene::CreateObject(uint32_t mesh, const glm::mat4& localTransform, Entity parent)
+	{
+		TransformComponent transform;
+		transform.Local = localTransform;
+		transform.World = localTransform;
+		if (m_Registry.Has<TransformComponent>(parent))
+		{
+			transform.Parent = parent;
+			transform.Depth = m_Registry.Get<TransformComponent>(parent).Depth + 1;
+			m_MaxDepth = std::max(m_MaxDepth, transform.Depth);
+		}
+
+		Entity object = m_Registry.Create();
+		m_Registry.Add(object, transform);
+		if (mesh != None)
+		{
+			m_Registry.Add(object, MeshComponent{ mesh });
+			m_Registry.Add(object, BoundsComponent());
+			m_StructureChanged = true;
+		}
+
+		m_TransformsDirty = true;
+		return object;
+	}
+
+	void Scene::SetLocalTransform(Entity object, const glm::mat4& transform)
+	{
+		TransformComponent& component = m_Registry.Get<TransformComponent>(object);
+		component.Local = transform;
+		component.Dirty = 1;
+		m_TransformsDirty = true;
+	}
+
+	void Scene::SetWorldTransform(Entity object, const glm::mat4& transform)
+	{
+		Entity parent = m_Registry.Get<TransformComponent>(object).Parent;
+		SetLocalTransform(object, parent == NullEntity ? transform : glm::inverse(GetWorldTransform(parent)) * transform);
+	}
+
+	void Scene::SetSelected(Entity object, bool selected)
+	{
+		if (!m_Registry.IsAlive(object))
+			return;
+
+		// 태그 추가/제거 = 아키타입 이동 (행 하나 복사)
+		if (selected)
+			m_Registry.Add(object, SelectedComponent());
+		else
+			m_Registry.Remove<SelectedComponent>(object);
+		m_Version++;
+	}
+
+	void Scene::Update()
+	{
+		if (!m_TransformsDirty && !m_StructureChanged)
+			return;
+
+		UpdateTransforms();
+		UpdateBVH();
+		m_TransformsDirty = false;
+		m_StructureChanged = false;
+		m_Version++;
+	}
+
+	void Scene::UpdateTransforms()
+	{
+		// 1. 얕은 단계부터: 부모는 이전 단계에서 이미 끝났으므로 읽기만 함
+		//    바뀐 오브젝트는 Dirty로 남겨서 자식에게 전파
+		const Registry& registry = m_Registry;
+		for (uint32_t depth = 0; depth <= m_MaxDepth; depth++)
+		{
+			m_Registry.ParallelEach<TransformComponent>([&](Entity, TransformComponent& transform)
+			{
+				if (transform.Depth != depth)
+					return;
+
+				if (transform.Parent == NullEntity)
+				{
+					if (transform.Dirty)
+						transform.World = transform.Local;
+					return;
+				}
+
+				const TransformComponent& parent = registry.Get<TransformComponent>(transform.Parent);
+				if (!transform.Dirty && !parent.Dirty)
+					return;
+
+				transform.Dirty = 1;
+				transform.World = parent.World * transform.Local;
+			});
+		}
+
+		// 2. 월드 AABB: 지역 AABB의 중심/반지름을 변환 (반지름은 행렬 절대값으로 투영, Arvo 방식)
+		m_Registry.ParallelEach<TransformComponent, MeshComponent, BoundsComponent>([&](Entity, TransformComponent& transform, MeshComponent& mesh, BoundsComponent& bounds)
+		{
+			if (!transform.Dirty)
+				return;
+
+			const SceneMesh& sceneMesh = m_Meshes[mesh.Mesh];
+			const glm::mat4& m = transform.World;
+			glm::vec3 center = (sceneMesh.BoundsMin + sceneMesh.BoundsMax) * 0.5f;
+			glm::vec3 extent = (sceneMesh.BoundsMax - sceneMesh.BoundsMin) * 0.5f;
+
+			glm::vec3 worldCenter = glm::vec3(m * glm::vec4(center, 1.0f));
+			glm::vec3 worldExtent;
+			for (int row = 0; row < 3; row++)
+				worldExtent[row] = std::fabs(m[0][row]) * extent.x + std::fabs(m[1][row]) * extent.y + std::fabs(m[2][row]) * extent.z;
+
+			bounds.Min = worldCenter - worldExtent;
+			bounds.Max = worldCenter + worldExtent;
+		});
+
+		m_Registry.ParallelEach<TransformComponent>([](Entity, TransformComponent& transform)
+		{
+			transform.Dirty = 0;
+		});
+	}
+
+	void Scene::UpdateBVH()
+	{
+		// 메쉬 오브젝트가 늘었으면 Slot을 다시 매기고 재구성, 움직이기만 했으면 박스만 갱신
+		if (m_StructureChanged)
+		{
+			m_SlotEntities.clear();
+			m_BVHBoundsMin.clear();
+			m_BVHBoundsMax.clear();
+			m_Registry.Each<BoundsComponent>([&](Entity entity, BoundsComponent& bounds)
+			{
+				bounds.Slot = (uint32_t)m_SlotEntities.size();
+				m_SlotEntities.push_back(entity);
+				m_BVHBoundsMin.push_back(bounds.Min);
+				m_BVHBoundsMax.push_back(bounds.Max);
+			});
+
+			m_BVHItems.resize(m_SlotEntities.size());
+			for (uint32_t i = 0; i < (uint32_t)m_BVHItems.size(); i++)
+				m_BVHItems[i] = i;
+			m_BVH.Build(m_BVHBoundsMin, m_BVHBoundsMax, m_BVHItems);
+			return;
+		}
+
+		m_Registry.Each<BoundsComponent>([&](Entity, BoundsComponent& bounds)
+		{
+			m_BVHBoundsMin[bounds.Slot] = bounds.Min;
+			m_BVHBoundsMax[bounds.Slot] = bounds.Max;
+		});
+		m_BVH.Refit(m_BVHBoundsMin, m_BVHBoundsMax);
+	}
+
+	Entity Scene::Raycast(const glm::vec3& origin, const glm::vec3& direction, float& outT) const
+	{
+		uint32_t slot = m_BVH.Raycast(origin, direction, [&](uint32_t item, float maxT, float& t)
+		{
+			Entity object = m_SlotEntities[item];
+
+			// 광선을 지역 좌표로 (방향은 정규화하지 않음 -> t가 월드와 같음)
+			glm::mat4 inverse = glm::inverse(m_Registry.Get<TransformComponent>(object).World);
+			glm::vec3 localOrigin = glm::vec3(inverse * glm::vec4(origin, 1.0f));
+			glm::vec3 localDirection = glm::vec3(inverse * glm::vec4(direction, 0.0f));
+
+			// Moller-Trumbore (양면)
+			const SceneMesh& mesh = m_Meshes[m_Registry.Get<MeshComponent>(object).Mesh];
+			bool found = false;
+			for (size_t i = 0; i + 2 < mesh.Indices.size(); i += 3)
+			{
+				const glm::vec3& a = mesh.Vertices[mesh.Indices[i]];
+				glm::vec3 e1 = mesh.Vertices[mesh.Indices[i + 1]] - a;
+				glm::vec3 e2 = mesh.Vertices[mesh.Indices[i + 2]] - a;
+				glm::vec3 p = glm::cross(localDirection, e2);
+				float det = glm::dot(e1, p);
+				if (std::fabs(det) < 1e-12f)
+					continue;
+
+				float invDet = 1.0f / det;
+				glm::vec3 s = localOrigin - a;
+				float u = glm::dot(s, p) * invDet;
+				if (u < 0.0f || u > 1.0f)
+					continue;
+				glm::vec3 q = glm::cross(s, e1);
+				float v = glm::dot(localDirection, q) * invDet;
+				if (v < 0.0f || u + v > 1.0f)
+					continue;
+
+				float hitT = glm::dot(e2, q) * invDet;
+				if (hitT > 0.0f && hitT < maxT)
+				{
+					maxT = hitT;
+					found = true;
+				}
+			}
+			t = maxT;
+			return found;
+		}, outT);
+
+		return slot == ~0u ? NullEntity : m_SlotEntities[slot];
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "SceneBVH.h"
+#include "Components.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 여러 오브젝트가 공유하는 메쉬 (지역 좌표). 한 번 추가하면 바뀌지 않음
+	struct SceneMesh
+	{
+		std::vector<glm::vec3> Vertices;
+		std::vector<uint32_t> Indices;
+		glm::vec3 BoundsMin = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 BoundsMax = { 0.0f, 0.0f, 0.0f };
+	};
+
+	// 오브젝트 = Registry 엔티티 (Transform / Mesh / Bounds / Selected 컴포넌트)
+	// 트랜스폼 계층은 Depth 단계별로 병렬 갱신 (같은 단계끼리는 서로 의존하지 않음)
+	class Scene
+	{
+	public:
+		static constexpr uint32_t None = ~0u;
+
+		uint32_t AddMesh(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+		// mesh == None 이면 그리지 않는 그룹 오브젝트 (자식을 묶어서 옮기는 용도)
+		Entity CreateObject(uint32_t mesh, const glm::mat4& localTransform, Entity parent = NullEntity);
+
+		void SetLocalTransform(Entity object, const glm::mat4& transform);
+		// 월드 기준 트랜스폼을 부모 기준으로 환산해서 설정 (부모의 월드 행렬은 최신이어야 함)
+		void SetWorldTransform(Entity object, const glm::mat4& transform);
+		void SetSelected(Entity object, bool selected);
+
+		// 바뀐 오브젝트(와 그 자식)만 월드 행렬/박스 갱신 후 TLAS 재구성 또는 Refit
+		void Update();
+
+		// 가장 가까운 오브젝트 (삼각형 단위 정밀 검사, 없으면 NullEntity)
+		Entity Raycast(const glm::vec3& origin, const glm::vec3& direction, float& outT) const;
+
+		size_t GetObjectCount() const { return m_Registry.GetEntityCount(); }
+		size_t GetMeshCount() const { return m_Meshes.size(); }
+		const SceneMesh& GetMesh(uint32_t mesh) const { return m_Meshes[mesh]; }
+		const glm::mat4& GetWorldTransform(Entity object) const { return m_Registry.Get<TransformComponent>(object).World; }
+		size_t GetSlotCount() const { return m_SlotEntities.size(); } // 메쉬 있는 오브젝트 수 (Update 이후)
+
+		// 레이어/렌더러는 컴포넌트를 직접 조회
+		Registry& GetRegistry() { return m_Registry; }
+		const Registry& GetRegistry() const { return m_Registry; }
+
+		// 오브젝트 추가, 트랜스폼, 선택이 바뀌면 증가 (렌더러 재업로드 판단용)
+		uint32_t GetVersion() const { return m_Version; }
+
+	private:
+		void UpdateTransforms();
+		void UpdateBVH();
+
+	private:
+		std::vector<SceneMesh> m_Meshes;
+		Registry m_Registry;
+
+		uint32_t m_MaxDepth = 0;
+		bool m_TransformsDirty = false;
+		bool m_StructureChanged = false; // 메쉬 오브젝트 추가 -> TLAS 재구성 (아니면 Refit)
+		uint32_t m_Version = 0;
+
+		SceneBVH m_BVH;
+		std::vector<Entity> m_SlotEntities; // TLAS 항목 번호 -> 엔티티
+		std::vector<uint32_t> m_BVHItems;
+		std::vector<glm::vec3> m_BVHBoundsMin;
+		std::vector<glm::vec3> m_BVHBoundsMax;
+	};
+}
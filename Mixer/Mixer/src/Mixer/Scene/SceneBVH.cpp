@@ -0,0 +1,151 @@
+#include "mxpch.h"
+#include "SceneBVH.h"
+
+#include <algorithm>
+#include <cfloat>
+
+namespace Mixer {
+
+	void SceneBVH::Build(const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax, const std::vector<uint32_t>& items)
+	{
+		m_Nodes.clear();
+		m_Items = items;
+		if (m_Items.empty())
+			return;
+
+		m_Nodes.reserve(m_Items.size() * 2);
+		m_Nodes.push_back({ glm::vec3(0.0f), 0, glm::vec3(0.0f), (uint32_t)m_Items.size() });
+		Subdivide(0, boundsMin, boundsMax);
+	}
+
+	void SceneBVH::Subdivide(uint32_t nodeIndex, const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax)
+	{
+		uint32_t first = m_Nodes[nodeIndex].LeftFirst, count = m_Nodes[nodeIndex].Count;
+
+		// 1. 노드 박스 + 중심점 범위
+		glm::vec3 nodeMin(FLT_MAX), nodeMax(-FLT_MAX), centerMin(FLT_MAX), centerMax(-FLT_MAX);
+		for (uint32_t i = first; i < first + count; i++)
+		{
+			uint32_t item = m_Items[i];
+			nodeMin = glm::min(nodeMin, boundsMin[item]);
+			nodeMax = glm::max(nodeMax, boundsMax[item]);
+			glm::vec3 center = (boundsMin[item] + boundsMax[item]) * 0.5f;
+			centerMin = glm::min(centerMin, center);
+			centerMax = glm::max(centerMax, center);
+		}
+		m_Nodes[nodeIndex].Min = nodeMin;
+		m_Nodes[nodeIndex].Max = nodeMax;
+
+		if (count <= MaxLeafItems)
+			return;
+
+		// 2. 중심점이 가장 넓게 퍼진 축의 중앙값으로 반씩 나눔
+		glm::vec3 extent = centerMax - centerMin;
+		int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+		if (extent[axis] <= 0.0f)
+			return; // 전부 같은 위치 -> 나눠도 소용 없음
+
+		uint32_t half = count / 2;
+		std::nth_element(m_Items.begin() + first, m_Items.begin() + first + half, m_Items.begin() + first + count,
+			[&](uint32_t a, uint32_t b) { return boundsMin[a][axis] + boundsMax[a][axis] < boundsMin[b][axis] + boundsMax[b][axis]; });
+
+		uint32_t left = (uint32_t)m_Nodes.size();
+		m_Nodes.push_back({ glm::vec3(0.0f), first, glm::vec3(0.0f), half });
+		m_Nodes.push_back({ glm::vec3(0.0f), first + half, glm::vec3(0.0f), count - half });
+		m_Nodes[nodeIndex].LeftFirst = left;
+		m_Nodes[nodeIndex].Count = 0;
+
+		Subdivide(left, boundsMin, boundsMax);
+		Subdivide(left + 1, boundsMin, boundsMax);
+	}
+
+	void SceneBVH::Refit(const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax)
+	{
+		for (size_t n = m_Nodes.size(); n-- > 0;)
+		{
+			Node& node = m_Nodes[n];
+			if (node.Count == 0)
+			{
+				node.Min = glm::min(m_Nodes[node.LeftFirst].Min, m_Nodes[node.LeftFirst + 1].Min);
+				node.Max = glm::max(m_Nodes[node.LeftFirst].Max, m_Nodes[node.LeftFirst + 1].Max);
+				continue;
+			}
+
+			node.Min = glm::vec3(FLT_MAX);
+			node.Max = glm::vec3(-FLT_MAX);
+			for (uint32_t i = node.LeftFirst; i < node.LeftFirst + node.Count; i++)
+			{
+				node.Min = glm::min(node.Min, boundsMin[m_Items[i]]);
+				node.Max = glm::max(node.Max, boundsMax[m_Items[i]]);
+			}
+		}
+	}
+
+	bool SceneBVH::IntersectBox(const Node& node, const glm::vec3& origin, const glm::vec3& inverseDirection, float maxT, float& outT)
+	{
+		// Slab 방식
+		float tMin = 0.0f, tMax = maxT;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float t0 = (node.Min[axis] - origin[axis]) * inverseDirection[axis];
+			float t1 = (node.Max[axis] - origin[axis]) * inverseDirection[axis];
+			tMin = std::max(tMin, std::min(t0, t1));
+			tMax = std::min(tMax, std::max(t0, t1));
+		}
+		outT = tMin;
+		return tMin <= tMax;
+	}
+
+	uint32_t SceneBVH::Raycast(const glm::vec3& origin, const glm::vec3& direction, const HitFn& hit, float& outT) const
+	{
+		uint32_t closest = ~0u;
+		float closestT = FLT_MAX;
+		if (m_Nodes.empty())
+			return closest;
+
+		// 0으로 나누면 inf가 되어 slab 비교가 그대로 동작
+		glm::vec3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+		uint32_t stack[64];
+		uint32_t stackSize = 0;
+		float entry;
+		if (IntersectBox(m_Nodes[0], origin, inverseDirection, closestT, entry))
+			stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const Node& node = m_Nodes[stack[--stackSize]];
+			if (node.Count > 0)
+			{
+				for (uint32_t i = node.LeftFirst; i < node.LeftFirst + node.Count; i++)
+				{
+					float t;
+					if (hit(m_Items[i], closestT, t))
+					{
+						closestT = t;
+						closest = m_Items[i];
+					}
+				}
+				continue;
+			}
+
+			// 가까운 자식을 먼저 꺼내도록 먼 쪽을 먼저 쌓음 (더 가까운 결과가 있으면 먼 쪽은 건너뜀)
+			float tLeft, tRight;
+			bool hitLeft = IntersectBox(m_Nodes[node.LeftFirst], origin, inverseDirection, closestT, tLeft);
+			bool hitRight = IntersectBox(m_Nodes[node.LeftFirst + 1], origin, inverseDirection, closestT, tRight);
+			if (hitLeft && hitRight)
+			{
+				bool leftFirst = tLeft <= tRight;
+				stack[stackSize++] = leftFirst ? node.LeftFirst + 1 : node.LeftFirst;
+				stack[stackSize++] = leftFirst ? node.LeftFirst : node.LeftFirst + 1;
+			}
+			else if (hitLeft)
+				stack[stackSize++] = node.LeftFirst;
+			else if (hitRight)
+				stack[stackSize++] = node.LeftFirst + 1;
+		}
+
+		outT = closestT;
+		return closest;
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+namespace Mixer {
+
+	// 오브젝트 바운딩 박스 위의 BVH (TLAS). 메쉬 내부 삼각형은 hit 콜백에서 검사
+	class SceneBVH
+	{
+	public:
+		// 후보 오브젝트와 광선을 정밀 검사. 맞았고 t가 maxT보다 작으면 t를 채우고 true
+		using HitFn = std::function<bool(uint32_t item, float maxT, float& outT)>;
+
+		static constexpr uint32_t MaxLeafItems = 4;
+
+		// boundsMin/Max는 오브젝트 번호로 인덱싱, items는 BVH에 넣을 오브젝트 목록
+		void Build(const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax, const std::vector<uint32_t>& items);
+		// 구조는 그대로 두고 박스만 다시 계산 (오브젝트가 움직였을 때)
+		void Refit(const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax);
+
+		// 가장 가까운 항목 (없으면 ~0u)
+		uint32_t Raycast(const glm::vec3& origin, const glm::vec3& direction, const HitFn& hit, float& outT) const;
+
+		bool IsEmpty() const { return m_Nodes.empty(); }
+
+	private:
+		// Count == 0: 내부 노드 (자식 = LeftFirst, LeftFirst + 1), 그 외: m_Items[LeftFirst..] 리프
+		struct Node
+		{
+			glm::vec3 Min;
+			uint32_t LeftFirst;
+			glm::vec3 Max;
+			uint32_t Count;
+		};
+
+		void Subdivide(uint32_t nodeIndex, const std::vector<glm::vec3>& boundsMin, const std::vector<glm::vec3>& boundsMax);
+		static bool IntersectBox(const Node& node, const glm::vec3& origin, const glm::vec3& inverseDirection, float maxT, float& outT);
+
+	private:
+		std::vector<Node> m_Nodes;       // 부모가 항상 자식보다 앞 (Refit은 뒤에서부터)
+		std::vector<uint32_t> m_Items;
+	};
+}
@@ -0,0 +1,75 @@
+#include "mxpch.h"
+#include "StartupTimeline.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace Mixer {
+
+	struct StartupMark
+	{
+		std::string Step;
+		std::chrono::steady_clock::time_point Time;
+		bool MainThread;
+	};
+
+	struct StartupTimelineData
+	{
+		std::mutex Mutex;
+		std::chrono::steady_clock::time_point Start;
+		std::thread::id MainThread;
+		std::vector<StartupMark> Marks;
+		bool Active = false;
+	};
+
+	static StartupTimelineData s_Data;
+
+	void StartupTimeline::Begin()
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		s_Data.Start = std::chrono::steady_clock::now();
+		s_Data.MainThread = std::this_thread::get_id();
+		s_Data.Marks.clear();
+		s_Data.Active = true;
+	}
+
+	void StartupTimeline::Mark(const std::string& step)
+	{
+		auto now = std::chrono::steady_clock::now();
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		if (s_Data.Active)
+			s_Data.Marks.push_back({ step, now, std::this_thread::get_id() == s_Data.MainThread });
+	}
+
+	void StartupTimeline::Finish()
+	{
+		auto now = std::chrono::steady_clock::now();
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		if (!s_Data.Active)
+			return;
+		s_Data.Active = false;
+
+		// 다른 스레드 (렌더 스레드, 작업)의 표시는 메인 스레드 단계와 겹치므로
+		// 줄마다 시작 기준 시각과 같은 종류의 이전 표시부터 걸린 시간을 따로 표시
+		auto ms = [](std::chrono::steady_clock::duration d) { return std::chrono::duration<float, std::milli>(d).count(); };
+		MX_CORE_INFO("Startup timeline ({0:.1f} ms to first frame):", ms(now - s_Data.Start));
+		std::chrono::steady_clock::time_point previous[2] = { s_Data.Start, s_Data.Start };
+		for (const StartupMark& mark : s_Data.Marks)
+		{
+			auto& last = previous[mark.MainThread ? 0 : 1];
+			MX_CORE_INFO("  {0:8.1f} ms  +{1:7.1f} ms  {2}{3}", ms(mark.Time - s_Data.Start), ms(mark.Time - last),
+				mark.MainThread ? "" : "[worker] ", mark.Step);
+			last = mark.Time;
+		}
+		s_Data.Marks.clear();
+		s_Data.Marks.shrink_to_fit();
+	}
+
+	bool StartupTimeline::IsActive()
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		return s_Data.Active;
+	}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Mixer/Core.h"
+
+#include <string>
+
+namespace Mixer {
+
+	// 첫 프레임까지 걸린 시간을 단계별로. Application이 시계를 시작하고, 어디서든 (어느 스레드에서든) 표시를 추가
+	// 첫 프레임이 끝나면 전체를 한 번 로그로 출력, 그 뒤의 표시는 무시
+	class MIXER_API StartupTimeline
+	{
+	public:
+		static void Begin();
+		static void Mark(const std::string& step);
+		static void Finish();
+
+		static bool IsActive();
+	};
+
+}
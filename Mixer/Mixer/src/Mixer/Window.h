@@ -27,7 +27,7 @@ namespace Mixer {
 	public:
 		using EventCallbackFn = std::function<void(Event&)>;
 		virtual ~Window() {};
-		virtual void OnUpdate() = 0;
+		virtual void OnUpdate() = 0; // [수정] 이벤트 처리 (메인 스레드)
 		virtual unsigned int GetWidth() const = 0;
 		virtual unsigned int GetHeight() const = 0;
 
@@ -36,6 +36,11 @@ namespace Mixer {
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
 
+		// [추가] 컨텍스트 소유권은 렌더 스레드로 넘어감 (RenderThread)
+		virtual void MakeContextCurrent() = 0;
+		virtual void DetachContext() = 0;
+		virtual void SwapBuffers() = 0; // 컨텍스트를 가진 스레드에서
+
 		static Window* Create(const WindowProps& props = WindowProps());
 
 	};
@@ -142,21 +142,35 @@ namespace Mixer {
 	void WindowsWindow::OnUpdate()
 	{
 		glfwPollEvents();
-		glfwSwapBuffers(m_Window);
 	}
 
 	void WindowsWindow::SetVSync(bool enabled)
 	{
-		if (enabled)
-		{
-			glfwSwapInterval(1);
-		}
+		m_Data.VSync = enabled;
+
+		// [추가] 스왑 간격은 컨텍스트 설정: 다른 스레드가 컨텍스트를 가지고 있으면 다음 스왑 때 적용
+		if (glfwGetCurrentContext() == m_Window)
+			glfwSwapInterval(enabled ? 1 : 0);
 		else
-		{
-			glfwSwapInterval(0);
-		}
+			m_Data.SwapIntervalDirty = true;
+	}
 
-		m_Data.VSync = enabled;
+	void WindowsWindow::MakeContextCurrent()
+	{
+		glfwMakeContextCurrent(m_Window);
+	}
+
+	void WindowsWindow::DetachContext()
+	{
+		if (glfwGetCurrentContext() == m_Window)
+			glfwMakeContextCurrent(nullptr);
+	}
+
+	void WindowsWindow::SwapBuffers()
+	{
+		if (m_Data.SwapIntervalDirty.exchange(false))
+			glfwSwapInterval(m_Data.VSync ? 1 : 0);
+		glfwSwapBuffers(m_Window);
 	}
 
 	bool WindowsWindow::IsVSync() const
@@ -3,6 +3,7 @@
 #include "Mixer/Window.h"
 
 #include <GLFW/glfw3.h>
+#include <atomic>
 
 namespace Mixer {
 	class WindowsWindow : public Window
@@ -23,6 +24,10 @@ namespace Mixer {
 		void SetVSync(bool enabled) override;
 
 		bool IsVSync() const override;
+
+		void MakeContextCurrent() override;
+		void DetachContext() override;
+		void SwapBuffers() override;
 	private:
 		virtual void Init(const WindowProps& props);
 		virtual void Shutdown();
@@ -32,6 +37,7 @@ namespace Mixer {
 			std::string Title;
 			unsigned int Width, Height;
 			bool VSync;
+			std::atomic<bool> SwapIntervalDirty{ false }; // [추가] 다른 스레드가 컨텍스트를 가진 동안 바뀜
 
 			EventCallbackFn EventCallback;
 		};
@@ -0,0 +1,53 @@
+#version 330 core
+// every pixel intersects its view ray with the y = 0 plane (cost independent of zoom)
+layout(location = 0) out vec4 FragColor;
+in vec2 v_NDC;
+uniform mat4 u_ViewProjection;
+uniform mat4 u_InverseViewProjection;
+uniform vec3 u_CameraPosition;
+uniform float u_Spacing;      // minor line spacing (power of 10), major lines every 10
+uniform float u_LevelBlend;   // 0..1, minor lines fade out with distance
+uniform float u_FadeDistance;
+
+vec3 Unproject(float z) {
+    vec4 p = u_InverseViewProjection * vec4(v_NDC, z, 1.0);
+    return p.xyz / p.w;
+}
+
+// line coverage, anti-aliased to 1 pixel with screen derivatives. Cells smaller than a pixel fade out instead of moire
+float Lines(vec2 coord, float spacing) {
+    vec2 cell = coord / spacing;
+    vec2 width = fwidth(cell);
+    vec2 dist = abs(fract(cell - 0.5) - 0.5) / width;
+    float line = 1.0 - min(min(dist.x, dist.y), 1.0);
+    return line * (1.0 - smoothstep(0.25, 0.5, max(width.x, width.y)));
+}
+
+// axis line (2 pixels wide)
+float Axis(float coord) {
+    return clamp(1.5 - abs(coord) / fwidth(coord), 0.0, 1.0);
+}
+
+void main() {
+    vec3 nearPoint = Unproject(-1.0);
+    vec3 farPoint = Unproject(1.0);
+    vec3 ray = farPoint - nearPoint;
+    float t = (abs(ray.y) > 1e-6) ? -nearPoint.y / ray.y : -1.0;
+    vec3 pos = nearPoint + ray * t;
+
+    // derivatives outside any branch (discard comes last)
+    float minor = Lines(pos.xz, u_Spacing) * (1.0 - u_LevelBlend);
+    float major = Lines(pos.xz, u_Spacing * 10.0);
+    vec4 color = vec4(0.4, 0.4, 0.4, max(minor * 0.6, major));
+    color = mix(color, vec4(1.0, 0.0, 0.0, 1.0), Axis(pos.z)); // X axis (red)
+    color = mix(color, vec4(0.0, 0.0, 1.0, 1.0), Axis(pos.x)); // Z axis (blue)
+    color.a *= 1.0 - smoothstep(u_FadeDistance * 0.5, u_FadeDistance, length(pos - u_CameraPosition));
+
+    if (t < 0.0 || t > 1.0 || color.a <= 0.0)
+        discard; // plane behind the camera or beyond far
+    FragColor = color;
+
+    // depth-tested against the models (no depth write)
+    vec4 clip = u_ViewProjection * vec4(pos, 1.0);
+    gl_FragDepth = clip.z / clip.w * 0.5 + 0.5;
+}
@@ -0,0 +1,7 @@
+#version 330 core
+// one full-screen triangle from gl_VertexID (no vertex buffer)
+out vec2 v_NDC;
+void main() {
+    v_NDC = vec2((gl_VertexID == 1) ? 3.0 : -1.0, (gl_VertexID == 2) ? 3.0 : -1.0);
+    gl_Position = vec4(v_NDC, 0.0, 1.0);
+}
@@ -0,0 +1,10 @@
+#version 330 core
+layout(location = 0) out vec4 FragColor;
+in vec3 v_Normal;
+flat in int v_Selected;
+uniform vec3 u_LightDir;
+void main() {
+    vec3 color = (v_Selected != 0) ? vec3(1.0, 0.6, 0.1) : vec3(0.6, 0.6, 0.6);
+    float diffuse = abs(dot(normalize(v_Normal), u_LightDir));
+    FragColor = vec4(color * (0.25 + 0.85 * diffuse), 1.0);
+}
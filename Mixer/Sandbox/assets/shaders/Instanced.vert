@@ -0,0 +1,14 @@
+#version 330 core
+// per-instance attributes: 2..5 = model matrix (4 columns), 6 = selected
+layout(location = 0) in vec3 a_Pos;
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in mat4 a_Model;
+layout(location = 6) in uint a_Selected;
+uniform mat4 u_ViewProjection;
+out vec3 v_Normal;
+flat out int v_Selected;
+void main() {
+    gl_Position = u_ViewProjection * a_Model * vec4(a_Pos, 1.0);
+    v_Normal = mat3(a_Model) * a_Normal; // assumes uniform scale
+    v_Selected = int(a_Selected);
+}
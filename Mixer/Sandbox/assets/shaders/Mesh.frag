@@ -0,0 +1,24 @@
+#version 330 core
+layout(location = 0) out vec4 FragColor;
+in vec3 v_Normal;
+in vec3 v_WorldPos;
+uniform vec4 u_Color;
+uniform int u_Lit;
+uniform vec3 u_LightDir;
+uniform float u_DitherFade;
+uniform int u_DitherInvert;
+void main() {
+    // LOD transition: screen-space noise splits the pixels so the two levels fill each other's holes
+    float noise = fract(52.9829189 * fract(dot(gl_FragCoord.xy, vec2(0.06711056, 0.00583715))));
+    if ((noise < u_DitherFade) == (u_DitherInvert != 0))
+        discard;
+    if (u_Lit == 0) {
+        FragColor = u_Color;
+        return;
+    }
+    // two-sided lighting: face winding may be mixed
+    // u_Lit == 2: face normal from screen-space derivatives, no normal buffer (subdivision preview)
+    vec3 n = (u_Lit == 2) ? normalize(cross(dFdx(v_WorldPos), dFdy(v_WorldPos))) : normalize(v_Normal);
+    float diffuse = abs(dot(n, u_LightDir));
+    FragColor = vec4(u_Color.rgb * (0.25 + 0.85 * diffuse), u_Color.a);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+layout(location = 0) in vec3 a_Pos;
+layout(location = 1) in vec3 a_Normal;
+uniform mat4 u_ViewProjection;
+out vec3 v_Normal;
+out vec3 v_WorldPos;
+void main() {
+    gl_Position = u_ViewProjection * vec4(a_Pos, 1.0);
+    gl_PointSize = 20.0;
+    v_Normal = a_Normal;
+    v_WorldPos = a_Pos;
+}
@@ -84,6 +84,14 @@ project "Mixer"
 			"/utf-8"
 		}
 
+	-- Position kernel variants: built per instruction set, picked at runtime (SSE4.2 needs no flag on x64)
+	-- These files include no shared inline code (no PCH, glm or PositionStore), so /arch stays in them
+	filter "files:**/PositionKernelsAVX2.cpp"
+		buildoptions "/arch:AVX2"
+
+	filter "files:**/PositionKernelsAVX512.cpp"
+		buildoptions "/arch:AVX512"
+
 	filter "configurations:Debug"
 		defines "MX_DEBUG"
 		buildoptions "/MDd"